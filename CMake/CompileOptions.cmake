@@ -68,6 +68,15 @@ endif ()
 
 set(DEFAULT_COMPILE_OPTIONS)
 
+# Instruction set flags are not applied globally
+# Only sources named *Avx2.cpp, *Avx512.cpp, *Avx512Vnni.cpp and
+# *Avx512Bf16.cpp are compiled
+# with them, and kernels in them are selected at runtime depending on the cpu
+set(AVX2_COMPILE_OPTIONS)
+set(AVX512_COMPILE_OPTIONS)
+set(AVX512VNNI_COMPILE_OPTIONS)
+set(AVX512BF16_COMPILE_OPTIONS)
+
 # MSVC compiler options
 if (CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
     # remove default warning level from CMAKE_CXX_FLAGS
@@ -76,11 +85,13 @@ if (CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
     set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} /FS")
 
     if (USE_AVX2 AND NOT MSVC_VERSION LESS 1800)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX /arch:AVX2")
+        set(AVX2_COMPILE_OPTIONS /arch:AVX2)
         add_compile_definitions(WITH_AVX2)
     endif ()
     if (USE_AVX512 AND NOT MSVC_VERSION LESS 1800)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX512")
+        set(AVX512_COMPILE_OPTIONS /arch:AVX512)
+        set(AVX512VNNI_COMPILE_OPTIONS /arch:AVX512)
+        set(AVX512BF16_COMPILE_OPTIONS /arch:AVX512)
         add_compile_definitions(WITH_AVX512)
     endif ()
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /openmp")
@@ -144,11 +155,16 @@ if (CMAKE_CXX_COMPILER_ID MATCHES "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES "Clang"
      endif()
 
     if (USE_AVX2)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx -mavx2")
+        set(AVX2_COMPILE_OPTIONS -mavx -mavx2 -mfma -mf16c)
         add_compile_definitions(WITH_AVX2)
     endif ()
     if (USE_AVX512)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx512")
+        set(AVX512_COMPILE_OPTIONS
+                -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma)
+        set(AVX512VNNI_COMPILE_OPTIONS
+                ${AVX512_COMPILE_OPTIONS} -mavx512vnni)
+        set(AVX512BF16_COMPILE_OPTIONS
+                ${AVX512_COMPILE_OPTIONS} -mavx512bf16)
         add_compile_definitions(WITH_AVX512)
     endif ()
 endif ()
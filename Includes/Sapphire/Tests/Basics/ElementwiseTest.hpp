@@ -0,0 +1,33 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_ELEMENTWISE_TEST_HPP
+#define SAPPHIRE_TEST_ELEMENTWISE_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares host elementwise operations with contiguous, scalar and row
+//! broadcast inputs against scalar reference on every supported instruction
+//! set
+void ElementwiseBroadcastTest(bool print);
+
+//! Compares host transcendental functions and softmax against double
+//! precision libm on every supported instruction set and precision
+void TranscendentalTest(bool print);
+
+//! Compares host inverse trigonometric functions and accumulated gradients
+//! of trigonometric functions against double precision libm on every
+//! supported instruction set and precision
+void TranscendentalBackwardTest(bool print);
+
+//! Compares host softmax and its gradient over rows longer than a block,
+//! with logits large enough to overflow exp and with -inf prefix longer than
+//! a block, against double precision reference on every supported
+//! instruction set
+void SoftmaxTest(bool print);
+}
+
+#endif
@@ -10,6 +10,11 @@
 namespace Sapphire::Test
 {
 void TransposeTest(bool printResult);
+
+//! Compares host Transpose with each supported instruction set against
+//! transposition by indices, on matrices whose sizes are not multiples of
+//! register blocks, with and without broadcast input
+void TransposeHostTest(bool printResult);
 }
 
 #endif
\ No newline at end of file
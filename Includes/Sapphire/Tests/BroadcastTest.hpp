@@ -15,6 +15,10 @@ void BroadcastWithOneDimension(bool print);
 void BroadcastWithMissingDimension(bool print);
 
 void BroadcastMixed(bool print);
+
+//! Compares host element-wise operations over randomly broadcast shapes of
+//! up to 5 dimensions against indices computed for each element
+void BroadcastElementwiseOps(bool print);
 } // namespace Sapphire::Test
 
 #endif  // Sapphire_BROADCASTTEST_HPP
@@ -14,6 +14,10 @@ void AvgPool2DTest(bool printForward, bool printBackward);
 
 void HostIm2ColTest(bool print);
 
+//! Compares host Im2Col on float and uint8 data, and host Col2Im, against
+//! reference loops with stride, padding and dilation on both axes
+void HostIm2ColReferenceTest(bool print);
+
 void HostConv2DTest(bool print);
 
 void HostConv2DBackwardTest(bool print);
@@ -7,8 +7,84 @@
 #ifndef SAPPHIRE_TEST_GEMM_TEST_HPP
 #define SAPPHIRE_TEST_GEMM_TEST_HPP
 
+#include <iostream>
+
 namespace Sapphire::Test
 {
+//! Compares host gemm on each instruction set supported by current cpu
+//! against reference loops, on sizes which are not multiples of the kernel
+//! and block sizes
+void GemmReference(bool print);
+
+//! Compares host gemm results between all instruction sets supported by
+//! current cpu
+void GemmInstructionSets(bool print);
+
+//! Compares single threaded host gemm with multi threaded one
+void GemmMultiThread(bool print);
+
+//! Compares gemm with transposed operands against gemm on explicitly
+//! transposed copies
+void GemmTranspose(bool print);
+
+//! Compares gemm with alpha and beta against separate gemm, scale and add
+void GemmAlphaBeta(bool print);
+
+//! Compares gemm with fused bias and activation against separate gemm, add
+//! and activation
+void GemmBiasActivation(bool print);
+
+//! Compares gemm on vector-matrix shapes, which is computed by gemv, against
+//! blocked gemm
+void GemvCorrectness(bool print);
+
+//! Compares batched gemm on small matrices, which is computed by kernels
+//! specialized for their sizes, against plain loops
+void GemmSmallBatched(bool print);
+
+//! Compares gemm with preserved operand, which is packed once and reused
+//! from the cache, against gemm with volatile copy of it, before and after
+//! the preserved operand is modified by SetData, initializers and compute
+//! operations
+void GemmPackedCache(bool print);
+
+//! Compares autotuned gemm, and gemm with tunings loaded back from the tuning
+//! file, against gemm with default block sizes
+void GemmAutotune(bool print);
+
+//! Compares int8 gemm with dequantized and requantized outputs on each
+//! instruction set against float gemm on dequantized operands
+void QuantizedGemm(bool print);
+
+//! Compares gemm with fp16 and bf16 weights, and elementwise add on 16-bit
+//! tensors, on each instruction set against float operations on the
+//! rounded operands
+void HalfGemm(bool print);
+
+//! Latency of batch-1 linear layer product in microseconds
+struct GemvLatency
+{
+    double GemvP50;
+    double GemvP99;
+    double GemmP50;
+    double GemmP99;
+
+    void PrintData() const
+    {
+        std::cout << "--- Gemv latency (time in microseconds) ---" << std::endl;
+        std::cout << "* Gemv p50 : " << GemvP50 << " p99 : " << GemvP99
+                  << std::endl;
+        std::cout << "* Gemm p50 : " << GemmP50 << " p99 : " << GemmP99
+                  << std::endl;
+        std::cout << "-------------------------------------------\n"
+                  << std::endl;
+    }
+};
+
+//! Measures (1 x inputs) x (outputs x inputs)^T product computed by gemv and
+//! by blocked gemm for given number of iterations
+GemvLatency GemvPerformance(int inputs, int outputs, int iterations);
+
 #ifdef WITH_CUDA
 void Gemm1(bool print);
 
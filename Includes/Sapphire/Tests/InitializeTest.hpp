@@ -0,0 +1,18 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_INITIALIZE_TEST_HPP
+#define SAPPHIRE_TEST_INITIALIZE_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Checks that host random initializers give the same data for the same
+//! seed regardless of number of threads, replay the global seed after
+//! Util::SetSeed, and have the requested mean and deviation
+void SeededInitializeTest(bool print);
+}
+
+#endif
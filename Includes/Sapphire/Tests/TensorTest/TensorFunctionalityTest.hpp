@@ -18,6 +18,10 @@ void TensorDataCopyOnCuda(bool print);
 //! Tests whether data is preserved when copying
 void TensorDataCopyOnHost(bool print);
 
+//! Tests allocation, conversion and indexing of data types other than
+//! Float32
+void TensorDataTypes(bool print);
+
 }
 
 #endif
@@ -23,7 +23,8 @@ void ReLUBackward(TensorData& dx, const TensorData& dy, const TensorData& x);
 
 void LeakyReLUBackward(TensorData& dx, const TensorData& dy, const TensorData& x, float a);
 
-void SoftMaxBackward(TensorData& dx, const TensorData& dy, const TensorData& x);
+//! Accumulates gradient of SoftMax to dx, where y is its output
+void SoftMaxBackward(TensorData& dx, const TensorData& dy, const TensorData& y);
 
 }
 
@@ -27,8 +27,37 @@ void Sub(TensorData& y, const TensorData& a, const TensorData& b);
 //! Performs Element-wise multiply
 void Dot(TensorData& y, const TensorData& a, const TensorData& b);
 
-//! Performs GEMM (y = a*b + c)
-void Gemm(TensorData& y, const TensorData& a, const TensorData& b);
+//! Performs GEMM (y = alpha*op(a)*op(b) + beta*y)
+//! \param transA, transB : If true, last two dimensions of the operand are
+//! treated as transposed. Operand is read in place without being copied
+//! \param alpha : scale factor of the product
+//! \param beta : scale factor of y. If 0, y does not have to be initialized
+//! \param numThreads : number of threads used on host. If 0, global setting
+//! from Util::SetNumThreads is used. Ignored on cuda
+void Gemm(TensorData& y, const TensorData& a, const TensorData& b,
+          bool transA = false, bool transB = false, float alpha = 1.0f,
+          float beta = 1.0f, int numThreads = 0);
+
+//! Activation applied by GemmBiasActivation
+enum class GemmActivation
+{
+    None,
+    ReLU,
+    LeakyReLU,
+};
+
+//! Performs y = activation(op(a)*op(b) + bias)
+//! On host, bias and activation are applied by the GEMM micro kernel while
+//! each output tile is still in registers, so y is written only once
+//! y is not read, and must not be broadcast over a or b
+//! \param bias : vector with as many elements as columns of y, added to every
+//! row
+//! \param negativeSlope : slope of LeakyReLU for negative inputs
+void GemmBiasActivation(TensorData& y, const TensorData& a,
+                        const TensorData& b, const TensorData& bias,
+                        bool transA = false, bool transB = false,
+                        GemmActivation activation = GemmActivation::None,
+                        float negativeSlope = 0.0f, int numThreads = 0);
 
 //! Performs y = x*factor
 void Scale(TensorData& y, const TensorData& x, float factor);
@@ -47,8 +76,11 @@ void exp(TensorData& y, const TensorData& x);
 
 void Inverse(TensorData& y, const TensorData& x);
 
+//! Computes mean over dim, which should have size of 1 in y
+//! Computed by reduction over {dim} on host (see ReduceOps.hpp)
 void Mean(TensorData& y, const TensorData& x, int dim);
 
+//! Backward operations accumulate the gradient to dx (or da and db)
 void DotBackward(TensorData& da, TensorData& db, const TensorData& dy,
                  const TensorData& a, const TensorData& b);
 
@@ -6,185 +6,382 @@
 
 #ifndef SAPPHIRE_COMPUTE_BROADCAST_HPP
 #define SAPPHIRE_COMPUTE_BROADCAST_HPP
+#include <Sapphire/util/Parallel.hpp>
 #include <Sapphire/util/Shape.hpp>
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
 
 namespace Sapphire::Compute
 {
-//! Broadcasts given shape and invokes the function
-//! Each shape variable are required to be same size in reversed order
-//! containing row and column indices shapes must be padded to match the same
-//! shape as yShape
-//! shapeIdx starts at last index of the shape array
-//! totalSize parameters should contain actual total size of the whole array
-//! including batch size
-template <typename Func, typename... Params>
-void BroadcastWith3Inputs(const Shape& yShape, const Shape& aShape,
-                          const Shape& bShape, const Shape& cShape,
-                          unsigned int totalSizeOut, unsigned int totalSizeA,
-                          unsigned int totalSizeB, unsigned int totalSizeC,
-                          float* out, const float* A, const float* B,
-                          const float* C,
-                          unsigned int shapeIdx,
-                          unsigned int minimumRequiredDim, Func func,
-                          Params ... params)
+//! Iteration space of broadcast operation over leading dimensions of the
+//! operands, excluding minimumRequiredDim trailing dimensions that are passed
+//! to the function as a whole
+//! Dimensions of size 1 are removed, and adjacent dimensions are merged if
+//! every operand is laid out contiguously over them, so the number of
+//! dimensions only depends on how many times broadcasting changes
+//! Dimensions are ordered from outermost to innermost
+template <std::size_t NumOperands>
+struct BroadcastLayout
 {
-    if (shapeIdx >= yShape.Dim() - minimumRequiredDim)
+    //! Number of indices of each dimension
+    std::vector<unsigned int> Extents;
+    //! Strides[i][d] is the offset of operand i between consecutive indices
+    //! of dimension d, which is 0 if operand i is broadcast along it
+    std::array<std::vector<std::size_t>, NumOperands> Strides;
+    //! Number of elements of trailing dimensions of each operand
+    std::array<std::size_t, NumOperands> BlockSizes;
+
+    [[nodiscard]] std::size_t NumDims() const
     {
-        func(totalSizeOut, out, A, B, C, params...);
-        return;
+        return Extents.size();
     }
 
-    unsigned int chunkSize = 1;
-    while (shapeIdx < yShape.Dim() - minimumRequiredDim &&
-           yShape.At(shapeIdx) == aShape.At(shapeIdx) &&
-           yShape.At(shapeIdx) == bShape.At(shapeIdx) &&
-           yShape.At(shapeIdx) == cShape.At(shapeIdx))
+    //! Returns number of indices of dimensions [begin, end)
+    [[nodiscard]] std::size_t Count(std::size_t begin, std::size_t end) const
     {
-        const auto dim = yShape.At(shapeIdx);
-        chunkSize *= dim;
-        shapeIdx += 1;
+        std::size_t count = 1;
+        for (auto dim = begin; dim < end; ++dim)
+            count *= Extents[dim];
+        return count;
     }
 
-    if (shapeIdx >= yShape.Dim() - minimumRequiredDim)
+    //! Returns true if operand is not broadcast along the dimension
+    [[nodiscard]] bool IsFull(std::size_t operand, std::size_t dim) const
     {
-        func(totalSizeOut, out, A, B, C, params...);
-        return;
+        return Strides[operand][dim] != 0;
     }
+};
 
-    //! ChunkSize represents the total size of the leftover parts to be calculated for each tensor
-    const auto chunkSizeA = chunkSize * aShape.At(shapeIdx);
-    const auto chunkSizeB = chunkSize * bShape.At(shapeIdx);
-    const auto chunkSizeC = chunkSize * cShape.At(shapeIdx);
-    const auto chunkSizeOut = chunkSize * yShape.At(shapeIdx);
-
-    const auto strideA = totalSizeA / chunkSizeA;
-    const auto strideB = totalSizeB / chunkSizeB;
-    const auto strideC = totalSizeC / chunkSizeC;
-    const auto strideOut = totalSizeOut / chunkSizeOut;
+//! Builds layout from shapes, which should be expanded to the same dimension
+//! Along each dimension, operands are broadcast if their size is 1 and some
+//! other operand has larger size
+template <std::size_t NumOperands>
+BroadcastLayout<NumOperands> MakeBroadcastLayout(
+    const std::array<const Shape*, NumOperands>& shapes,
+    unsigned int minimumRequiredDim)
+{
+    BroadcastLayout<NumOperands> layout;
+    const auto batchDim =
+        shapes[0]->Dim() - static_cast<int>(minimumRequiredDim);
 
-    const auto maxChunkSize =
-        std::max({ chunkSizeOut, chunkSizeA, chunkSizeB, chunkSizeC });
+    std::array<std::size_t, NumOperands> strides{};
+    for (std::size_t i = 0; i < NumOperands; ++i)
+    {
+        std::size_t blockSize = 1;
+        for (int dim = std::max(batchDim, 0); dim < shapes[i]->Dim(); ++dim)
+            blockSize *= shapes[i]->At(dim);
+        layout.BlockSizes[i] = blockSize;
+        strides[i] = blockSize;
+    }
 
-    //! Broadcasting happens here by incrementing tensors with dimension 1 with smaller chinkSize
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
+    //! Built from the innermost dimension, and reversed at the end
+    for (int dim = batchDim - 1; dim >= 0; --dim)
     {
-        BroadcastWith3Inputs(yShape, aShape, bShape, cShape, strideOut,
-                             strideA, strideB, strideC,
-                             out + (chunkIdx % chunkSizeOut) * strideOut,
-                             A + (chunkIdx % chunkSizeA) * strideA,
-                             B + (chunkIdx % chunkSizeB) * strideB,
-                             C + (chunkIdx % chunkSizeC) * strideC,
-                             shapeIdx + 1, minimumRequiredDim, func, params...);
+        unsigned int extent = 1;
+        for (const auto* shape : shapes)
+            extent = std::max(extent,
+                              static_cast<unsigned int>(shape->At(dim)));
+        if (extent == 1)
+            continue;
+
+        for (std::size_t i = 0; i < NumOperands; ++i)
+        {
+            const auto size = static_cast<unsigned int>(shapes[i]->At(dim));
+            layout.Strides[i].push_back(size == 1 ? 0 : strides[i]);
+            strides[i] *= size;
+        }
+        layout.Extents.push_back(extent);
+
+        const auto outer = layout.Extents.size() - 1;
+        if (outer == 0)
+            continue;
+        bool contiguous = true;
+        for (std::size_t i = 0; i < NumOperands; ++i)
+            contiguous &= layout.Strides[i][outer] ==
+                layout.Strides[i][outer - 1] * layout.Extents[outer - 1];
+        if (contiguous)
+        {
+            layout.Extents[outer - 1] *= extent;
+            layout.Extents.pop_back();
+            for (auto& operandStrides : layout.Strides)
+                operandStrides.pop_back();
+        }
     }
+
+    std::reverse(layout.Extents.begin(), layout.Extents.end());
+    for (auto& operandStrides : layout.Strides)
+        std::reverse(operandStrides.begin(), operandStrides.end());
+    return layout;
 }
 
-template <typename Func, typename... Params>
-void BroadcastWith2Inputs(const Shape& yShape, const Shape& aShape,
-                          const Shape& bShape, unsigned int totalSizeOut,
-                          unsigned int totalSizeA, unsigned int totalSizeB,
-                          float* out, const float* A, const float* B,
-                          unsigned int shapeIdx,
-                          unsigned int minimumRequiredDim, Func func,
-                          Params ... params)
+//! Returns offsets of the operands at given flat index of dimensions
+//! [0, numDims) of the layout
+template <std::size_t NumOperands>
+std::array<std::size_t, NumOperands> BroadcastOffsets(
+    const BroadcastLayout<NumOperands>& layout, std::size_t numDims,
+    std::size_t index)
 {
-    if (shapeIdx >= yShape.Dim() - minimumRequiredDim)
+    std::array<std::size_t, NumOperands> offsets{};
+    for (auto dim = numDims; dim-- > 0;)
     {
-        func(totalSizeOut, out, A, B, params...);
-        return;
+        const auto idx = index % layout.Extents[dim];
+        index /= layout.Extents[dim];
+        for (std::size_t i = 0; i < NumOperands; ++i)
+            offsets[i] += idx * layout.Strides[i][dim];
     }
+    return offsets;
+}
 
-    unsigned int chunkSize = 1;
-    while (shapeIdx < yShape.Dim() - minimumRequiredDim &&
-           (yShape.At(shapeIdx) == aShape.At(shapeIdx) &&
-            yShape.At(shapeIdx) == bShape.At(shapeIdx)))
-    {
-        const auto dim = yShape.At(shapeIdx);
-        chunkSize *= dim;
-        shapeIdx += 1;
-    }
+//! Calls func(offsets) with offsets of the operands for every index of
+//! dimensions [0, numDims) of the layout in order
+//! Offsets are advanced incrementally instead of being computed from each
+//! index
+template <std::size_t NumOperands, typename Func>
+void ForEachBroadcastIndex(const BroadcastLayout<NumOperands>& layout,
+                           std::size_t numDims, Func func)
+{
+    const auto count = layout.Count(0, numDims);
+    std::vector<unsigned int> index(numDims, 0);
+    std::array<std::size_t, NumOperands> offsets{};
 
-    if (shapeIdx >= yShape.Dim() - minimumRequiredDim)
+    for (std::size_t i = 0; i < count; ++i)
     {
-        func(totalSizeOut, out, A, B, params...);
-        return;
+        func(offsets);
+        for (auto dim = numDims; dim-- > 0;)
+        {
+            for (std::size_t op = 0; op < NumOperands; ++op)
+                offsets[op] += layout.Strides[op][dim];
+            if (++index[dim] < layout.Extents[dim])
+                break;
+            for (std::size_t op = 0; op < NumOperands; ++op)
+                offsets[op] -= layout.Strides[op][dim] * layout.Extents[dim];
+            index[dim] = 0;
+        }
     }
+}
 
-    const auto chunkSizeA = chunkSize * aShape.At(shapeIdx);
-    const auto chunkSizeB = chunkSize * bShape.At(shapeIdx);
-    const auto chunkSizeOut = chunkSize * yShape.At(shapeIdx);
+//! Returns number of innermost dimensions of the layout that can be passed
+//! to a single call of function taking contiguous batch of blocks
+//! It is 1 if every operand is laid out contiguously over the innermost
+//! dimension, and 0 otherwise
+template <std::size_t NumOperands>
+std::size_t ContiguousLeafDims(const BroadcastLayout<NumOperands>& layout)
+{
+    if (layout.NumDims() == 0)
+        return 0;
+    const auto inner = layout.NumDims() - 1;
+    for (std::size_t i = 0; i < NumOperands; ++i)
+        if (!layout.IsFull(i, inner))
+            return 0;
+    return 1;
+}
 
-    const auto strideA = totalSizeA / chunkSizeA;
-    const auto strideB = totalSizeB / chunkSizeB;
-    const auto strideOut = totalSizeOut / chunkSizeOut;
+//! Broadcasts given shape and invokes the function
+//! func(totalSizeOut, out, A, B, C, params...) is called for each batch of
+//! trailing minimumRequiredDim dimensions whose operands are laid out
+//! contiguously, where totalSizeOut is the number of elements of out in the
+//! batch
+//! Shapes must be expanded to the same dimension
+//! Calls are made on single thread in order, so output broadcast along
+//! some dimension is accumulated by the function in order
+template <typename Func, typename... Params>
+void BroadcastWith3Inputs(const Shape& yShape, const Shape& aShape,
+                          const Shape& bShape, const Shape& cShape,
+                          float* out, const float* A, const float* B,
+                          const float* C, unsigned int minimumRequiredDim,
+                          Func func, Params ... params)
+{
+    const auto layout = MakeBroadcastLayout<4>(
+        { &yShape, &aShape, &bShape, &cShape }, minimumRequiredDim);
+    const auto leafDims = ContiguousLeafDims(layout);
+    const auto outerDims = layout.NumDims() - leafDims;
+    const auto leafSize = static_cast<unsigned int>(
+        layout.Count(outerDims, layout.NumDims()) * layout.BlockSizes[0]);
 
-    const auto maxChunkSize =
-        std::max({ chunkSizeOut, chunkSizeA, chunkSizeB });
+    ForEachBroadcastIndex(layout, outerDims,
+                          [&](const std::array<std::size_t, 4>& offsets)
+                          {
+                              func(leafSize, out + offsets[0], A + offsets[1],
+                                   B + offsets[2], C + offsets[3],
+                                   params...);
+                          });
+}
 
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
-    {
-        BroadcastWith2Inputs(yShape, aShape, bShape, strideOut, strideA,
-                             strideB,
-                             out + (chunkIdx % chunkSizeOut) * strideOut,
-                             A + (chunkIdx % chunkSizeA) * strideA,
-                             B + (chunkIdx % chunkSizeB) * strideB,
-                             shapeIdx + 1, minimumRequiredDim, func, params...);
-    }
+//! Same as BroadcastWith3Inputs with 2 inputs
+//! func(totalSizeOut, out, A, B, params...) is called for each batch
+template <typename Func, typename... Params>
+void BroadcastWith2Inputs(const Shape& yShape, const Shape& aShape,
+                          const Shape& bShape, float* out, const float* A,
+                          const float* B, unsigned int minimumRequiredDim,
+                          Func func, Params ... params)
+{
+    const auto layout = MakeBroadcastLayout<3>(
+        { &yShape, &aShape, &bShape }, minimumRequiredDim);
+    const auto leafDims = ContiguousLeafDims(layout);
+    const auto outerDims = layout.NumDims() - leafDims;
+    const auto leafSize = static_cast<unsigned int>(
+        layout.Count(outerDims, layout.NumDims()) * layout.BlockSizes[0]);
+
+    ForEachBroadcastIndex(layout, outerDims,
+                          [&](const std::array<std::size_t, 3>& offsets)
+                          {
+                              func(leafSize, out + offsets[0], A + offsets[1],
+                                   B + offsets[2], params...);
+                          });
 }
 
+//! Same as BroadcastWith2Inputs for back propagation
+//! func(totalSizeOut, da, db, dy, a, b, params...) is called for each batch,
+//! where da and db are broadcast the same way as a and b
 template <typename Func, typename... Params>
 void BroadcastBackwardWith2Inputs(
     const Shape& yShape, const Shape& aShape, const Shape& bShape,
-    unsigned int totalSizeOut, unsigned int totalSizeA, unsigned int totalSizeB,
     const float* dy, float* da, float* db, const float* a, const float* b,
-    unsigned int shapeIdx,
     unsigned int minimumRequiredDim, Func func, Params ... params)
 {
-    if (shapeIdx >= yShape.Dim() - minimumRequiredDim)
-    {
-        func(totalSizeOut, da, db, dy, a, b, params...);
-        return;
-    }
+    const auto layout = MakeBroadcastLayout<3>(
+        { &yShape, &aShape, &bShape }, minimumRequiredDim);
+    const auto leafDims = ContiguousLeafDims(layout);
+    const auto outerDims = layout.NumDims() - leafDims;
+    const auto leafSize = static_cast<unsigned int>(
+        layout.Count(outerDims, layout.NumDims()) * layout.BlockSizes[0]);
+
+    ForEachBroadcastIndex(layout, outerDims,
+                          [&](const std::array<std::size_t, 3>& offsets)
+                          {
+                              func(leafSize, da + offsets[1], db + offsets[2],
+                                   dy + offsets[0], a + offsets[1],
+                                   b + offsets[2], params...);
+                          });
+}
 
-    unsigned int chunkSize = 1;
-    while (shapeIdx < yShape.Dim() - minimumRequiredDim &&
-           (yShape.At(shapeIdx) == aShape.At(shapeIdx) &&
-            yShape.At(shapeIdx) == bShape.At(shapeIdx)))
+//! Innermost span of element-wise broadcast operation that is passed to a
+//! single call of the kernel
+//! Kernels take (totalSize, inputStride, broadcastInputA, broadcastInputB),
+//! where input broadcast along the span repeats its first inputStride
+//! elements
+struct ElementwiseLeaf
+{
+    std::size_t NumDims = 0;
+    unsigned int TotalSize = 1;
+    unsigned int InputStride = 0;
+    bool BroadcastInputA = false;
+    bool BroadcastInputB = false;
+};
+
+//! Selects the leaf of element-wise layout of (y, a, b)
+//! Innermost dimension is passed as a whole, with input broadcast along it
+//! passed as scalar (inputStride of 1)
+//! If both inputs are full along the innermost dimension and only one of
+//! them is broadcast along the next one, it is passed as a row repeated
+//! over the next dimension as well
+inline ElementwiseLeaf SelectElementwiseLeaf(const BroadcastLayout<3>& layout)
+{
+    ElementwiseLeaf leaf;
+    if (layout.NumDims() == 0)
+        return leaf;
+
+    const auto inner = layout.NumDims() - 1;
+    const auto fullA = layout.IsFull(1, inner);
+    const auto fullB = layout.IsFull(2, inner);
+    leaf.NumDims = 1;
+    leaf.TotalSize = layout.Extents[inner];
+
+    if (!fullA || !fullB)
     {
-        const auto dim = yShape.At(shapeIdx);
-        chunkSize *= dim;
-        shapeIdx += 1;
+        leaf.InputStride = 1;
+        leaf.BroadcastInputA = !fullA;
+        leaf.BroadcastInputB = !fullB;
+        return leaf;
     }
 
-    if (shapeIdx >= yShape.Dim() - minimumRequiredDim)
+    if (inner == 0)
+        return leaf;
+    const auto next = inner - 1;
+    if (layout.IsFull(0, next) &&
+        layout.IsFull(1, next) != layout.IsFull(2, next))
     {
-        func(totalSizeOut, da, db, dy, a, b, params...);
-        return;
+        leaf.NumDims = 2;
+        leaf.InputStride = leaf.TotalSize;
+        leaf.TotalSize *= layout.Extents[next];
+        leaf.BroadcastInputA = !layout.IsFull(1, next);
+        leaf.BroadcastInputB = !layout.IsFull(2, next);
     }
+    return leaf;
+}
 
-    const auto chunkSizeA = chunkSize * aShape.At(shapeIdx);
-    const auto chunkSizeB = chunkSize * bShape.At(shapeIdx);
-    const auto chunkSizeOut = chunkSize * yShape.At(shapeIdx);
+//! Broadcasts element-wise operation y = a (op) b over shapes of any
+//! dimension with a single loop over the collapsed outer dimensions
+//! func(totalSize, out, A, B, inputStride, broadcastInputA, broadcastInputB)
+//! is called for each leaf (see SelectElementwiseLeaf)
+//! Shapes must be expanded to the same dimension, and y must not be broadcast
+//! \param parallel : if true, leaves are split over the threads set by
+//! Util::SetNumThreads when each of them is too small to be split by func
+//! itself. Should be false for functions that are not thread safe
+template <typename Func>
+void BroadcastElementwise(const Shape& yShape, const Shape& aShape,
+                          const Shape& bShape, float* out, const float* A,
+                          const float* B, Func func, bool parallel)
+{
+    //! Leaves smaller than this are not split by the host kernels
+    constexpr std::size_t parallelThreshold = 1u << 16;
 
-    const auto strideA = totalSizeA / chunkSizeA;
-    const auto strideB = totalSizeB / chunkSizeB;
-    const auto strideOut = totalSizeOut / chunkSizeOut;
+    const auto layout =
+        MakeBroadcastLayout<3>({ &yShape, &aShape, &bShape }, 0);
+    const auto leaf = SelectElementwiseLeaf(layout);
+    const auto outerDims = layout.NumDims() - leaf.NumDims;
+    const auto numLeaves = layout.Count(0, outerDims);
 
-    const auto maxChunkSize =
-        std::max({ chunkSizeOut, chunkSizeA, chunkSizeB });
+    const auto call = [&](const std::array<std::size_t, 3>& offsets)
+    {
+        func(leaf.TotalSize, out + offsets[0], A + offsets[1],
+             B + offsets[2], leaf.InputStride, leaf.BroadcastInputA,
+             leaf.BroadcastInputB);
+    };
 
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
+    const auto threads = Util::ResolveNumThreads(0);
+    if (parallel && numLeaves > 1 && threads > 1 &&
+        leaf.TotalSize < parallelThreshold &&
+        numLeaves * leaf.TotalSize >= parallelThreshold)
     {
-        BroadcastBackwardWith2Inputs(
-            yShape, aShape, bShape, strideOut, strideA, strideB,
-            dy + (chunkIdx % chunkSizeOut) * strideOut,
-            da + (chunkIdx % chunkSizeA) * strideA,
-            db + (chunkIdx % chunkSizeB) * strideB,
-            a + (chunkIdx % chunkSizeA) * strideA,
-            b + (chunkIdx % chunkSizeB) * strideB, shapeIdx + 1,
-            minimumRequiredDim, func, params...);
+        const auto count = static_cast<long long>(numLeaves);
+#pragma omp parallel for schedule(static) num_threads(threads)
+        for (long long i = 0; i < count; ++i)
+            call(BroadcastOffsets(layout, outerDims,
+                                  static_cast<std::size_t>(i)));
+        return;
     }
+
+    ForEachBroadcastIndex(layout, outerDims, call);
 }
+
+//! Broadcasts back propagation of element-wise operation of (y, a, b)
+//! func(totalSize, da, db, dy, a, b, inputStride, broadcastInputA,
+//! broadcastInputB) is called for each leaf in order on single thread, since
+//! gradients of broadcast inputs are accumulated by several leaves
+template <typename Func>
+void BroadcastElementwiseBackward(const Shape& yShape, const Shape& aShape,
+                                  const Shape& bShape, const float* dy,
+                                  float* da, float* db, const float* a,
+                                  const float* b, Func func)
+{
+    const auto layout =
+        MakeBroadcastLayout<3>({ &yShape, &aShape, &bShape }, 0);
+    const auto leaf = SelectElementwiseLeaf(layout);
+    const auto outerDims = layout.NumDims() - leaf.NumDims;
+
+    ForEachBroadcastIndex(
+        layout, outerDims,
+        [&](const std::array<std::size_t, 3>& offsets)
+        {
+            func(leaf.TotalSize, da + offsets[1], db + offsets[2],
+                 dy + offsets[0], a + offsets[1], b + offsets[2],
+                 leaf.InputStride, leaf.BroadcastInputA,
+                 leaf.BroadcastInputB);
+        });
 }
+} // namespace Sapphire::Compute
 
 #endif
@@ -0,0 +1,541 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_FUSED_OPS_HPP
+#define SAPPHIRE_COMPUTE_FUSED_OPS_HPP
+
+#include <Sapphire/compute/Broadcast.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+//! Lazy elementwise expressions on host
+//!
+//! Chains of elementwise and broadcast operations are recorded as expression
+//! templates instead of being computed one by one, e.g.
+//!     Fused::Mean(y, Fused::Pow(Fused::Input(label) - Fused::Input(x), 2.0f));
+//! computes mean squared error without materializing label - x
+//! Nothing is computed until the expression is materialized by Assign, Sum
+//! or Mean. Then the whole chain is evaluated in one pass over blocks of
+//! BlockSize elements. Intermediate results of a block stay in cache, so
+//! memory is only accessed for the inputs and the output.
+//! Each node computes its block with the vectorized kernels of the selected
+//! instruction set (see KernelRegistry.hpp)
+//!
+//! Operands are broadcast against each other following the same rules as
+//! Compute::Add
+//! Expressions refer to the given TensorData, so they should not outlive
+//! them
+//! Cuda tensors are not supported, and callers should use the operations of
+//! BasicOps.hpp on them
+namespace Sapphire::Compute::Fused
+{
+using namespace TensorUtil;
+
+//! Number of elements evaluated at once by each node of an expression
+constexpr unsigned int BlockSize = 1024;
+
+//! Kernels used while evaluating an expression
+//! Resolved once before evaluation instead of for every block
+struct Context
+{
+    const Dense::Naive::HostKernels* Kernels;
+    const Dense::Naive::MathKernels* Math;
+};
+
+//! Base of every expression node, which is used to tell expressions apart
+//! from other types in operator overloads
+//!
+//! Each node provides
+//!     GetShape() : shape of the result before being broadcast to the output
+//!     Bind(shape) : prepares the node to be evaluated for output of shape
+//!     Block(context, out, scratch, offset, count) : computes elements
+//!         [offset, offset + count) of the result and returns pointer to
+//!         them, which is either out or memory of an input
+//!     Buffers : number of BlockSize buffers the node needs in scratch
+struct Expression
+{
+};
+
+template <typename T>
+constexpr bool IsExpression = std::is_base_of_v<Expression, T>;
+
+//! Returns shape that a and b are broadcast to
+//! Throws std::invalid_argument if they cannot be broadcast
+Shape BroadcastShape(const Shape& a, const Shape& b);
+
+//! Copies elements [offset, offset + count) of data broadcast to the layout
+//! into out
+void GatherBroadcast(float* out, const float* data,
+                     const BroadcastLayout<2>& layout, std::size_t offset,
+                     unsigned int count);
+
+//! Calls func(offset, count) for blocks of BlockSize elements, split over
+//! the threads
+void ForEachBlock(std::size_t totalSize,
+                  const std::function<void(std::size_t, unsigned int)>& func);
+
+//! Resolves kernels of the selected instruction set and precision
+Context MakeContext();
+
+//! Throws std::invalid_argument unless data is a float tensor on host
+void CheckHostTensor(const TensorData& data, const char* caller);
+
+//! Elements of a tensor
+class Leaf : public Expression
+{
+ public:
+    static constexpr unsigned int Buffers = 0;
+
+    explicit Leaf(const TensorData& data);
+
+    [[nodiscard]] const Shape& GetShape() const
+    {
+        return m_shape;
+    }
+
+    void Bind(const Shape& shape);
+
+    const float* Block(const Context&, float* out, float*,
+                       std::size_t offset, unsigned int count) const
+    {
+        if (m_full)
+            return m_data + offset;
+        if (m_layout.NumDims() == 0)
+        {
+            std::fill(out, out + count, m_data[0]);
+            return out;
+        }
+        GatherBroadcast(out, m_data, m_layout, offset, count);
+        return out;
+    }
+
+ private:
+    const float* m_data;
+    Shape m_shape;
+    bool m_full = true;
+    BroadcastLayout<2> m_layout;
+};
+
+//! Result of Op applied elementwise to two expressions
+template <typename Op, typename L, typename R>
+class BinaryNode : public Expression
+{
+ public:
+    //! Left operand is computed into out, and right operand into the first
+    //! buffer of scratch
+    static constexpr unsigned int Buffers =
+        std::max(L::Buffers, R::Buffers + 1);
+
+    BinaryNode(L left, R right)
+        : m_left(std::move(left)),
+          m_right(std::move(right)),
+          m_shape(BroadcastShape(m_left.GetShape(), m_right.GetShape()))
+    {
+    }
+
+    [[nodiscard]] const Shape& GetShape() const
+    {
+        return m_shape;
+    }
+
+    void Bind(const Shape& shape)
+    {
+        m_left.Bind(shape);
+        m_right.Bind(shape);
+    }
+
+    const float* Block(const Context& context, float* out, float* scratch,
+                       std::size_t offset, unsigned int count) const
+    {
+        const auto* a = m_left.Block(context, out, scratch, offset, count);
+        const auto* b = m_right.Block(context, scratch, scratch + BlockSize,
+                                      offset, count);
+        Op::Apply(context, out, a, b, count);
+        return out;
+    }
+
+ private:
+    L m_left;
+    R m_right;
+    Shape m_shape;
+};
+
+//! Result of Op applied elementwise to an expression with a scalar parameter
+template <typename Op, typename E>
+class UnaryNode : public Expression
+{
+ public:
+    static constexpr unsigned int Buffers = E::Buffers;
+
+    explicit UnaryNode(E input, float param = 0.0f)
+        : m_input(std::move(input)),
+          m_param(param)
+    {
+    }
+
+    [[nodiscard]] const Shape& GetShape() const
+    {
+        return m_input.GetShape();
+    }
+
+    void Bind(const Shape& shape)
+    {
+        m_input.Bind(shape);
+    }
+
+    const float* Block(const Context& context, float* out, float* scratch,
+                       std::size_t offset, unsigned int count) const
+    {
+        const auto* in = m_input.Block(context, out, scratch, offset, count);
+        Op::Apply(context, out, in, m_param, count);
+        return out;
+    }
+
+ private:
+    E m_input;
+    float m_param;
+};
+
+//! Operations of the nodes
+//! Each of them computes a block with a single host kernel
+namespace Ops
+{
+struct Add
+{
+    static void Apply(const Context& context, float* out, const float* a,
+                      const float* b, unsigned int count)
+    {
+        context.Kernels->Add(out, a, b, count);
+    }
+};
+
+struct Sub
+{
+    static void Apply(const Context& context, float* out, const float* a,
+                      const float* b, unsigned int count)
+    {
+        context.Kernels->Sub(out, a, b, count);
+    }
+};
+
+struct Mul
+{
+    static void Apply(const Context& context, float* out, const float* a,
+                      const float* b, unsigned int count)
+    {
+        context.Kernels->Dot(out, a, b, count);
+    }
+};
+
+struct Scale
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float factor, unsigned int count)
+    {
+        context.Kernels->Scale(out, in, factor, count);
+    }
+};
+
+struct AddScalar
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float scalar, unsigned int count)
+    {
+        context.Kernels->AddScalar(out, in, scalar, count);
+    }
+};
+
+struct SubScalar
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float scalar, unsigned int count)
+    {
+        context.Kernels->SubScalar(out, in, scalar, count);
+    }
+};
+
+struct ScalarSub
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float scalar, unsigned int count)
+    {
+        context.Kernels->ScalarSub(out, in, scalar, count);
+    }
+};
+
+struct LeakyReLU
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float slope, unsigned int count)
+    {
+        context.Kernels->LeakyReLU(out, in, slope, count);
+    }
+};
+
+//! Square and reciprocal are computed with multiplication and division,
+//! and other exponents with std::pow
+struct Pow
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float exponent, unsigned int count);
+};
+
+//! Operation applying UnaryKernelFunc member of HostKernels
+template <Dense::Naive::UnaryKernelFunc Dense::Naive::HostKernels::*Kernel>
+struct HostUnary
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float, unsigned int count)
+    {
+        (context.Kernels->*Kernel)(out, in, count);
+    }
+};
+
+//! Operation applying UnaryKernelFunc member of MathKernels
+template <Dense::Naive::UnaryKernelFunc Dense::Naive::MathKernels::*Kernel>
+struct MathUnary
+{
+    static void Apply(const Context& context, float* out, const float* in,
+                      float, unsigned int count)
+    {
+        (context.Math->*Kernel)(out, in, count);
+    }
+};
+
+using ReLU = HostUnary<&Dense::Naive::HostKernels::ReLU>;
+using Inverse = HostUnary<&Dense::Naive::HostKernels::Inverse>;
+using Exp = MathUnary<&Dense::Naive::MathKernels::Exp>;
+using Log = MathUnary<&Dense::Naive::MathKernels::Log>;
+using Sin = MathUnary<&Dense::Naive::MathKernels::Sin>;
+using Cos = MathUnary<&Dense::Naive::MathKernels::Cos>;
+using Tanh = MathUnary<&Dense::Naive::MathKernels::Tanh>;
+using Sigmoid = MathUnary<&Dense::Naive::MathKernels::Sigmoid>;
+} // namespace Ops
+
+//! Records tensor as an input of expressions
+inline Leaf Input(const TensorData& data)
+{
+    return Leaf(data);
+}
+
+template <typename L, typename R,
+          std::enable_if_t<IsExpression<L> && IsExpression<R>, int> = 0>
+BinaryNode<Ops::Add, L, R> operator+(L left, R right)
+{
+    return { std::move(left), std::move(right) };
+}
+
+template <typename L, typename R,
+          std::enable_if_t<IsExpression<L> && IsExpression<R>, int> = 0>
+BinaryNode<Ops::Sub, L, R> operator-(L left, R right)
+{
+    return { std::move(left), std::move(right) };
+}
+
+//! Elementwise multiplication
+template <typename L, typename R,
+          std::enable_if_t<IsExpression<L> && IsExpression<R>, int> = 0>
+BinaryNode<Ops::Mul, L, R> operator*(L left, R right)
+{
+    return { std::move(left), std::move(right) };
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Scale, E> operator*(E input, float factor)
+{
+    return UnaryNode<Ops::Scale, E>(std::move(input), factor);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Scale, E> operator*(float factor, E input)
+{
+    return UnaryNode<Ops::Scale, E>(std::move(input), factor);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Scale, E> operator/(E input, float divisor)
+{
+    return UnaryNode<Ops::Scale, E>(std::move(input), 1.0f / divisor);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Scale, E> operator-(E input)
+{
+    return UnaryNode<Ops::Scale, E>(std::move(input), -1.0f);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::AddScalar, E> operator+(E input, float scalar)
+{
+    return UnaryNode<Ops::AddScalar, E>(std::move(input), scalar);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::AddScalar, E> operator+(float scalar, E input)
+{
+    return UnaryNode<Ops::AddScalar, E>(std::move(input), scalar);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::SubScalar, E> operator-(E input, float scalar)
+{
+    return UnaryNode<Ops::SubScalar, E>(std::move(input), scalar);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::ScalarSub, E> operator-(float scalar, E input)
+{
+    return UnaryNode<Ops::ScalarSub, E>(std::move(input), scalar);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Pow, E> Pow(E input, float exponent)
+{
+    return UnaryNode<Ops::Pow, E>(std::move(input), exponent);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::ReLU, E> ReLU(E input)
+{
+    return UnaryNode<Ops::ReLU, E>(std::move(input));
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::LeakyReLU, E> LeakyReLU(E input, float negativeSlope)
+{
+    return UnaryNode<Ops::LeakyReLU, E>(std::move(input), negativeSlope);
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Inverse, E> Inverse(E input)
+{
+    return UnaryNode<Ops::Inverse, E>(std::move(input));
+}
+
+//! Transcendental functions use kernels of the selected precision (see
+//! MathKernel.hpp)
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Exp, E> Exp(E input)
+{
+    return UnaryNode<Ops::Exp, E>(std::move(input));
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Log, E> Log(E input)
+{
+    return UnaryNode<Ops::Log, E>(std::move(input));
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Sin, E> Sin(E input)
+{
+    return UnaryNode<Ops::Sin, E>(std::move(input));
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Cos, E> Cos(E input)
+{
+    return UnaryNode<Ops::Cos, E>(std::move(input));
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Tanh, E> Tanh(E input)
+{
+    return UnaryNode<Ops::Tanh, E>(std::move(input));
+}
+
+template <typename E, std::enable_if_t<IsExpression<E>, int> = 0>
+UnaryNode<Ops::Sigmoid, E> Sigmoid(E input)
+{
+    return UnaryNode<Ops::Sigmoid, E>(std::move(input));
+}
+
+//! Materializes the expression into y
+//! Expression is broadcast to shape of y, and may refer to y itself as long
+//! as y is not broadcast in the expression
+//! Throws std::invalid_argument if y is not on host, or the expression
+//! cannot be broadcast to y
+template <typename Expr, std::enable_if_t<IsExpression<Expr>, int> = 0>
+void Assign(TensorData& y, Expr expr)
+{
+    CheckHostTensor(y, "Compute::Fused::Assign");
+    if (BroadcastShape(y.GetShape(), expr.GetShape()).Size() !=
+        y.GetShape().Size())
+        throw std::invalid_argument(
+            "Compute::Fused::Assign - Expression of shape " +
+            expr.GetShape().ToString() + " cannot be assigned to shape " +
+            y.GetShape().ToString());
+
+    expr.Bind(y.GetShape());
+    const auto context = MakeContext();
+    auto* output = y.HostMutableRawPtr();
+
+    //! Result is computed into a buffer and copied, since nodes may read y
+    //! after other nodes have written their part of the block
+    ForEachBlock(y.Size(), [&](std::size_t offset, unsigned int count)
+    {
+        float buffers[(Expr::Buffers + 1) * BlockSize];
+        const auto* result =
+            expr.Block(context, buffers, buffers + BlockSize, offset, count);
+        if (result != output + offset)
+            std::memcpy(output + offset, result, count * sizeof(float));
+    });
+}
+
+//! Reduces each block of the expression with func(result, count), and
+//! returns sum of the results
+//! Blocks are summed in order regardless of the number of threads
+double ReduceBlocks(std::size_t totalSize,
+                    const std::function<double(std::size_t, unsigned int)>&
+                    func);
+
+//! Sums elements of the block in double precision
+double SumBlock(const float* data, unsigned int count);
+
+//! Materializes sum of every element of the expression into y of single
+//! element
+//! Elements are accumulated in double precision
+template <typename Expr, std::enable_if_t<IsExpression<Expr>, int> = 0>
+void Sum(TensorData& y, Expr expr)
+{
+    CheckHostTensor(y, "Compute::Fused::Sum");
+    if (y.GetShape().Size() != 1)
+        throw std::invalid_argument(
+            "Compute::Fused::Sum - Output should have single element");
+
+    const auto shape = expr.GetShape();
+    expr.Bind(shape);
+    const auto context = MakeContext();
+    const auto sum = ReduceBlocks(
+        shape.Size(), [&](std::size_t offset, unsigned int count)
+        {
+            float buffers[(Expr::Buffers + 1) * BlockSize];
+            return SumBlock(expr.Block(context, buffers, buffers + BlockSize,
+                                       offset, count),
+                            count);
+        });
+    y.HostMutableRawPtr()[0] = static_cast<float>(sum);
+}
+
+//! Materializes mean of every element of the expression into y of single
+//! element
+template <typename Expr, std::enable_if_t<IsExpression<Expr>, int> = 0>
+void Mean(TensorData& y, Expr expr)
+{
+    const auto size = expr.GetShape().Size();
+    Sum(y, std::move(expr));
+    y.HostMutableRawPtr()[0] /= static_cast<float>(size);
+}
+} // namespace Sapphire::Compute::Fused
+
+#endif
@@ -0,0 +1,58 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_HALFOPS_HPP
+#define SAPPHIRE_COMPUTE_HALFOPS_HPP
+
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/tensor/HalfTensorData.hpp>
+
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! Operations on 16-bit tensors are computed on host only
+//! 16-bit operands are converted to fp32 as they are loaded, and results are
+//! accumulated in fp32 (see dense/naive/NaiveHalf.hpp)
+
+//! Performs y = a * op(b) with fp32 a and 16-bit b (e.g. weights)
+//! b is converted while it is packed by the fp32 gemm (see
+//! dense/naive/NaiveGemm.hpp)
+//! \param a : host tensor. Every dimension but the last one is treated as
+//! rows of single (M x K) matrix
+//! \param b : matrix of shape (K x N), or (N x K) if transB is true
+//! \param y : host tensor with M x N elements
+//! Throws std::invalid_argument if shapes of the operands do not match
+void HalfGemm(TensorData& y, const TensorData& a, const HalfTensorData& b,
+              bool transB = false, int numThreads = 0);
+
+//! Performs y = activation(a * op(b) + bias)
+//! Bias and activation are applied by the micro kernel as GemmBiasActivation
+//! \param bias : host vector with as many elements as columns of y
+void HalfGemmBiasActivation(TensorData& y, const TensorData& a,
+                            const HalfTensorData& b, const TensorData& bias,
+                            bool transB = false,
+                            GemmActivation activation = GemmActivation::None,
+                            float negativeSlope = 0.0f, int numThreads = 0);
+
+//! Elementwise operations on tensors of the same type and number of
+//! elements
+//! Each result is computed in fp32 and rounded once when it is stored
+void HalfAdd(HalfTensorData& y, const HalfTensorData& a,
+             const HalfTensorData& b, int numThreads = 0);
+
+void HalfSub(HalfTensorData& y, const HalfTensorData& a,
+             const HalfTensorData& b, int numThreads = 0);
+
+void HalfDot(HalfTensorData& y, const HalfTensorData& a,
+             const HalfTensorData& b, int numThreads = 0);
+
+//! Performs y = x * factor
+void HalfScale(HalfTensorData& y, const HalfTensorData& x, float factor,
+               int numThreads = 0);
+} // namespace Sapphire::Compute
+
+#endif
@@ -13,6 +13,29 @@ namespace Sapphire::Compute
 {
 using namespace TensorUtil;
 void Flatten(TensorData& tensorData);
+
+//! Operations below accept data of any DataType, and are dispatched to
+//! implementations templated on the element types
+//! They are computed on host only, and throw std::invalid_argument if data
+//! is not on host or types and sizes of the operands do not match
+
+//! Converts elements of x to the data type of y, which should have the same
+//! number of elements
+//! Floats are truncated toward zero when converted to integers, and nonzero
+//! values become true when converted to Bool
+void Cast(TensorData& y, const TensorData& x);
+
+//! Gathers rows of x selected by indices as y[i, :] = x[indices[i], :]
+//! x and y are viewed as matrices whose rows are their last dimension
+//! \param indices : Int32, Int8 or UInt8 data with one index for each row of
+//! y. Throws std::out_of_range if an index is not a row of x
+void Gather(TensorData& y, const TensorData& x, const TensorData& indices);
+
+//! Selects y[i] = mask[i] ? a[i] : b[i]
+//! \param mask : Bool data with the same number of elements as y
+//! \param a, b : data of the same data type as y
+void Where(TensorData& y, const TensorData& mask, const TensorData& a,
+           const TensorData& b);
 }
 
 #endif
@@ -8,11 +8,25 @@
 #define Sapphire_INITIALIZE_HPP
 
 #include <Sapphire/tensor/TensorData.hpp>
+#include <cstdint>
 
 namespace Sapphire::Compute::Initialize
 {
+//! Random initializers without seed take new stream of the global seed on
+//! every call (see Util::SetSeed), and ones with seed use the first stream
+//! of the given seed, so they give the same data on every call
+//! Host data is the same for any number of threads. Cuda data is seeded
+//! from the stream as well, but differs from host data
 void Normal(TensorUtil::TensorData& data, float mean, float sd);
 
+void Normal(TensorUtil::TensorData& data, float mean, float sd,
+            std::uint64_t seed);
+
+void Uniform(TensorUtil::TensorData& data, float min, float max);
+
+void Uniform(TensorUtil::TensorData& data, float min, float max,
+             std::uint64_t seed);
+
 void Ones(TensorUtil::TensorData& data);
 
 void Zeros(TensorUtil::TensorData& data);
@@ -21,7 +35,12 @@ void Scalar(TensorUtil::TensorData& data, float value);
 
 void HeNormal(TensorUtil::TensorData& data, int fanIn);
 
+void HeNormal(TensorUtil::TensorData& data, int fanIn, std::uint64_t seed);
+
 void Xavier(TensorUtil::TensorData& data, int fanIn, int fanOut);
+
+void Xavier(TensorUtil::TensorData& data, int fanIn, int fanOut,
+            std::uint64_t seed);
 } // namespace Sapphire::Compute::Initialize
 
 #endif  // Sapphire_INITIALIZE_HPP
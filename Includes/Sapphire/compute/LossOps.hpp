@@ -0,0 +1,38 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_LOSSOPS_HPP
+#define SAPPHIRE_COMPUTE_LOSSOPS_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! Losses over rows of float x (its last dimension), computed on host
+//! Labels are Int32, Int8 or UInt8 data with one class index for each row
+//! of x
+//! Throws std::invalid_argument if data is not on host or shapes do not
+//! match, and std::out_of_range if a label is not a column of x
+
+//! Computes mean over the rows of cross entropy between softmax of the row
+//! and its label, without writing the softmax (see Naive::CrossEntropy)
+//! \param loss : float data of single element
+//! \param logSumExp : float data with one element for each row, which
+//! receives log(sum(exp(x))) of the row for CrossEntropyBackward
+void CrossEntropy(TensorData& loss, TensorData& logSumExp,
+                  const TensorData& x, const TensorData& label);
+
+//! Accumulates gradient of the mean cross entropy,
+//! dy * (softmax(x) - onehot(label)) / rows, to dx
+//! \param dy : float data of single element, gradient of the loss
+void CrossEntropyBackward(TensorData& dx, const TensorData& dy,
+                          const TensorData& x, const TensorData& logSumExp,
+                          const TensorData& label);
+} // namespace Sapphire::Compute
+
+#endif
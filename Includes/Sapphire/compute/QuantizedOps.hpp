@@ -0,0 +1,75 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_QUANTIZEDOPS_HPP
+#define SAPPHIRE_COMPUTE_QUANTIZEDOPS_HPP
+
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/tensor/QuantizedTensorData.hpp>
+
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! Quantized operations are computed on host only
+
+//! Performs y = dequantize(a) * op(dequantize(b)) by int8 gemm with int32
+//! accumulation (see dense/naive/NaiveQuantizedGemm.hpp)
+//! \param a : UInt8 tensor quantized per tensor. Every dimension but the last
+//! one is treated as rows of single (M x K) matrix
+//! \param b : Int8 matrix of shape (K x N), or (N x K) if transB is true,
+//! quantized per tensor or per column of op(b) (output channel). Operand
+//! packed by b.Prepack(transB) is used if there is one
+//! \param y : host tensor with M x N elements
+//! Throws std::invalid_argument if types, quantization or shapes of the
+//! operands do not match
+void QuantizedGemm(TensorData& y, const QuantizedTensorData& a,
+                   const QuantizedTensorData& b, bool transB = false,
+                   int numThreads = 0);
+
+//! Performs y = activation(dequantize(a) * op(dequantize(b)) + bias)
+//! Bias and activation are applied while each int32 output tile is
+//! dequantized, so y is written only once
+//! \param bias : host vector with as many elements as columns of y
+void QuantizedGemmBiasActivation(
+    TensorData& y, const QuantizedTensorData& a, const QuantizedTensorData& b,
+    const TensorData& bias, bool transB = false,
+    GemmActivation activation = GemmActivation::None,
+    float negativeSlope = 0.0f, int numThreads = 0);
+
+//! Same as QuantizedGemmBiasActivation, with result requantized by the params
+//! of y, which should be UInt8 tensor quantized per tensor
+void QuantizedGemmBiasActivation(
+    QuantizedTensorData& y, const QuantizedTensorData& a,
+    const QuantizedTensorData& b, const TensorData& bias, bool transB = false,
+    GemmActivation activation = GemmActivation::None,
+    float negativeSlope = 0.0f, int numThreads = 0);
+
+//! Performs y = conv2d(dequantize(x), dequantize(filter)) with the same
+//! layout and arguments as Conv2DForward, by int8 gemm over patches of x
+//! \param x : UInt8 tensor of shape (*, C, H, W) quantized per tensor
+//! \param filter : Int8 tensor of shape (yC, C, filterRows, filterCols)
+//! quantized per tensor or per output channel (axis 0). Operand packed by
+//! filter.Prepack(true) is used if there is one
+//! \param y : host tensor of shape (*, yC, yH, yW)
+void QuantizedConv2DForward(TensorData& y, const QuantizedTensorData& x,
+                            const QuantizedTensorData& filter, int strideRow,
+                            int strideCol, int dilationRow, int dilationCol,
+                            int rowPadding, int columnPadding,
+                            int numThreads = 0);
+
+//! Same as above, with bias of each output channel added while output tiles
+//! are dequantized
+//! \param bias : host vector of yC elements
+void QuantizedConv2DForward(TensorData& y, const QuantizedTensorData& x,
+                            const QuantizedTensorData& filter,
+                            const TensorData& bias, int strideRow,
+                            int strideCol, int dilationRow, int dilationCol,
+                            int rowPadding, int columnPadding,
+                            int numThreads = 0);
+} // namespace Sapphire::Compute
+
+#endif
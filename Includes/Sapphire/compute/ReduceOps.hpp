@@ -0,0 +1,57 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_REDUCEOPS_HPP
+#define SAPPHIRE_COMPUTE_REDUCEOPS_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+#include <vector>
+
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! Reductions of float x over any set of axes, computed on host
+//! (see NaiveReduce.hpp)
+//! Negative axes count from the last dimension, and empty axes reduce every
+//! dimension
+//! Shape of y decides whether reduced dimensions are kept : it should be
+//! either ReducedShape(x.GetShape(), axes, true) or
+//! ReducedShape(x.GetShape(), axes, false)
+//! Throws std::invalid_argument if data is not on host, an axis is out of
+//! range or y has neither of the shapes
+
+//! Returns shape after reducing axes of shape. Reduced dimensions become 1
+//! if keepDims is true, and are removed otherwise (leaving shape of single
+//! dimension of 1 if every dimension is removed)
+Shape ReducedShape(const Shape& shape, const std::vector<int>& axes,
+                   bool keepDims);
+
+void Sum(TensorData& y, const TensorData& x, const std::vector<int>& axes);
+
+void Mean(TensorData& y, const TensorData& x, const std::vector<int>& axes);
+
+//! Maximum and minimum are NaN if any of reduced elements is NaN
+void Max(TensorData& y, const TensorData& x, const std::vector<int>& axes);
+
+void Min(TensorData& y, const TensorData& x, const std::vector<int>& axes);
+
+//! Writes index along axis of the maximum (or of the first NaN) to Int32 y
+//! First index is taken if there are multiple maximums
+void ArgMax(TensorData& y, const TensorData& x, int axis);
+
+//! Computes variance with sum of squared deviations divided by
+//! (number of reduced elements - correction)
+void Var(TensorData& y, const TensorData& x, const std::vector<int>& axes,
+         unsigned int correction = 0);
+
+//! Accumulates dx += dy / (number of reduced elements), where dy has shape
+//! of y from Mean over the same axes
+void MeanBackward(TensorData& dx, const TensorData& dy,
+                  const std::vector<int>& axes);
+} // namespace Sapphire::Compute
+
+#endif
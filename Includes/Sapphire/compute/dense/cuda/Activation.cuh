@@ -18,6 +18,10 @@ __host__ void LeakyReLU(float* y, const float* x, float a,
 
 __host__ void SoftMax(float* y, const float* x, unsigned int totalSize,
                       unsigned int unitSize);
+
+//! Accumulates gradient of softmax to dx, where y is the output of SoftMax
+__host__ void SoftmaxBack(float* dx, const float* dy, const float* y,
+                          unsigned int totalSize, unsigned int unitSize);
 }
 
 #endif
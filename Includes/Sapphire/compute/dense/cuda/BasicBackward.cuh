@@ -14,8 +14,8 @@ __host__ void DotBackward(unsigned int totalSize, float* da, float* db,
                           unsigned inputStride, bool
                           broadcastInputA, bool broadcastInputB);
 
-__host__ void PowBackward(unsigned int totalSize, float* dx, float* dy,
-                          float* x);
+__host__ void PowBackward(float* dx, const float* dy, const float* x,
+                          float factor, unsigned totalSize);
 
 __host__ void cosBackward(unsigned int totalSize, float* dx, float* dy,
                           float* x);
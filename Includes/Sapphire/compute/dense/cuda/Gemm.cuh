@@ -12,9 +12,13 @@
 
 namespace Sapphire::Compute::Dense::Cuda
 {
+//! Computes out = alpha * op(A) x op(B) + beta * out for every matrix chunk
+//! A is stored as (K x M) if transA is true, and B is stored as (N x K) if
+//! transB is true
 __host__ void Gemm(unsigned int totalSize,
                    float* out, const float* A, const float* B,
                    unsigned int M, unsigned int N, unsigned int K,
+                   bool transA, bool transB, float alpha, float beta,
                    int deviceId);
 
 __host__ void GemmMatrixWiseBroadcast(float* out, const float* A,
@@ -22,7 +26,9 @@ __host__ void GemmMatrixWiseBroadcast(float* out, const float* A,
                                       unsigned int M, unsigned int N,
                                       unsigned int K, unsigned int batchSize,
                                       bool broadcastA,
-                                      bool broadcastB, int deviceId);
+                                      bool broadcastB, bool transA,
+                                      bool transB, float alpha, float beta,
+                                      int deviceId);
 } // namespace Sapphire::Compute::Cuda::Dense
 
 #endif
@@ -8,6 +8,7 @@
 #define SAPPHIRE_COMPUTE_CONV2D_HPP
 
 #include <Sapphire/tensor/TensorData.hpp>
+#include <cstdint>
 
 namespace Sapphire::Compute::Dense::Naive
 {
@@ -18,6 +19,15 @@ void Im2Col(TensorData& inputMatrix, const TensorData& filter,
             int rowPadding, int colPadding, int dilationRow, int dilationCol,
             float pad = 0.0f);
 
+//! Same as Im2Col for uint8 data of quantized tensors
+//! Writes (C * filterRows * filterCols) x (outputRows * outputCols) matrix for
+//! each batch of input with shape of (*, C, H, W)
+//! \param pad : value of the padded elements (zero point of the input)
+void Im2Col(std::uint8_t* inputMatrix, const std::uint8_t* input,
+            const Shape& inputShape, int filterRows, int filterCols,
+            int strideRow, int strideCol, int rowPadding, int colPadding,
+            int dilationRow, int dilationCol, std::uint8_t pad);
+
 void Col2Im(TensorData& input, const TensorData& inputMatrix,
             const TensorData& filter, int strideCol, int strideRow,
             int rowPadding, int colPadding, int dilationRow, int dilationCol);
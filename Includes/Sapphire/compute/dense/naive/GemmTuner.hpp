@@ -0,0 +1,92 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_GEMMTUNER_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_GEMMTUNER_HPP
+
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Host gemm call that block sizes and thread split are tuned for
+struct GemmConfig
+{
+    bool operator==(const GemmConfig& config) const;
+    bool operator!=(const GemmConfig& config) const;
+
+    InstructionSet Isa;
+    unsigned int M;
+    unsigned int N;
+    unsigned int K;
+    unsigned int BatchSize;
+    bool TransA;
+    bool TransB;
+    int NumThreads;
+};
+
+struct GemmConfigHash
+{
+    std::size_t operator()(const GemmConfig& key) const
+    {
+        return std::hash<unsigned int>()(key.M * 31 + key.N) ^
+               std::hash<unsigned int>()(key.K * 31 + key.BatchSize) ^
+               std::hash<int>()(static_cast<int>(key.Isa) * 4 +
+                                key.TransA * 2 + key.TransB) ^
+               std::hash<int>()(key.NumThreads << 8);
+    }
+};
+
+//! Parameters of blocked gemm selected by the tuner
+//! MC must be multiple of MR and NC must be multiple of NR of the kernel
+struct GemmTuning
+{
+    unsigned int MC;
+    unsigned int KC;
+    unsigned int NC;
+    //! If true, each output matrix is split into 2-D tiles over the threads.
+    //! Whole output matrices are distributed over the threads otherwise
+    bool SplitTiles;
+};
+
+//! Enables autotuning of host gemm
+//! If enabled, candidate tunings are timed on the first call with each config
+//! and the fastest one is stored. Disabled by default, in which case stored
+//! tunings (e.g. loaded from the tuning file) are still used
+void SetGemmAutotune(bool enable);
+
+//! Returns true if autotuning of host gemm is enabled
+bool GetGemmAutotune();
+
+//! Finds stored tuning of given config
+//! Tunings in the file given by SAPPHIRE_GEMM_TUNING_FILE environment
+//! variable are loaded on the first call
+//! \return : true if found
+bool FindGemmTuning(const GemmConfig& config, GemmTuning& tuning);
+
+//! Stores tuning of given config, replacing existing one
+//! Tuning is also appended to the file given by SAPPHIRE_GEMM_TUNING_FILE
+//! environment variable if it is set
+void AddGemmTuning(const GemmConfig& config, const GemmTuning& tuning);
+
+//! Removes every stored tuning (tuning file is not modified)
+void ClearGemmTunings();
+
+//! Loads tunings from the file, replacing stored ones with the same config
+//! Each line holds one tuning (see SaveGemmTuningFile)
+//! Lines that cannot be parsed are ignored
+//! \return : false if file cannot be opened
+bool LoadGemmTuningFile(const std::string& path);
+
+//! Writes every stored tuning to the file, one per line as
+//! "isa M N K batchSize transA transB numThreads MC KC NC splitTiles"
+//! Throws std::runtime_error if file cannot be opened
+void SaveGemmTuningFile(const std::string& path);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -7,8 +7,17 @@
 #ifndef Sapphire_NAIVEBASIC_HPP
 #define Sapphire_NAIVEBASIC_HPP
 
+#include <cstdint>
+
 namespace Sapphire::Compute::Dense::Naive
 {
+//! Binary operations compute output[i] = inputA[i % strideA] (op)
+//! inputB[i % strideB], where stride of the input is inputStride if it is
+//! broadcast and totalSize otherwise
+//! Contiguous, scalar (inputStride == 1) and row broadcast inputs are
+//! dispatched to vectorized kernels of currently selected instruction set,
+//! and large arrays are split over threads set by Util::SetNumThreads
+//! Throws std::invalid_argument if input is broadcast with inputStride of 0
 void Add(unsigned int totalSize, float* output, const float* inputA,
          const float* inputB, unsigned int inputStride, bool broadcastInputA,
          bool broadcastInputB);
@@ -21,17 +30,38 @@ void Dot(unsigned int totalSize, float* output, const float* inputA,
          const float* inputB, unsigned int inputStride, bool broadcastInputA,
          bool broadcastInputB);
 
+//! Accumulates da += dy * b and db += dy * a with the same broadcasting as
+//! Dot. Gradient of broadcast input is summed over the rows
+void DotBackward(unsigned int totalSize, float* da, float* db,
+                 const float* dy, const float* a, const float* b,
+                 unsigned int inputStride, bool broadcastInputA,
+                 bool broadcastInputB);
+
 void Scale(float* output, const float* input, float scaleFactor,
            unsigned int totalSize);
 
+//! Transposes each of batchSize matrices of inputRows x inputCols
+//! If broadcast is true, input holds single matrix that is transposed for
+//! every batch
+//! Matrices are split into tiles transposed by the kernel of currently
+//! selected instruction set, and tiles are split over the threads
 void Transpose(float* output, const float* input, unsigned int inputRows,
                unsigned int inputCols,
                unsigned int batchSize,
                bool broadcast);
 
+//! Computes exp(exponent * log(x)) with vectorized kernels for positive
+//! finite x if MathPrecision::Fast is selected, so its relative error grows
+//! with |exponent * log(x)|
 void Pow(float* output, const float* input, float exponent,
          unsigned int totalSize);
 
+//! Accumulates dx += dy * exponent * x^(exponent - 1)
+void PowBackward(float* dx, const float* dy, const float* x, float exponent,
+                 unsigned int totalSize);
+
+//! Transcendental functions use vectorized kernels of currently selected
+//! precision (see MathKernel.hpp)
 void Cos(float* output, const float* input, unsigned int totalSize);
 
 void Sin(float* output, const float* input, unsigned int totalSize);
@@ -48,6 +78,60 @@ void log(float* output, const float* input, unsigned int totalSize);
 
 void log10(float* output, const float* input, unsigned int totalSize);
 
+void Exp(float* output, const float* input, unsigned int totalSize);
+
+void Sigmoid(float* output, const float* input, unsigned int totalSize);
+
+void ArcCos(float* output, const float* input, unsigned int totalSize);
+
+void ArcSin(float* output, const float* input, unsigned int totalSize);
+
+void ArcTan(float* output, const float* input, unsigned int totalSize);
+
+void ArcCosh(float* output, const float* input, unsigned int totalSize);
+
+void ArcSinh(float* output, const float* input, unsigned int totalSize);
+
+void ArcTanh(float* output, const float* input, unsigned int totalSize);
+
+//! Backward functions of transcendental functions accumulate
+//! dx += dy * f'(x) in single pass over the arrays
+void CosBackward(float* dx, const float* dy, const float* x,
+                 unsigned int totalSize);
+
+void SinBackward(float* dx, const float* dy, const float* x,
+                 unsigned int totalSize);
+
+void TanBackward(float* dx, const float* dy, const float* x,
+                 unsigned int totalSize);
+
+void CoshBackward(float* dx, const float* dy, const float* x,
+                  unsigned int totalSize);
+
+void SinhBackward(float* dx, const float* dy, const float* x,
+                  unsigned int totalSize);
+
+void TanhBackward(float* dx, const float* dy, const float* x,
+                  unsigned int totalSize);
+
+void ArcCosBackward(float* dx, const float* dy, const float* x,
+                    unsigned int totalSize);
+
+void ArcSinBackward(float* dx, const float* dy, const float* x,
+                    unsigned int totalSize);
+
+void ArcTanBackward(float* dx, const float* dy, const float* x,
+                    unsigned int totalSize);
+
+void ArcCoshBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize);
+
+void ArcSinhBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize);
+
+void ArcTanhBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize);
+
 void ReLU(float* output, const float* input, unsigned int totalSize);
 
 void ReLUBackward(float* dx, const float* dy, const float* x,
@@ -56,23 +140,39 @@ void ReLUBackward(float* dx, const float* dy, const float* x,
 void LeakyReLU(float* output, const float* input, float a,
                unsigned int totalSize);
 
-void LeakyReLUBackward(float* output, const float* input, float a,
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
                        unsigned int totalSize);
 
 void Inverse(float* output, const float* input, unsigned int totalSize);
 
-void Mean(float* y, const float* x,
-          unsigned ySize, unsigned int unitSize, unsigned stride);
-
-void MeanBackward(float* dx, const float* dy,
-                  unsigned int ySize, unsigned int unitSize,
-                  unsigned int stride);
+//! Accumulates dx -= dy / x^2
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize);
 
+//! Computes softmax over each row of unitSize elements
+//! Maximum and sum of exponentials are computed in single pass over the row
 void Softmax(float* output, const float* input, unsigned int totalSize,
              unsigned int unitSize);
 
-void SoftmaxBackward(float* dx, const float* dy, const float* x,
+//! Accumulates dx += y * (dy - sum(dy * y)) for each row, where y is the
+//! output of Softmax
+void SoftmaxBackward(float* dx, const float* dy, const float* y,
                      unsigned int totalSize, unsigned int unitSize);
+
+//! Writes log(sum(exp(x))) of each row to logSumExp, and returns sum over
+//! the rows of logSumExp - x[label] (negative log likelihood of the label)
+//! Rows are read once in blocks as in Softmax, and exponentials are kept in
+//! a buffer of single block, so probabilities are never written
+//! Each label should be below unitSize
+double CrossEntropy(float* logSumExp, const float* x,
+                    const std::int32_t* label, unsigned int totalSize,
+                    unsigned int unitSize);
+
+//! Accumulates dx += scale * (exp(x - logSumExp) - onehot(label)) for each
+//! row, where logSumExp is written by CrossEntropy
+void CrossEntropyBackward(float* dx, const float* x, const float* logSumExp,
+                          const std::int32_t* label, float scale,
+                          unsigned int totalSize, unsigned int unitSize);
 } // namespace Sapphire::Compute::Naive::Dense
 
 #endif  // Sapphire_NAIVEBASIC_HPP
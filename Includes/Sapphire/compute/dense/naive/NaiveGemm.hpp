@@ -7,11 +7,80 @@
 #ifndef Sapphire_COMPUTE_NAIVEGEMM_HPP
 #define Sapphire_COMPUTE_NAIVEGEMM_HPP
 
+#include <cstdint>
+
 namespace Sapphire::Compute::Dense::Naive
 {
+//! Computes out = alpha * op(A) x op(B) + beta * out for every
+//! (M x K) x (K x N) matrix chunk
+//! totalSize is the total number of elements in out, and chunks are laid out
+//! contiguously with strides (M x K), (K x N) and (M x N) respectively
+//! op(X) is X itself, or transpose of X if corresponding flag is set
+//! (A is stored as (K x M) if transA is true, and B is stored as (N x K) if
+//! transB is true). Transposed operands are read in place
+//! If beta is zero, out is not read, so it does not have to be initialized
+//! Operands are packed into cache sized blocks and computed by register tiled
+//! micro kernel (see kernels/GemmKernel.hpp)
+//! Work is split over chunks if there are enough of them to keep all threads
+//! busy, or over 2-D tiles of each output matrix otherwise
+//! \param numThreads : number of threads to use. If 0, global setting from
+//! Util::SetNumThreads is used
+//! \param cacheB : if true, packed B is kept in the cache and reused by later
+//! calls with the same B (see PackedOperandCache.hpp). Only used if there is
+//! single chunk of B. Cache must be invalidated when B is modified
 void Gemm(unsigned int totalSize, float* out, const float* A, const float* B,
-          unsigned int M, unsigned int N,
-          unsigned int K);
+          unsigned int M, unsigned int N, unsigned int K, bool transA = false,
+          bool transB = false, float alpha = 1.0f, float beta = 1.0f,
+          int numThreads = 0, bool cacheB = false);
+
+//! Computes out = act(op(A) x op(B) + bias) for every (M x K) x (K x N) matrix
+//! chunk, with the same layout as Gemm
+//! act(x) is x > 0 ? x : negativeSlope * x if activation is true (ReLU if
+//! negativeSlope is zero), identity otherwise
+//! Bias and activation are applied by the micro kernel while each output tile
+//! is still in registers, so out is written only once and is not read
+//! \param bias : vector of N elements added to every row. Not added if nullptr
+void GemmBiasActivation(unsigned int totalSize, float* out, const float* A,
+                        const float* B, const float* bias, unsigned int M,
+                        unsigned int N, unsigned int K, bool transA,
+                        bool transB, bool activation, float negativeSlope,
+                        int numThreads = 0, bool cacheB = false);
+
+//! Same as Gemm, for vector-matrix products where M or N is 1
+//! These are bound by memory bandwidth, so the matrix operand is streamed
+//! exactly once by gemv kernel (see kernels/GemvKernel.hpp) instead of being
+//! packed, and its rows or columns are split over the threads
+//! \param cacheB : ignored, since nothing is packed
+void Gemv(unsigned int totalSize, float* out, const float* A, const float* B,
+          unsigned int M, unsigned int N, unsigned int K, bool transA = false,
+          bool transB = false, float alpha = 1.0f, float beta = 1.0f,
+          int numThreads = 0, bool cacheB = false);
+
+//! Same as GemmBiasActivation, for vector-matrix products where M or N is 1
+//! Bias and activation are applied to the output vector after it is computed
+void GemvBiasActivation(unsigned int totalSize, float* out, const float* A,
+                        const float* B, const float* bias, unsigned int M,
+                        unsigned int N, unsigned int K, bool transA,
+                        bool transB, bool activation, float negativeSlope,
+                        int numThreads = 0, bool cacheB = false);
+//! Same as Gemm, with B stored as 16-bit floats (fp16 if bfloat16 is false,
+//! bf16 otherwise) as raw bits
+//! B is converted to fp32 while it is packed (see kernels/HalfKernel.hpp),
+//! and products are accumulated in fp32 by the same micro kernel as Gemm
+//! Result differs from Gemm on fp32 B only by rounding of B
+void HalfGemm(unsigned int totalSize, float* out, const float* A,
+              const std::uint16_t* B, bool bfloat16, unsigned int M,
+              unsigned int N, unsigned int K, bool transA = false,
+              bool transB = false, float alpha = 1.0f, float beta = 1.0f,
+              int numThreads = 0);
+
+//! Same as GemmBiasActivation, with B stored as 16-bit floats like HalfGemm
+void HalfGemmBiasActivation(unsigned int totalSize, float* out,
+                            const float* A, const std::uint16_t* B,
+                            bool bfloat16, const float* bias, unsigned int M,
+                            unsigned int N, unsigned int K, bool transA,
+                            bool transB, bool activation, float negativeSlope,
+                            int numThreads = 0);
 } // namespace Sapphire::Compute::Naive::Dense
 
 #endif
@@ -0,0 +1,48 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_NAIVEHALF_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_NAIVEHALF_HPP
+
+#include <cstdint>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Operations on arrays of 16-bit floats stored as raw bits
+//! Arrays are fp16 if bfloat16 is false, and bf16 otherwise
+//! Conversions use kernels of currently selected instruction set (see
+//! kernels/HalfKernel.hpp) and round to nearest even
+//! \param numThreads : number of threads to use. If 0, global setting from
+//! Util::SetNumThreads is used
+
+void HalfToFloat(unsigned int totalSize, float* output,
+                 const std::uint16_t* input, bool bfloat16,
+                 int numThreads = 0);
+
+void FloatToHalf(unsigned int totalSize, std::uint16_t* output,
+                 const float* input, bool bfloat16, int numThreads = 0);
+
+//! Elementwise operations convert pieces of inputs to fp32 that fit in L1
+//! cache, compute them with the fp32 kernels and convert the result back, so
+//! each element is rounded only once
+void HalfAdd(unsigned int totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             bool bfloat16, int numThreads = 0);
+
+void HalfSub(unsigned int totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             bool bfloat16, int numThreads = 0);
+
+void HalfDot(unsigned int totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             bool bfloat16, int numThreads = 0);
+
+void HalfScale(unsigned int totalSize, std::uint16_t* output,
+               const std::uint16_t* input, float scaleFactor, bool bfloat16,
+               int numThreads = 0);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -6,14 +6,22 @@
 
 #ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_INITIALIZE_HPP
 #define SAPPHIRE_COMPUTE_DENSE_NAIVE_INITIALIZE_HPP
+#include <Sapphire/util/Random.hpp>
 #include <Sapphire/util/Shape.hpp>
 
 
 namespace Sapphire::Compute::Dense::Naive
 {
-void Normal(float* data, float mean, float sd, const Shape& shape);
+//! Random initializers take element i from group i / 4 of stream (see
+//! Util::RandomStream), so data is the same for any number of threads
+//! Normal samples are generated by Box-Muller transform, with logarithms
+//! and trigonometric functions computed by vectorized math kernels
+void Normal(float* data, float mean, float sd, const Shape& shape,
+            const Util::RandomStream& stream);
 
-void Uniform(float* data, float min, float max, const Shape& shape);
+//! Samples are uniform between min and max with 24 bits of randomness
+void Uniform(float* data, float min, float max, const Shape& shape,
+             const Util::RandomStream& stream);
 
 void Scalar(float* data, float value, const Shape& shape);
 } // namespace Sapphire::Compute::Naive
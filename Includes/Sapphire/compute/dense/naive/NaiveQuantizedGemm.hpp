@@ -0,0 +1,75 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_NAIVEQUANTIZEDGEMM_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_NAIVEQUANTIZEDGEMM_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! (K x N) int8 operand of quantized gemm packed into slivers read by the
+//! int8 micro kernel, with sum of each column
+//! Operands that do not change between calls (e.g. weights) can be packed
+//! once and passed to every call
+struct PackedInt8Operand
+{
+    //! Layout of the kernel the operand was packed for
+    unsigned int NR = 0;
+    unsigned int KGroup = 0;
+    unsigned int K = 0;
+    unsigned int N = 0;
+    std::vector<std::int8_t> Data;
+    std::vector<std::int32_t> ColumnSums;
+};
+
+//! Packs B for the int8 kernel of currently selected instruction set
+//! \param B : (K x N) matrix, or (N x K) matrix if transB is true
+PackedInt8Operand PackInt8Operand(const std::int8_t* B, unsigned int K,
+                                  unsigned int N, bool transB,
+                                  int numThreads = 0);
+
+//! Returns true if packed was packed for the int8 kernel of currently
+//! selected instruction set (see SetInstructionSet)
+bool IsPackedForCurrentKernel(const PackedInt8Operand& packed);
+
+//! Computes (M x N) out = act(dequantize(op(A) x B) + bias) for uint8 op(A)
+//! quantized per tensor and int8 B quantized per column (output channel),
+//! where real value of each operand is scale * (quantized value - zeroPoint)
+//! Products are accumulated exactly in int32 by int8 micro kernel (see
+//! kernels/Int8GemmKernel.hpp), and zero points are subtracted from the sums
+//! afterwards using row sums of A and column sums of B
+//! act(x) is x > 0 ? x : negativeSlope * x if activation is true, identity
+//! otherwise
+//! \param A : (M x K) matrix, or (K x M) matrix if transA is true
+//! \param transOut : if true, out is written as (N x M) matrix
+//! \param B : packed by PackInt8Operand. Repacked on this call if it was
+//! packed for another instruction set
+//! \param scaleB, zeroPointB : N elements, one for each column of B
+//! \param bias : vector of N elements added to every row. Not added if nullptr
+//! \param numThreads : number of threads to use. If 0, global setting from
+//! Util::SetNumThreads is used
+void QuantizedGemm(float* out, const std::uint8_t* A,
+                   const PackedInt8Operand& B, unsigned int M, bool transA,
+                   bool transOut, float scaleA, std::int32_t zeroPointA,
+                   const float* scaleB, const std::int32_t* zeroPointB,
+                   const float* bias, bool activation, float negativeSlope,
+                   int numThreads = 0);
+
+//! Same as QuantizedGemm, with result requantized to uint8 as
+//! saturate(round(x / scaleOut) + zeroPointOut)
+void QuantizedGemmRequantize(std::uint8_t* out, const std::uint8_t* A,
+                             const PackedInt8Operand& B, unsigned int M,
+                             bool transA, bool transOut, float scaleA,
+                             std::int32_t zeroPointA, const float* scaleB,
+                             const std::int32_t* zeroPointB,
+                             const float* bias, bool activation,
+                             float negativeSlope, float scaleOut,
+                             std::int32_t zeroPointOut, int numThreads = 0);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,77 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_NAIVEREDUCE_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_NAIVEREDUCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Dimensions of contiguous x split into kept and reduced ones
+//! Dimensions of size 1 are dropped, and adjacent dimensions of the same
+//! kind are merged, so any reduction becomes one of
+//! (a) innermost dimension is reduced : each output reduces rows of
+//!     InnerExtent contiguous elements
+//! (b) innermost dimension is kept : each group of InnerExtent outputs
+//!     accumulates rows of InnerExtent contiguous elements
+//! Outputs are ordered as kept dimensions of x
+struct ReduceLayout
+{
+    //! Extents and strides (in elements of x) of merged dimensions, outermost
+    //! first. Innermost dimension is excluded from its kind
+    std::vector<std::size_t> KeptExtents;
+    std::vector<std::size_t> KeptStrides;
+    std::vector<std::size_t> ReducedExtents;
+    std::vector<std::size_t> ReducedStrides;
+
+    std::size_t InnerExtent = 1;
+    bool InnerReduced = true;
+
+    //! Number of outputs, and number of elements reduced into each of them
+    std::size_t OutputSize = 1;
+    std::size_t ReduceSize = 1;
+};
+
+//! \param shape : shape of x
+//! \param reduced : whether each dimension of shape is reduced
+ReduceLayout MakeReduceLayout(const std::vector<int>& shape,
+                              const std::vector<bool>& reduced);
+
+//! Reductions write every output, so y does not have to be initialized
+//! Outputs are split over threads, and reduced elements as well if there are
+//! few outputs. Splits do not depend on number of threads, so results are
+//! the same for any number of threads
+//! Innermost rows are summed in float blocks accumulated in double, and rows
+//! accumulated into columns are summed with compensation (see
+//! ReduceKernel.hpp)
+void Sum(float* y, const float* x, const ReduceLayout& layout);
+
+void Mean(float* y, const float* x, const ReduceLayout& layout);
+
+//! Maximum and minimum are NaN if any of reduced elements is NaN
+void Max(float* y, const float* x, const ReduceLayout& layout);
+
+void Min(float* y, const float* x, const ReduceLayout& layout);
+
+//! Writes index of the maximum in reduced dimensions (flattened in order of
+//! x), or index of the first NaN if there is any
+//! First index is taken if there are multiple maximums
+void ArgMax(std::int32_t* y, const float* x, const ReduceLayout& layout);
+
+//! Computes sum of (x - mean)^2 divided by (ReduceSize - correction)
+//! Result is NaN if ReduceSize <= correction
+void Variance(float* y, const float* x, const ReduceLayout& layout,
+              unsigned int correction);
+
+//! Accumulates dx += dy / ReduceSize, broadcasting dy over reduced
+//! dimensions of dx
+void MeanBackward(float* dx, const float* dy, const ReduceLayout& layout);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
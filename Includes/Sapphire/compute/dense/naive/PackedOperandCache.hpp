@@ -0,0 +1,62 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_PACKEDOPERANDCACHE_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_PACKEDOPERANDCACHE_HPP
+
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! (K x N) operand of gemm packed into the layout read by the micro kernel
+//! Gemm packs B into KC x NC panels of NR wide slivers on every call.
+//! Operands that do not change between calls (e.g. weights) are packed once
+//! into the same panels, which are laid out one after another
+struct PackedOperand
+{
+    InstructionSet Isa;
+    unsigned int KC;
+    unsigned int NC;
+    unsigned int K;
+    unsigned int N;
+    bool Transposed;
+    std::vector<float> Data;
+
+    //! Returns sliver of the panel starting at row pc and column col
+    //! \param pc : multiple of kernel.KC
+    //! \param col : multiple of kernel.NR. Panel containing col must not end
+    //! before the columns read from returned sliver
+    [[nodiscard]] const float* Sliver(const GemmKernelInfo& kernel,
+                                      unsigned int pc,
+                                      unsigned int col) const;
+};
+
+//! Returns B packed for given kernel
+//! Packed operand is cached with B as the key, and is packed again only if it
+//! was invalidated or was packed with different kernel, block sizes or shape
+//! B may point inside a larger buffer (e.g. one matrix of batched weights),
+//! and caller must invalidate the range of the buffer whenever it is modified
+//! \param kernel : kernel of given instruction set, with possibly tuned
+//! block sizes
+//! \param B : (K x N) matrix, or (N x K) matrix if transB is true
+std::shared_ptr<const PackedOperand> GetPackedOperand(
+    const GemmKernelInfo& kernel, InstructionSet isa, const float* B,
+    unsigned int K, unsigned int N, bool transB);
+
+//! Removes every packed operand whose (K x N) source overlaps with
+//! [data, data + byteSize) from the cache
+//! Returns without locking if nothing is cached, so it is cheap enough to be
+//! called on every mutable access of preserved tensors
+void InvalidatePackedOperand(const void* data, std::size_t byteSize);
+
+//! Removes every packed operand from the cache
+void ClearPackedOperands();
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
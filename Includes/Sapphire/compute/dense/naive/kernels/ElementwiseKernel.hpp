@@ -0,0 +1,143 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_ELEMENTWISEKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_ELEMENTWISEKERNEL_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Computes out[i] = a[i] (op) b[i] on contiguous arrays of size
+using BinaryKernelFunc = void (*)(float* out, const float* a, const float* b,
+                                  unsigned int size);
+
+//! Computes out[i] = in[i] * factor on contiguous arrays of size
+using ScaleKernelFunc = void (*)(float* out, const float* in, float factor,
+                                 unsigned int size);
+
+//! Computes out[i] = in[i] (op) scalar on contiguous arrays of size
+//! Used when one operand of binary operation is broadcast from single element
+using ScalarKernelFunc = void (*)(float* out, const float* in, float scalar,
+                                  unsigned int size);
+
+//! Computes out[i] = f(in[i]) on contiguous arrays of size
+using UnaryKernelFunc = void (*)(float* out, const float* in,
+                                 unsigned int size);
+
+//! Computes dx[i] from dy[i] and forward input x[i] on contiguous arrays of
+//! size
+using BackwardKernelFunc = void (*)(float* dx, const float* dy, const float* x,
+                                    unsigned int size);
+
+//! Same as BackwardKernelFunc with additional parameter of the operation
+using ParamBackwardKernelFunc = void (*)(float* dx, const float* dy,
+                                         const float* x, float param,
+                                         unsigned int size);
+
+//! Copies src[i * srcStride] into contiguous dst[i] for i in [0, count)
+using GatherKernelFunc = void (*)(float* dst, const float* src,
+                                  unsigned int count, unsigned int srcStride);
+
+//! Transposes block of rows x cols elements of in into out, as
+//! out[j * outStride + i] = in[i * inStride + j], where strides are distances
+//! between the rows. Square sub-blocks are transposed in registers
+using TransposeKernelFunc = void (*)(float* out, const float* in,
+                                     unsigned int rows, unsigned int cols,
+                                     unsigned int inStride,
+                                     unsigned int outStride);
+
+//! Elementwise kernels for each instruction set
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags (see KernelRegistry.hpp)
+namespace Sse
+{
+void Add(float* out, const float* a, const float* b, unsigned int size);
+void Sub(float* out, const float* a, const float* b, unsigned int size);
+void Dot(float* out, const float* a, const float* b, unsigned int size);
+//! out[i] += a[i] * b[i]
+void MulAdd(float* out, const float* a, const float* b, unsigned int size);
+void Scale(float* out, const float* in, float factor, unsigned int size);
+void AddScalar(float* out, const float* in, float scalar, unsigned int size);
+//! out[i] = in[i] - scalar
+void SubScalar(float* out, const float* in, float scalar, unsigned int size);
+//! out[i] = scalar - in[i]
+void ScalarSub(float* out, const float* in, float scalar, unsigned int size);
+void Inverse(float* out, const float* in, unsigned int size);
+void ReLU(float* out, const float* in, unsigned int size);
+void LeakyReLU(float* out, const float* in, float a, unsigned int size);
+//! dx[i] = x[i] > 0 ? dy[i] : 0
+void ReLUBackward(float* dx, const float* dy, const float* x,
+                  unsigned int size);
+//! dx[i] = x[i] > 0 ? dy[i] : a * dy[i]
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
+                       unsigned int size);
+//! dx[i] -= dy[i] / (x[i] * x[i])
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int size);
+void Gather(float* dst, const float* src, unsigned int count,
+            unsigned int srcStride);
+void Transpose(float* out, const float* in, unsigned int rows,
+               unsigned int cols, unsigned int inStride,
+               unsigned int outStride);
+} // namespace Sse
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+void Add(float* out, const float* a, const float* b, unsigned int size);
+void Sub(float* out, const float* a, const float* b, unsigned int size);
+void Dot(float* out, const float* a, const float* b, unsigned int size);
+void MulAdd(float* out, const float* a, const float* b, unsigned int size);
+void Scale(float* out, const float* in, float factor, unsigned int size);
+void AddScalar(float* out, const float* in, float scalar, unsigned int size);
+void SubScalar(float* out, const float* in, float scalar, unsigned int size);
+void ScalarSub(float* out, const float* in, float scalar, unsigned int size);
+void Inverse(float* out, const float* in, unsigned int size);
+void ReLU(float* out, const float* in, unsigned int size);
+void LeakyReLU(float* out, const float* in, float a, unsigned int size);
+void ReLUBackward(float* dx, const float* dy, const float* x,
+                  unsigned int size);
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
+                       unsigned int size);
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int size);
+void Gather(float* dst, const float* src, unsigned int count,
+            unsigned int srcStride);
+void Transpose(float* out, const float* in, unsigned int rows,
+               unsigned int cols, unsigned int inStride,
+               unsigned int outStride);
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+void Add(float* out, const float* a, const float* b, unsigned int size);
+void Sub(float* out, const float* a, const float* b, unsigned int size);
+void Dot(float* out, const float* a, const float* b, unsigned int size);
+void MulAdd(float* out, const float* a, const float* b, unsigned int size);
+void Scale(float* out, const float* in, float factor, unsigned int size);
+void AddScalar(float* out, const float* in, float scalar, unsigned int size);
+void SubScalar(float* out, const float* in, float scalar, unsigned int size);
+void ScalarSub(float* out, const float* in, float scalar, unsigned int size);
+void Inverse(float* out, const float* in, unsigned int size);
+void ReLU(float* out, const float* in, unsigned int size);
+void LeakyReLU(float* out, const float* in, float a, unsigned int size);
+void ReLUBackward(float* dx, const float* dy, const float* x,
+                  unsigned int size);
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
+                       unsigned int size);
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int size);
+void Gather(float* dst, const float* src, unsigned int count,
+            unsigned int srcStride);
+void Transpose(float* out, const float* in, unsigned int rows,
+               unsigned int cols, unsigned int inStride,
+               unsigned int outStride);
+} // namespace Avx512
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,146 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_GEMMKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_GEMMKERNEL_HPP
+
+#include <Sapphire/compute/dense/naive/kernels/HalfKernel.hpp>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Operations applied to the output tile while it is still in registers,
+//! after the last block of K has been accumulated
+//! C = act(C + bias), where act(x) = x > 0 ? x : NegativeSlope * x
+struct GemmEpilogue
+{
+    //! Bias of the first column of the tile, added to every row
+    //! Not added if nullptr
+    const float* Bias = nullptr;
+    //! ReLU if NegativeSlope is zero, LeakyReLU otherwise
+    bool Activation = false;
+    float NegativeSlope = 0.0f;
+};
+
+//! Computes C = alpha * (packedA x packedB) + beta * C on full (MR x NR) tile
+//! of C
+//! \param kc : depth of the packed slivers
+//! \param packedA : sliver packed by PackA
+//! \param packedB : sliver packed by PackB
+//! \param C : pointer to the first element of the output tile
+//! \param ldc : row stride of C
+//! \param beta : C is not read if beta is zero
+//! \param epilogue : applied to the result before it is stored if not nullptr
+using GemmMicroKernelFunc = void (*)(unsigned int kc, const float* packedA,
+                                     const float* packedB, float* C,
+                                     unsigned int ldc, float alpha,
+                                     float beta,
+                                     const GemmEpilogue* epilogue);
+
+//! Describes register tile and cache block sizes of the micro kernel
+//! MR x KC sliver of packed A and KC x NR sliver of packed B should stay in L1
+//! MC x KC block of packed A should stay in L2
+//! KC x NC panel of packed B should stay in L3
+//! MC must be multiple of MR, NC must be multiple of NR
+struct GemmKernelInfo
+{
+    unsigned int MR;
+    unsigned int NR;
+    unsigned int MC;
+    unsigned int KC;
+    unsigned int NC;
+    GemmMicroKernelFunc MicroKernel;
+};
+
+//! Largest register tile among all instruction sets
+constexpr unsigned int GemmMaxTileSize = 14 * 32;
+
+//! Packs (mc x kc) block of matrix A into slivers of mr rows
+//! Each sliver is stored in column-major order (kc x mr)
+//! Rows exceeding mc are padded with zeros
+//! \param packedA : destination buffer with at least
+//! ceil(mc / mr) * mr * kc elements
+//! \param A : pointer to the first element of the block
+//! \param rowStride : distance between A(i, k) and A(i + 1, k)
+//! \param colStride : distance between A(i, k) and A(i, k + 1)
+//! (rowStride = lda, colStride = 1 for row-major A, and the opposite for
+//! transposed A)
+void PackA(float* packedA, const float* A, unsigned int rowStride,
+           unsigned int colStride, unsigned int mc, unsigned int kc,
+           unsigned int mr);
+
+//! Packs (kc x nc) block of matrix B into slivers of nr columns
+//! Each sliver is stored in row-major order (kc x nr)
+//! Columns exceeding nc are padded with zeros
+//! \param packedB : destination buffer with at least
+//! ceil(nc / nr) * nr * kc elements
+//! \param B : pointer to the first element of the block
+//! \param rowStride : distance between B(k, j) and B(k + 1, j)
+//! \param colStride : distance between B(k, j) and B(k, j + 1)
+void PackB(float* packedB, const float* B, unsigned int rowStride,
+           unsigned int colStride, unsigned int kc, unsigned int nc,
+           unsigned int nr);
+
+//! Same as PackB, for B stored as 16-bit floats
+//! Elements are converted to fp32 by toFloat while they are packed, so the
+//! micro kernel reads and accumulates fp32 as usual
+//! B should be stored either row-major (colStride = 1) or transposed
+//! (rowStride = 1)
+void PackHalfB(float* packedB, const std::uint16_t* B, unsigned int rowStride,
+               unsigned int colStride, unsigned int kc, unsigned int nc,
+               unsigned int nr, HalfToFloatKernelFunc toFloat);
+
+//! Computes C = alpha * (packedA x packedB) + beta * C on (mr x nr) tile of C
+//! using given kernel
+//! mr and nr can be smaller than kernel.MR and kernel.NR on the edges of the
+//! matrix. epilogue should be given only with the last block of K
+void GemmMicroKernel(const GemmKernelInfo& kernel, unsigned int kc,
+                     const float* packedA, const float* packedB, float* C,
+                     unsigned int ldc, unsigned int mr, unsigned int nr,
+                     float alpha, float beta,
+                     const GemmEpilogue* epilogue = nullptr);
+
+//! Micro kernels for each instruction set
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags, and should be called only if current cpu
+//! supports it (see KernelRegistry.hpp)
+namespace Sse
+{
+constexpr unsigned int GemmMR = 6;
+constexpr unsigned int GemmNR = 8;
+
+void GemmMicroKernel(unsigned int kc, const float* packedA,
+                     const float* packedB, float* C, unsigned int ldc,
+                     float alpha, float beta, const GemmEpilogue* epilogue);
+} // namespace Sse
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+//! 6 x 16 uses 12 ymm accumulators, 2 for B and 1 for broadcasting A
+constexpr unsigned int GemmMR = 6;
+constexpr unsigned int GemmNR = 16;
+
+void GemmMicroKernel(unsigned int kc, const float* packedA,
+                     const float* packedB, float* C, unsigned int ldc,
+                     float alpha, float beta, const GemmEpilogue* epilogue);
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+//! 14 x 32 uses 28 zmm accumulators, 2 for B and 1 for broadcasting A
+constexpr unsigned int GemmMR = 14;
+constexpr unsigned int GemmNR = 32;
+
+void GemmMicroKernel(unsigned int kc, const float* packedA,
+                     const float* packedB, float* C, unsigned int ldc,
+                     float alpha, float beta, const GemmEpilogue* epilogue);
+} // namespace Avx512
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,61 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_GEMVKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_GEMVKERNEL_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Computes y = alpha * (x x B) + beta * y for vector x of k elements and
+//! (k x n) matrix B
+//! Every element of B is loaded exactly once, and y is written once
+//! \param ldb : distance between B(p, j) and B(p + 1, j) for Gemv, or between
+//! B(p, j) and B(p, j + 1) for GemvTransposed (B stored as (n x k))
+//! \param beta : y is not read if beta is zero
+using GemvKernelFunc = void (*)(unsigned int k, unsigned int n,
+                                const float* x, const float* B,
+                                unsigned int ldb, float* y, float alpha,
+                                float beta);
+
+//! Gemv kernels for each instruction set
+//! Gemv streams rows of B and keeps a block of y in registers, while
+//! GemvTransposed computes dot products of x with several rows of stored B at
+//! once so that each load of x is shared between them
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags (see KernelRegistry.hpp)
+namespace Sse
+{
+void Gemv(unsigned int k, unsigned int n, const float* x, const float* B,
+          unsigned int ldb, float* y, float alpha, float beta);
+void GemvTransposed(unsigned int k, unsigned int n, const float* x,
+                    const float* B, unsigned int ldb, float* y, float alpha,
+                    float beta);
+} // namespace Sse
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+void Gemv(unsigned int k, unsigned int n, const float* x, const float* B,
+          unsigned int ldb, float* y, float alpha, float beta);
+void GemvTransposed(unsigned int k, unsigned int n, const float* x,
+                    const float* B, unsigned int ldb, float* y, float alpha,
+                    float beta);
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+void Gemv(unsigned int k, unsigned int n, const float* x, const float* B,
+          unsigned int ldb, float* y, float alpha, float beta);
+void GemvTransposed(unsigned int k, unsigned int n, const float* x,
+                    const float* B, unsigned int ldb, float* y, float alpha,
+                    float beta);
+} // namespace Avx512
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
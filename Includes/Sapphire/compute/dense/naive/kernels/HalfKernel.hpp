@@ -0,0 +1,81 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_HALFKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_HALFKERNEL_HPP
+
+#include <cstdint>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Converts size elements of 16-bit floats stored as raw bits to fp32
+using HalfToFloatKernelFunc = void (*)(float* out, const std::uint16_t* in,
+                                       unsigned int size);
+
+//! Converts size fp32 elements to 16-bit floats, rounding to nearest even
+using FloatToHalfKernelFunc = void (*)(std::uint16_t* out, const float* in,
+                                       unsigned int size);
+
+//! Conversion kernels between fp32 and IEEE half precision (fp16) or
+//! bfloat16 (bf16, upper 16 bits of fp32)
+//! Every kernel converts normal numbers, infinities and NaNs the same way.
+//! fp16 subnormals are converted exactly, while kernels using AVX-512 BF16
+//! flush fp32 subnormals to zero when converting to bf16
+struct HalfKernels
+{
+    HalfToFloatKernelFunc Fp16ToFloat;
+    FloatToHalfKernelFunc FloatToFp16;
+    HalfToFloatKernelFunc Bf16ToFloat;
+    FloatToHalfKernelFunc FloatToBf16;
+};
+
+//! Scalar conversions, used by the kernels for remaining elements
+std::uint16_t FloatToFp16Scalar(float value);
+float Fp16ToFloatScalar(std::uint16_t value);
+std::uint16_t FloatToBf16Scalar(float value);
+float Bf16ToFloatScalar(std::uint16_t value);
+
+//! Conversion kernels for each instruction set
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags (see KernelRegistry.hpp)
+namespace Sse
+{
+void Fp16ToFloat(float* out, const std::uint16_t* in, unsigned int size);
+void FloatToFp16(std::uint16_t* out, const float* in, unsigned int size);
+void Bf16ToFloat(float* out, const std::uint16_t* in, unsigned int size);
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size);
+} // namespace Sse
+
+#ifdef WITH_AVX2
+//! fp16 conversions use F16C, which every AVX2 cpu supports
+namespace Avx2
+{
+void Fp16ToFloat(float* out, const std::uint16_t* in, unsigned int size);
+void FloatToFp16(std::uint16_t* out, const float* in, unsigned int size);
+void Bf16ToFloat(float* out, const std::uint16_t* in, unsigned int size);
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size);
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+void Fp16ToFloat(float* out, const std::uint16_t* in, unsigned int size);
+void FloatToFp16(std::uint16_t* out, const float* in, unsigned int size);
+void Bf16ToFloat(float* out, const std::uint16_t* in, unsigned int size);
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size);
+} // namespace Avx512
+
+//! Converts with vcvtneps2bf16, used instead of Avx512::FloatToBf16 if the
+//! cpu supports AVX-512 BF16
+namespace Avx512Bf16
+{
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size);
+} // namespace Avx512Bf16
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
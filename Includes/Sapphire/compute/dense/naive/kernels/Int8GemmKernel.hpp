@@ -0,0 +1,122 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_INT8GEMMKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_INT8GEMMKERNEL_HPP
+
+#include <cstdint>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Computes (MR x NR) tile of int32 sums C = packedA x packedB for uint8 A and
+//! int8 B
+//! k is consumed in groups of KGroup consecutive elements, whose products are
+//! added into single int32 lane by one instruction (vpmaddwd on sign extended
+//! pairs, or vpdpbusd on quads). Products are never saturated
+//! \param groups : number of k groups in the packed slivers
+//! \param packedA : sliver packed by PackInt8A
+//! \param packedB : sliver packed by PackInt8B
+//! \param C : (MR x NR) row-major tile, overwritten
+using Int8GemmMicroKernelFunc = void (*)(unsigned int groups,
+                                         const void* packedA,
+                                         const std::int8_t* packedB,
+                                         std::int32_t* C);
+
+//! Describes register tile of the int8 micro kernel
+//! Whole k is accumulated in registers, since int32 sums do not lose precision
+struct Int8GemmKernelInfo
+{
+    unsigned int MR;
+    unsigned int NR;
+    unsigned int KGroup;
+    //! If true, A is packed as int16 so that pairs of it can be broadcast to
+    //! vpmaddwd directly. A is packed as uint8 otherwise
+    bool WideA;
+    Int8GemmMicroKernelFunc MicroKernel;
+};
+
+//! Largest register tile among all int8 kernels
+constexpr unsigned int Int8GemmMaxTileSize = 14 * 32;
+
+//! Packs (rows x k) block of uint8 matrix A into sliver of mr rows
+//! For each group of kGroup elements of k, kGroup elements of each row are
+//! stored one after another. Rows exceeding rows and k exceeding k are padded
+//! with zeros
+//! \param packedA : destination buffer with mr * ceil(k / kGroup) * kGroup
+//! elements of int16 if wide is true, or uint8 otherwise
+//! \param rowStride : distance between A(i, k) and A(i + 1, k)
+//! \param colStride : distance between A(i, k) and A(i, k + 1)
+void PackInt8A(void* packedA, const std::uint8_t* A, unsigned int rowStride,
+               unsigned int colStride, unsigned int rows, unsigned int k,
+               unsigned int mr, unsigned int kGroup, bool wide);
+
+//! Packs (k x cols) block of int8 matrix B into sliver of nr columns
+//! For each group of kGroup elements of k, kGroup elements of each column
+//! are stored one after another. Columns exceeding cols and k exceeding k are
+//! padded with zeros
+//! \param packedB : destination buffer with nr * ceil(k / kGroup) * kGroup
+//! elements
+//! \param rowStride : distance between B(k, j) and B(k + 1, j)
+//! \param colStride : distance between B(k, j) and B(k, j + 1)
+void PackInt8B(std::int8_t* packedB, const std::int8_t* B,
+               unsigned int rowStride, unsigned int colStride, unsigned int k,
+               unsigned int cols, unsigned int nr, unsigned int kGroup);
+
+//! Micro kernels for each instruction set
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags (see KernelRegistry.hpp)
+//! vpmaddubsw is not used since sum of two uint8 x int8 products can
+//! saturate int16. Weights are sign extended to int16 while they are loaded
+//! instead, which keeps them int8 in memory
+namespace Sse
+{
+constexpr unsigned int Int8GemmMR = 4;
+constexpr unsigned int Int8GemmNR = 8;
+
+void Int8GemmMicroKernel(unsigned int groups, const void* packedA,
+                         const std::int8_t* packedB, std::int32_t* C);
+} // namespace Sse
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+//! 6 x 16 uses 12 ymm accumulators, 2 for B and 1 for broadcasting A
+constexpr unsigned int Int8GemmMR = 6;
+constexpr unsigned int Int8GemmNR = 16;
+
+void Int8GemmMicroKernel(unsigned int groups, const void* packedA,
+                         const std::int8_t* packedB, std::int32_t* C);
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+//! 12 x 32 uses 24 zmm accumulators, 2 for B, 1 for broadcasting A and 1
+//! for products
+constexpr unsigned int Int8GemmMR = 12;
+constexpr unsigned int Int8GemmNR = 32;
+
+void Int8GemmMicroKernel(unsigned int groups, const void* packedA,
+                         const std::int8_t* packedB, std::int32_t* C);
+} // namespace Avx512
+
+//! Requires AVX-512 VNNI in addition to the instruction sets of Avx512
+//! vpdpbusd multiplies quads of uint8 A and int8 B and accumulates them
+//! without intermediate saturation, so A is not widened
+namespace Avx512Vnni
+{
+//! 14 x 32 uses 28 zmm accumulators, 2 for B and 1 for broadcasting A
+constexpr unsigned int Int8GemmMR = 14;
+constexpr unsigned int Int8GemmNR = 32;
+
+void Int8GemmMicroKernel(unsigned int groups, const void* packedA,
+                         const std::int8_t* packedB, std::int32_t* C);
+} // namespace Avx512Vnni
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
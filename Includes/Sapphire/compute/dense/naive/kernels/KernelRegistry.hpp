@@ -0,0 +1,105 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_KERNELREGISTRY_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_KERNELREGISTRY_HPP
+
+#include <Sapphire/compute/dense/naive/kernels/ElementwiseKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/GemmKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/GemvKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/HalfKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/Int8GemmKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/MathKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/ReduceKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/SmallGemmKernel.hpp>
+#include <string>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+enum class InstructionSet
+{
+    Sse,
+    Avx2,
+    Avx512,
+};
+
+std::string InstructionSetToString(InstructionSet isa);
+
+//! Precision of host transcendental functions (see MathKernel.hpp)
+enum class MathPrecision
+{
+    Accurate,
+    Fast,
+};
+
+//! Set of host kernels compiled for single instruction set
+struct HostKernels
+{
+    InstructionSet Isa;
+    GemmKernelInfo Gemm;
+    GemvKernelFunc Gemv;
+    GemvKernelFunc GemvTransposed;
+    const SmallGemmTable* SmallGemm;
+    Int8GemmKernelInfo Int8Gemm;
+    BinaryKernelFunc Add;
+    BinaryKernelFunc Sub;
+    BinaryKernelFunc Dot;
+    BinaryKernelFunc MulAdd;
+    ScaleKernelFunc Scale;
+    ScalarKernelFunc AddScalar;
+    ScalarKernelFunc SubScalar;
+    ScalarKernelFunc ScalarSub;
+    UnaryKernelFunc Inverse;
+    UnaryKernelFunc ReLU;
+    ScalarKernelFunc LeakyReLU;
+    BackwardKernelFunc ReLUBackward;
+    ParamBackwardKernelFunc LeakyReLUBackward;
+    BackwardKernelFunc InverseBackward;
+    GatherKernelFunc Gather;
+    TransposeKernelFunc Transpose;
+    HalfKernels Half;
+    const MathKernels* AccurateMath;
+    const MathKernels* FastMath;
+    const ReduceKernels* Reduce;
+};
+
+//! Returns true if kernels for given instruction set were compiled in and
+//! current cpu supports it
+bool IsSupported(InstructionSet isa);
+
+//! Returns kernels for currently selected instruction set
+//! Best instruction set supported by the cpu is selected on the first call
+const HostKernels& GetHostKernels();
+
+//! Returns int8 gemm kernel of given kernels
+//! AVX-512 VNNI kernel is returned instead if kernels are of AVX-512 and the
+//! cpu supports VNNI
+const Int8GemmKernelInfo& GetInt8GemmKernel(const HostKernels& kernels);
+
+//! Returns fp16 and bf16 conversion kernels of given kernels
+//! Conversion to bf16 with AVX-512 BF16 is returned instead if kernels are
+//! of AVX-512 and the cpu supports BF16
+const HalfKernels& GetHalfKernels(const HostKernels& kernels);
+
+//! Returns transcendental function kernels of given kernels for currently
+//! selected precision
+const MathKernels& GetMathKernels(const HostKernels& kernels);
+
+//! Overrides selected instruction set (e.g. for testing or benchmarking)
+//! Throws std::invalid_argument if given instruction set is not supported
+void SetInstructionSet(InstructionSet isa);
+
+//! Returns currently selected instruction set
+InstructionSet GetInstructionSet();
+
+//! Selects precision of transcendental functions on host
+//! Accurate is selected by default
+void SetMathPrecision(MathPrecision precision);
+
+MathPrecision GetMathPrecision();
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,102 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_MATHKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_MATHKERNEL_HPP
+
+#include <Sapphire/compute/dense/naive/kernels/ElementwiseKernel.hpp>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Vectorized transcendental functions computing out[i] = f(in[i])
+//! Functions are polynomial approximations after range reduction, and every
+//! instruction set computes the same polynomials (see MathKernelTemplate.hpp)
+//!
+//! Maximum error against double precision libm, measured on every 67th
+//! float (in ulp, accurate / fast)
+//! Exp 1 / 1, Log 1 / 1, Log10 3 / 3, Sin 3 / 3, Cos 3 / 3, Tan 4 / 6,
+//! Sinh 2 / 2, Cosh 2 / 2, Tanh 2 / 3, Sigmoid 3 / 5, ArcCos 2 / 2,
+//! ArcSin 3 / 3, ArcTan 3 / 3, ArcCosh 3 / 3, ArcSinh 4 / 4, ArcTanh 2 / 2
+//!
+//! Accurate kernels handle the whole float range : results and arguments of
+//! exp and log may be subnormal, and trigonometric functions fall back to
+//! libm for |x| > MathTrigonometricLimit
+//! Fast kernels skip those : exp flushes results below 2^-126 to zero and
+//! overflows for x > 88.37, log of subnormal numbers is inaccurate, results
+//! of trigonometric functions for |x| > MathTrigonometricLimit are
+//! unspecified, and divisions are replaced with refined reciprocal estimates
+struct MathKernels
+{
+    UnaryKernelFunc Exp;
+    UnaryKernelFunc Log;
+    UnaryKernelFunc Log10;
+    UnaryKernelFunc Sin;
+    UnaryKernelFunc Cos;
+    UnaryKernelFunc Tan;
+    UnaryKernelFunc Sinh;
+    UnaryKernelFunc Cosh;
+    UnaryKernelFunc Tanh;
+    UnaryKernelFunc Sigmoid;
+    UnaryKernelFunc ArcCos;
+    UnaryKernelFunc ArcSin;
+    UnaryKernelFunc ArcTan;
+    UnaryKernelFunc ArcCosh;
+    UnaryKernelFunc ArcSinh;
+    UnaryKernelFunc ArcTanh;
+
+    //! Computes dx[i] += dy[i] * f'(x[i]) in single pass
+    BackwardKernelFunc CosBackward;
+    BackwardKernelFunc SinBackward;
+    BackwardKernelFunc TanBackward;
+    BackwardKernelFunc CoshBackward;
+    BackwardKernelFunc SinhBackward;
+    BackwardKernelFunc TanhBackward;
+    BackwardKernelFunc ArcCosBackward;
+    BackwardKernelFunc ArcSinBackward;
+    BackwardKernelFunc ArcTanBackward;
+    BackwardKernelFunc ArcCoshBackward;
+    BackwardKernelFunc ArcSinhBackward;
+    BackwardKernelFunc ArcTanhBackward;
+};
+
+//! Arguments of trigonometric functions are reduced exactly up to this
+//! magnitude
+constexpr float MathTrigonometricLimit = 8192.0f;
+
+//! Scalar libm functions for arguments accurate kernels do not reduce
+//! Also used by gradients of trigonometric functions
+//! Defined in translation unit compiled without instruction set flags
+float SinScalar(float x);
+float CosScalar(float x);
+float TanScalar(float x);
+
+//! Math kernels for each instruction set
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags (see MathKernelTemplate.hpp)
+namespace Sse
+{
+extern const MathKernels AccurateMathKernels;
+extern const MathKernels FastMathKernels;
+} // namespace Sse
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+extern const MathKernels AccurateMathKernels;
+extern const MathKernels FastMathKernels;
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+extern const MathKernels AccurateMathKernels;
+extern const MathKernels FastMathKernels;
+} // namespace Avx512
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,857 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_MATHKERNELTEMPLATE_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_MATHKERNELTEMPLATE_HPP
+
+//! Should be included only by translation units compiled for single
+//! instruction set (MathKernel*.cpp)
+//! Vector types given as template arguments must be declared in unnamed
+//! namespace. Instantiations then have internal linkage, so the linker never
+//! merges kernels compiled for different instruction sets
+
+#include <Sapphire/compute/dense/naive/kernels/MathKernel.hpp>
+#include <cstddef>
+#include <limits>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+constexpr float MathInfinity = std::numeric_limits<float>::infinity();
+constexpr float MathNan = std::numeric_limits<float>::quiet_NaN();
+constexpr float MathMaxFloat = std::numeric_limits<float>::max();
+
+//! Vec should provide
+//! Type, Mask and Width (number of floats), and static functions
+//! Load, Store, Broadcast, Add, Sub, Mul, Div, MulAdd(a, b, c) = a * b + c,
+//! Min and Max (returning second operand if any of them is NaN), Abs,
+//! And and Xor (bitwise), Less, Greater and IsNan (returning Mask),
+//! Select(mask, a, b) = mask ? a : b, Any(mask),
+//! Round (to nearest integer, for |x| < 2^31),
+//! Reciprocal (estimate of 1 / x with relative error below 2^-22 for
+//! finite x),
+//! Pow2(n) = 2^n for integral n in [-127, 128] (2^-127 may be zero),
+//! ScaleByPow2(x, n) = x * 2^n for integral n in [-252, 254],
+//! Exponent and Mantissa (x = Mantissa(x) * 2^Exponent(x) with mantissa in
+//! [1, 2), for positive normal x)
+template <typename Vec>
+typename Vec::Type Polynomial(typename Vec::Type x, const float* coefficients,
+                              std::size_t count)
+{
+    auto result = Vec::Broadcast(coefficients[0]);
+    for (std::size_t i = 1; i < count; ++i)
+        result = Vec::MulAdd(result, x, Vec::Broadcast(coefficients[i]));
+    return result;
+}
+
+//! Reduces x = n * ln2 + r with |r| <= ln2 / 2 and computes
+//! e^r = 1 + r + r^2 * P(r)
+//! If Half is true, e^x / 2 is computed without overflowing early
+template <typename Vec, bool Fast, bool Half = false>
+typename Vec::Type ExpVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+        4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f
+    };
+
+    //! Clamped range still overflows to infinity and underflows to zero
+    x = Vec::Min(Vec::Broadcast(Half ? 89.5f : 88.8f), x);
+    x = Vec::Max(Vec::Broadcast(Fast ? -88.0f : -104.0f), x);
+
+    //! ln2 is split so that n * 0.693359375 is exact
+    const auto n = Vec::Round(Vec::Mul(x, Vec::Broadcast(1.44269504f)));
+    auto r = Vec::MulAdd(n, Vec::Broadcast(-0.693359375f), x);
+    r = Vec::MulAdd(n, Vec::Broadcast(2.12194440e-4f), r);
+
+    auto e = Polynomial<Vec>(r, coefficients, 6);
+    e = Vec::Add(Vec::MulAdd(e, Vec::Mul(r, r), r), Vec::Broadcast(1.0f));
+    const auto exponent = Half ? Vec::Sub(n, Vec::Broadcast(1.0f)) : n;
+    if constexpr (Fast)
+        return Vec::Mul(e, Vec::Pow2(exponent));
+    else
+        return Vec::ScaleByPow2(e, exponent);
+}
+
+//! Splits x = m * 2^e with m in [sqrt(1/2), sqrt(2)) and computes
+//! log(m) = f - f^2 / 2 + f^3 * P(f) where f = m - 1
+template <typename Vec, bool Fast>
+typename Vec::Type LogVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f,
+        -1.2420140846e-1f, 1.4249322787e-1f, -1.6668057665e-1f,
+        2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f
+    };
+
+    auto normal = x;
+    auto exponentBias = Vec::Broadcast(0.0f);
+    if constexpr (!Fast)
+    {
+        const auto subnormal = Vec::Less(x, Vec::Broadcast(1.17549435e-38f));
+        normal = Vec::Select(subnormal,
+                             Vec::Mul(x, Vec::Broadcast(8388608.0f)), x);
+        exponentBias =
+            Vec::Select(subnormal, Vec::Broadcast(23.0f), exponentBias);
+    }
+
+    auto m = Vec::Mantissa(normal);
+    auto e = Vec::Sub(Vec::Exponent(normal), exponentBias);
+    const auto large = Vec::Greater(m, Vec::Broadcast(1.41421356f));
+    m = Vec::Select(large, Vec::Mul(m, Vec::Broadcast(0.5f)), m);
+    e = Vec::Select(large, Vec::Add(e, Vec::Broadcast(1.0f)), e);
+
+    const auto f = Vec::Sub(m, Vec::Broadcast(1.0f));
+    const auto f2 = Vec::Mul(f, f);
+    auto y = Vec::Mul(Vec::Mul(Polynomial<Vec>(f, coefficients, 9), f), f2);
+    y = Vec::MulAdd(e, Vec::Broadcast(-2.12194440e-4f), y);
+    y = Vec::MulAdd(f2, Vec::Broadcast(-0.5f), y);
+    auto result = Vec::MulAdd(e, Vec::Broadcast(0.693359375f),
+                              Vec::Add(f, y));
+
+    //! log(+inf) = +inf, log(0) = -inf, log(x < 0) = NaN
+    const auto infinity = Vec::Broadcast(MathInfinity);
+    result = Vec::Select(Vec::Less(x, infinity), result, infinity);
+    result = Vec::Select(Vec::Greater(normal, Vec::Broadcast(0.0f)), result,
+                         Vec::Xor(infinity, Vec::Broadcast(-0.0f)));
+    result = Vec::Select(Vec::Less(x, Vec::Broadcast(0.0f)),
+                         Vec::Broadcast(MathNan), result);
+    return Vec::Select(Vec::IsNan(x), x, result);
+}
+
+//! Reduces x = q * pi / 2 + r with |r| <= pi / 4, and computes sin(r) and
+//! cos(r) with polynomials
+//! Quadrant of x is returned as float in [0, 4)
+template <typename Vec>
+void SinCosReduced(typename Vec::Type x, typename Vec::Type& sinR,
+                   typename Vec::Type& cosR, typename Vec::Type& quadrant)
+{
+    static constexpr float sinCoefficients[] = {
+        -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f
+    };
+    static constexpr float cosCoefficients[] = {
+        2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f
+    };
+
+    const auto q = Vec::Round(Vec::Mul(x, Vec::Broadcast(0.636619772f)));
+
+    //! Each part of pi / 2 except the last one has few enough bits that
+    //! q * part is exact for |x| <= MathTrigonometricLimit
+    auto r = Vec::MulAdd(q, Vec::Broadcast(-1.5703125f), x);
+    r = Vec::MulAdd(q, Vec::Broadcast(-4.837512969970703125e-4f), r);
+    r = Vec::MulAdd(q, Vec::Broadcast(-7.549533620476723e-8f), r);
+    r = Vec::MulAdd(q, Vec::Broadcast(-2.5633440682570896e-12f), r);
+
+    const auto r2 = Vec::Mul(r, r);
+    sinR = Vec::MulAdd(
+        Vec::Mul(Polynomial<Vec>(r2, sinCoefficients, 3), r2), r, r);
+    cosR = Vec::MulAdd(Vec::Mul(Polynomial<Vec>(r2, cosCoefficients, 3), r2),
+                       r2, Vec::MulAdd(r2, Vec::Broadcast(-0.5f),
+                                       Vec::Broadcast(1.0f)));
+
+    //! q mod 4 computed with float operations, since q is integral
+    const auto floorQuarter =
+        Vec::Round(Vec::MulAdd(q, Vec::Broadcast(0.25f),
+                               Vec::Broadcast(-0.375f)));
+    quadrant = Vec::MulAdd(floorQuarter, Vec::Broadcast(-4.0f), q);
+}
+
+//! Returns mask of lanes whose quadrant is 1 or 3
+template <typename Vec>
+typename Vec::Mask OddQuadrant(typename Vec::Type quadrant)
+{
+    const auto half = Vec::Round(Vec::MulAdd(quadrant, Vec::Broadcast(0.5f),
+                                             Vec::Broadcast(-0.25f)));
+    const auto odd = Vec::MulAdd(half, Vec::Broadcast(-2.0f), quadrant);
+    return Vec::Greater(odd, Vec::Broadcast(0.5f));
+}
+
+//! Returns sin(q * pi / 2 + r) from sin(r) and cos(r)
+template <typename Vec>
+typename Vec::Type SinOfQuadrant(typename Vec::Type sinR,
+                                 typename Vec::Type cosR,
+                                 typename Vec::Type quadrant)
+{
+    const auto result = Vec::Select(OddQuadrant<Vec>(quadrant), cosR, sinR);
+    return Vec::Select(Vec::Greater(quadrant, Vec::Broadcast(1.5f)),
+                       Vec::Xor(result, Vec::Broadcast(-0.0f)), result);
+}
+
+template <typename Vec>
+typename Vec::Type SinVec(typename Vec::Type x)
+{
+    typename Vec::Type sinR, cosR, quadrant;
+    SinCosReduced<Vec>(x, sinR, cosR, quadrant);
+    return SinOfQuadrant<Vec>(sinR, cosR, quadrant);
+}
+
+//! cos(x) = sin(x + pi / 2), so quadrant is shifted by one
+template <typename Vec>
+typename Vec::Type CosVec(typename Vec::Type x)
+{
+    typename Vec::Type sinR, cosR, quadrant;
+    SinCosReduced<Vec>(x, sinR, cosR, quadrant);
+    quadrant = Vec::Add(quadrant, Vec::Broadcast(1.0f));
+    quadrant = Vec::Select(Vec::Greater(quadrant, Vec::Broadcast(3.5f)),
+                           Vec::Sub(quadrant, Vec::Broadcast(4.0f)),
+                           quadrant);
+    return SinOfQuadrant<Vec>(sinR, cosR, quadrant);
+}
+
+template <typename Vec, bool Fast>
+typename Vec::Type TanVec(typename Vec::Type x)
+{
+    typename Vec::Type sinR, cosR, quadrant;
+    SinCosReduced<Vec>(x, sinR, cosR, quadrant);
+    //! tan(r + pi / 2) = -cos(r) / sin(r)
+    const auto odd = OddQuadrant<Vec>(quadrant);
+    const auto numerator =
+        Vec::Select(odd, Vec::Xor(cosR, Vec::Broadcast(-0.0f)), sinR);
+    const auto denominator = Vec::Select(odd, sinR, cosR);
+    if constexpr (Fast)
+        return Vec::Mul(numerator, Vec::Reciprocal(denominator));
+    else
+        return Vec::Div(numerator, denominator);
+}
+
+//! Fast inverse of infinity is zero, like division
+template <typename Vec, bool Fast>
+typename Vec::Type MathInverse(typename Vec::Type x)
+{
+    if constexpr (Fast)
+        return Vec::Reciprocal(Vec::Min(Vec::Broadcast(MathMaxFloat), x));
+    else
+        return Vec::Div(Vec::Broadcast(1.0f), x);
+}
+
+//! sinh(x) = x + x^3 * P(x^2) for |x| < 1 to avoid cancellation, and
+//! (e^|x| - e^-|x|) / 2 with sign of x otherwise
+template <typename Vec, bool Fast>
+typename Vec::Type SinhVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        2.03721912945e-4f, 8.33028376239e-3f, 1.66667160211e-1f
+    };
+
+    const auto absX = Vec::Abs(x);
+    const auto x2 = Vec::Mul(x, x);
+    const auto small = Vec::MulAdd(
+        Vec::Mul(Polynomial<Vec>(x2, coefficients, 3), x2), x, x);
+
+    const auto half = ExpVec<Vec, Fast, true>(absX);
+    const auto large = Vec::MulAdd(MathInverse<Vec, Fast>(half),
+                                   Vec::Broadcast(-0.25f), half);
+    const auto signedLarge =
+        Vec::Xor(large, Vec::And(x, Vec::Broadcast(-0.0f)));
+    return Vec::Select(Vec::Less(absX, Vec::Broadcast(1.0f)), small,
+                       signedLarge);
+}
+
+template <typename Vec, bool Fast>
+typename Vec::Type CoshVec(typename Vec::Type x)
+{
+    const auto half = ExpVec<Vec, Fast, true>(Vec::Abs(x));
+    return Vec::MulAdd(MathInverse<Vec, Fast>(half), Vec::Broadcast(0.25f),
+                       half);
+}
+
+//! tanh(x) = x + x^3 * P(x^2) for |x| < 0.625, and
+//! 1 - 2 / (e^2|x| + 1) with sign of x otherwise
+template <typename Vec, bool Fast>
+typename Vec::Type TanhVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        -5.70498872745e-3f, 2.06390887954e-2f, -5.37397155531e-2f,
+        1.33314422036e-1f, -3.33332819422e-1f
+    };
+
+    const auto absX = Vec::Abs(x);
+    const auto x2 = Vec::Mul(x, x);
+    const auto small = Vec::MulAdd(
+        Vec::Mul(Polynomial<Vec>(x2, coefficients, 5), x2), x, x);
+
+    const auto e = ExpVec<Vec, Fast>(Vec::Add(absX, absX));
+    const auto large = Vec::MulAdd(
+        MathInverse<Vec, Fast>(Vec::Add(e, Vec::Broadcast(1.0f))),
+        Vec::Broadcast(-2.0f), Vec::Broadcast(1.0f));
+    const auto signedLarge =
+        Vec::Xor(large, Vec::And(x, Vec::Broadcast(-0.0f)));
+    return Vec::Select(Vec::Less(absX, Vec::Broadcast(0.625f)), small,
+                       signedLarge);
+}
+
+//! sigmoid(x) = 1 / (1 + e^-x) for x >= 0 and e^x / (1 + e^x) otherwise, so
+//! that results for large negative x keep relative precision
+template <typename Vec, bool Fast>
+typename Vec::Type SigmoidVec(typename Vec::Type x)
+{
+    const auto e = ExpVec<Vec, Fast>(
+        Vec::Xor(Vec::Abs(x), Vec::Broadcast(-0.0f)));
+    const auto inverse =
+        MathInverse<Vec, Fast>(Vec::Add(e, Vec::Broadcast(1.0f)));
+    return Vec::Select(Vec::Less(x, Vec::Broadcast(0.0f)),
+                       Vec::Mul(e, inverse), inverse);
+}
+
+//! asin(x) = x + x^3 * P(x^2) for |x| <= 0.5, and
+//! pi / 2 - 2 * asin(sqrt((1 - |x|) / 2)) with sign of x otherwise
+template <typename Vec>
+typename Vec::Type ArcSinVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        4.2163199048e-2f, 2.4181311049e-2f, 4.5470025998e-2f,
+        7.4953002686e-2f, 1.6666752422e-1f
+    };
+
+    const auto absX = Vec::Abs(x);
+    const auto large = Vec::Greater(absX, Vec::Broadcast(0.5f));
+    const auto half = Vec::Mul(Vec::Sub(Vec::Broadcast(1.0f), absX),
+                               Vec::Broadcast(0.5f));
+    const auto z = Vec::Select(large, half, Vec::Mul(x, x));
+    const auto a = Vec::Select(large, Vec::Sqrt(half), absX);
+
+    auto result =
+        Vec::MulAdd(Vec::Mul(Polynomial<Vec>(z, coefficients, 5), z), a, a);
+    result = Vec::Select(
+        large, Vec::MulAdd(result, Vec::Broadcast(-2.0f),
+                           Vec::Broadcast(1.57079632679f)), result);
+    return Vec::Xor(result, Vec::And(x, Vec::Broadcast(-0.0f)));
+}
+
+//! acos(x) = pi / 2 - asin(x) for |x| <= 0.5, and 2 * asin(sqrt((1 - x) / 2))
+//! (or pi minus it for negative x) otherwise
+template <typename Vec>
+typename Vec::Type ArcCosVec(typename Vec::Type x)
+{
+    const auto absX = Vec::Abs(x);
+    const auto large = Vec::Greater(absX, Vec::Broadcast(0.5f));
+    const auto half = Vec::Sqrt(Vec::Mul(
+        Vec::Sub(Vec::Broadcast(1.0f), absX), Vec::Broadcast(0.5f)));
+    const auto arcSin = ArcSinVec<Vec>(Vec::Select(large, half, x));
+
+    const auto twice = Vec::Add(arcSin, arcSin);
+    const auto largeResult =
+        Vec::Select(Vec::Less(x, Vec::Broadcast(0.0f)),
+                    Vec::Sub(Vec::Broadcast(3.14159265359f), twice), twice);
+    return Vec::Select(large, largeResult,
+                       Vec::Sub(Vec::Broadcast(1.57079632679f), arcSin));
+}
+
+//! Reduces |x| to [0, tan(pi / 8)] with atan(x) = pi / 2 - atan(1 / x) and
+//! atan(x) = pi / 4 + atan((x - 1) / (x + 1)), then
+//! atan(t) = t + t^3 * P(t^2)
+template <typename Vec>
+typename Vec::Type ArcTanVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f,
+        -3.33329491539e-1f
+    };
+
+    const auto absX = Vec::Abs(x);
+    const auto one = Vec::Broadcast(1.0f);
+    const auto large = Vec::Greater(absX, Vec::Broadcast(2.414213562f));
+    const auto middle = Vec::Greater(absX, Vec::Broadcast(0.414213562f));
+
+    auto t = Vec::Select(middle,
+                         Vec::Div(Vec::Sub(absX, one), Vec::Add(absX, one)),
+                         absX);
+    t = Vec::Select(large, Vec::Div(Vec::Broadcast(-1.0f), absX), t);
+    auto offset = Vec::Select(middle, Vec::Broadcast(0.785398163397f),
+                              Vec::Broadcast(0.0f));
+    offset = Vec::Select(large, Vec::Broadcast(1.57079632679f), offset);
+
+    const auto t2 = Vec::Mul(t, t);
+    const auto result = Vec::Add(
+        offset,
+        Vec::MulAdd(Vec::Mul(Polynomial<Vec>(t2, coefficients, 4), t2), t, t));
+    return Vec::Xor(result, Vec::And(x, Vec::Broadcast(-0.0f)));
+}
+
+//! acosh(x) = sqrt(2z) * P(z) where z = x - 1 for z < 0.5,
+//! log(x + sqrt(z * (x + 1))) for larger x, and log(x) + ln2 for x > 1500
+template <typename Vec, bool Fast>
+typename Vec::Type ArcCoshVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        1.7596881071e-3f, -7.5272886713e-3f, 2.6454905019e-2f,
+        -1.1784741703e-1f, 1.4142135263e0f
+    };
+
+    const auto one = Vec::Broadcast(1.0f);
+    const auto z = Vec::Sub(x, one);
+    const auto small =
+        Vec::Mul(Polynomial<Vec>(z, coefficients, 5), Vec::Sqrt(z));
+
+    //! log(x) + ln2 for huge x avoids overflow of x^2
+    const auto huge = Vec::Greater(x, Vec::Broadcast(1500.0f));
+    const auto argument = Vec::Select(
+        huge, x, Vec::Add(x, Vec::Sqrt(Vec::Mul(z, Vec::Add(x, one)))));
+    auto large = LogVec<Vec, Fast>(argument);
+    large = Vec::Select(huge, Vec::Add(large, Vec::Broadcast(0.693147181f)),
+                        large);
+    return Vec::Select(Vec::Less(z, Vec::Broadcast(0.5f)), small, large);
+}
+
+//! asinh(x) = x + x^3 * P(x^2) for |x| < 0.5,
+//! log(|x| + sqrt(x^2 + 1)) with sign of x for larger x, and
+//! log(|x|) + ln2 for |x| > 1500
+template <typename Vec, bool Fast>
+typename Vec::Type ArcSinhVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        2.0122003309e-2f, -4.2699340972e-2f, 7.4847586088e-2f,
+        -1.6666288134e-1f
+    };
+
+    const auto absX = Vec::Abs(x);
+    const auto x2 = Vec::Mul(x, x);
+    const auto small = Vec::MulAdd(
+        Vec::Mul(Polynomial<Vec>(x2, coefficients, 4), x2), x, x);
+
+    const auto huge = Vec::Greater(absX, Vec::Broadcast(1500.0f));
+    const auto argument = Vec::Select(
+        huge, absX,
+        Vec::Add(absX, Vec::Sqrt(Vec::Add(x2, Vec::Broadcast(1.0f)))));
+    auto large = LogVec<Vec, Fast>(argument);
+    large = Vec::Select(huge, Vec::Add(large, Vec::Broadcast(0.693147181f)),
+                        large);
+    large = Vec::Xor(large, Vec::And(x, Vec::Broadcast(-0.0f)));
+    return Vec::Select(Vec::Less(absX, Vec::Broadcast(0.5f)), small, large);
+}
+
+//! atanh(x) = x + x^3 * P(x^2) for |x| < 0.5, and
+//! log((1 + x) / (1 - x)) / 2 otherwise
+template <typename Vec, bool Fast>
+typename Vec::Type ArcTanhVec(typename Vec::Type x)
+{
+    static constexpr float coefficients[] = {
+        1.81740078349e-1f, 8.24370301058e-2f, 1.46691431730e-1f,
+        1.99782164500e-1f, 3.33337300303e-1f
+    };
+
+    const auto one = Vec::Broadcast(1.0f);
+    const auto x2 = Vec::Mul(x, x);
+    const auto small = Vec::MulAdd(
+        Vec::Mul(Polynomial<Vec>(x2, coefficients, 5), x2), x, x);
+    const auto large = Vec::Mul(
+        LogVec<Vec, Fast>(Vec::Div(Vec::Add(one, x), Vec::Sub(one, x))),
+        Vec::Broadcast(0.5f));
+    return Vec::Select(Vec::Less(Vec::Abs(x), Vec::Broadcast(0.5f)), small,
+                       large);
+}
+
+//! Applies func to each vector of in
+//! Remaining elements are processed in zero padded vector on the stack
+template <typename Vec, typename Func>
+void MapVec(float* out, const float* in, unsigned int size, Func func)
+{
+    std::size_t idx = 0;
+    for (; idx + Vec::Width <= size; idx += Vec::Width)
+        Vec::Store(out + idx, func(Vec::Load(in + idx)));
+
+    if (idx < size)
+    {
+        float buffer[Vec::Width] = {};
+        for (std::size_t i = idx; i < size; ++i)
+            buffer[i - idx] = in[i];
+        Vec::Store(buffer, func(Vec::Load(buffer)));
+        for (std::size_t i = idx; i < size; ++i)
+            out[i] = buffer[i - idx];
+    }
+}
+
+//! Replaces elements of result whose x satisfies |x| > MathTrigonometricLimit
+//! (including infinities) with scalar(x)
+//! NaN is expected to be propagated by result itself
+template <typename Vec>
+typename Vec::Type WithFallback(typename Vec::Type x,
+                                typename Vec::Type result,
+                                float (*scalar)(float))
+{
+    if (!Vec::Any(Vec::Greater(Vec::Abs(x),
+                               Vec::Broadcast(MathTrigonometricLimit))))
+        return result;
+
+    float inputs[Vec::Width], results[Vec::Width];
+    Vec::Store(inputs, x);
+    Vec::Store(results, result);
+    for (unsigned int i = 0; i < Vec::Width; ++i)
+        if (inputs[i] > MathTrigonometricLimit ||
+            inputs[i] < -MathTrigonometricLimit)
+            results[i] = scalar(inputs[i]);
+    return Vec::Load(results);
+}
+
+//! Same as MapVec, but results for large arguments are computed by scalar
+//! function (see WithFallback)
+template <typename Vec, typename Func>
+void MapVecWithFallback(float* out, const float* in, unsigned int size,
+                        Func func, float (*scalar)(float))
+{
+    MapVec<Vec>(out, in, size, [&](typename Vec::Type x)
+    {
+        return WithFallback<Vec>(x, func(x), scalar);
+    });
+}
+
+//! Computes dx[i] += dy[i] * derivative(x[i]) in single pass
+template <typename Vec, typename Func>
+void MapBackwardVec(float* dx, const float* dy, const float* x,
+                    unsigned int size, Func derivative)
+{
+    std::size_t idx = 0;
+    for (; idx + Vec::Width <= size; idx += Vec::Width)
+        Vec::Store(dx + idx,
+                   Vec::MulAdd(Vec::Load(dy + idx),
+                               derivative(Vec::Load(x + idx)),
+                               Vec::Load(dx + idx)));
+
+    if (idx < size)
+    {
+        float dxBuffer[Vec::Width] = {}, dyBuffer[Vec::Width] = {},
+              xBuffer[Vec::Width] = {};
+        for (std::size_t i = idx; i < size; ++i)
+        {
+            dxBuffer[i - idx] = dx[i];
+            dyBuffer[i - idx] = dy[i];
+            xBuffer[i - idx] = x[i];
+        }
+        Vec::Store(dxBuffer, Vec::MulAdd(Vec::Load(dyBuffer),
+                                         derivative(Vec::Load(xBuffer)),
+                                         Vec::Load(dxBuffer)));
+        for (std::size_t i = idx; i < size; ++i)
+            dx[i] = dxBuffer[i - idx];
+    }
+}
+
+template <typename Vec, bool Fast>
+struct MathKernelSet
+{
+    static void Exp(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return ExpVec<Vec, Fast>(x);
+        });
+    }
+
+    static void Log(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return LogVec<Vec, Fast>(x);
+        });
+    }
+
+    static void Log10(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return Vec::Mul(LogVec<Vec, Fast>(x),
+                            Vec::Broadcast(0.434294482f));
+        });
+    }
+
+    static void Sin(float* out, const float* in, unsigned int size)
+    {
+        const auto func = [](typename Vec::Type x) { return SinVec<Vec>(x); };
+        if constexpr (Fast)
+            MapVec<Vec>(out, in, size, func);
+        else
+            MapVecWithFallback<Vec>(out, in, size, func, SinScalar);
+    }
+
+    static void Cos(float* out, const float* in, unsigned int size)
+    {
+        const auto func = [](typename Vec::Type x) { return CosVec<Vec>(x); };
+        if constexpr (Fast)
+            MapVec<Vec>(out, in, size, func);
+        else
+            MapVecWithFallback<Vec>(out, in, size, func, CosScalar);
+    }
+
+    static void Tan(float* out, const float* in, unsigned int size)
+    {
+        const auto func = [](typename Vec::Type x)
+        {
+            return TanVec<Vec, Fast>(x);
+        };
+        if constexpr (Fast)
+            MapVec<Vec>(out, in, size, func);
+        else
+            MapVecWithFallback<Vec>(out, in, size, func, TanScalar);
+    }
+
+    static void Sinh(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return SinhVec<Vec, Fast>(x);
+        });
+    }
+
+    static void Cosh(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return CoshVec<Vec, Fast>(x);
+        });
+    }
+
+    static void Tanh(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return TanhVec<Vec, Fast>(x);
+        });
+    }
+
+    static void Sigmoid(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return SigmoidVec<Vec, Fast>(x);
+        });
+    }
+
+    static void ArcCos(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return ArcCosVec<Vec>(x);
+        });
+    }
+
+    static void ArcSin(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return ArcSinVec<Vec>(x);
+        });
+    }
+
+    static void ArcTan(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return ArcTanVec<Vec>(x);
+        });
+    }
+
+    static void ArcCosh(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return ArcCoshVec<Vec, Fast>(x);
+        });
+    }
+
+    static void ArcSinh(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return ArcSinhVec<Vec, Fast>(x);
+        });
+    }
+
+    static void ArcTanh(float* out, const float* in, unsigned int size)
+    {
+        MapVec<Vec>(out, in, size, [](typename Vec::Type x)
+        {
+            return ArcTanhVec<Vec, Fast>(x);
+        });
+    }
+
+    //! d/dx cos(x) = -sin(x)
+    static void CosBackward(float* dx, const float* dy, const float* x,
+                            unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto result =
+                Vec::Xor(SinVec<Vec>(v), Vec::Broadcast(-0.0f));
+            if constexpr (Fast)
+                return result;
+            else
+                return WithFallback<Vec>(v, result, [](float a)
+                {
+                    return -SinScalar(a);
+                });
+        });
+    }
+
+    //! d/dx sin(x) = cos(x)
+    static void SinBackward(float* dx, const float* dy, const float* x,
+                            unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            if constexpr (Fast)
+                return CosVec<Vec>(v);
+            else
+                return WithFallback<Vec>(v, CosVec<Vec>(v), CosScalar);
+        });
+    }
+
+    //! d/dx tan(x) = 1 / cos(x)^2
+    static void TanBackward(float* dx, const float* dy, const float* x,
+                            unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto cos = CosVec<Vec>(v);
+            const auto result =
+                MathInverse<Vec, Fast>(Vec::Mul(cos, cos));
+            if constexpr (Fast)
+                return result;
+            else
+                return WithFallback<Vec>(v, result, [](float a)
+                {
+                    const auto cos = CosScalar(a);
+                    return 1.0f / (cos * cos);
+                });
+        });
+    }
+
+    //! d/dx cosh(x) = sinh(x)
+    static void CoshBackward(float* dx, const float* dy, const float* x,
+                             unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            return SinhVec<Vec, Fast>(v);
+        });
+    }
+
+    //! d/dx sinh(x) = cosh(x)
+    static void SinhBackward(float* dx, const float* dy, const float* x,
+                             unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            return CoshVec<Vec, Fast>(v);
+        });
+    }
+
+    //! d/dx tanh(x) = 1 / cosh(x)^2, which becomes zero once cosh(x)^2
+    //! overflows
+    static void TanhBackward(float* dx, const float* dy, const float* x,
+                             unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto cosh = CoshVec<Vec, Fast>(v);
+            return MathInverse<Vec, Fast>(Vec::Mul(cosh, cosh));
+        });
+    }
+
+    //! d/dx acos(x) = -1 / sqrt(1 - x^2)
+    static void ArcCosBackward(float* dx, const float* dy, const float* x,
+                               unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto one = Vec::Broadcast(1.0f);
+            return Vec::Div(
+                Vec::Broadcast(-1.0f),
+                Vec::Sqrt(Vec::Mul(Vec::Sub(one, v), Vec::Add(one, v))));
+        });
+    }
+
+    //! d/dx asin(x) = 1 / sqrt(1 - x^2)
+    static void ArcSinBackward(float* dx, const float* dy, const float* x,
+                               unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto one = Vec::Broadcast(1.0f);
+            return Vec::Div(
+                one, Vec::Sqrt(Vec::Mul(Vec::Sub(one, v), Vec::Add(one, v))));
+        });
+    }
+
+    //! d/dx atan(x) = 1 / (1 + x^2)
+    static void ArcTanBackward(float* dx, const float* dy, const float* x,
+                               unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto one = Vec::Broadcast(1.0f);
+            return Vec::Div(one, Vec::MulAdd(v, v, one));
+        });
+    }
+
+    //! d/dx acosh(x) = 1 / sqrt(x^2 - 1)
+    static void ArcCoshBackward(float* dx, const float* dy, const float* x,
+                                unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto one = Vec::Broadcast(1.0f);
+            return Vec::Div(
+                one, Vec::Sqrt(Vec::Mul(Vec::Sub(v, one), Vec::Add(v, one))));
+        });
+    }
+
+    //! d/dx asinh(x) = 1 / sqrt(x^2 + 1)
+    static void ArcSinhBackward(float* dx, const float* dy, const float* x,
+                                unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto one = Vec::Broadcast(1.0f);
+            return Vec::Div(one, Vec::Sqrt(Vec::MulAdd(v, v, one)));
+        });
+    }
+
+    //! d/dx atanh(x) = 1 / (1 - x^2)
+    static void ArcTanhBackward(float* dx, const float* dy, const float* x,
+                                unsigned int size)
+    {
+        MapBackwardVec<Vec>(dx, dy, x, size, [](typename Vec::Type v)
+        {
+            const auto one = Vec::Broadcast(1.0f);
+            return Vec::Div(one, Vec::Mul(Vec::Sub(one, v), Vec::Add(one, v)));
+        });
+    }
+};
+
+template <typename Vec, bool Fast>
+constexpr MathKernels MakeMathKernels()
+{
+    using Set = MathKernelSet<Vec, Fast>;
+    return MathKernels{ Set::Exp,
+                        Set::Log,
+                        Set::Log10,
+                        Set::Sin,
+                        Set::Cos,
+                        Set::Tan,
+                        Set::Sinh,
+                        Set::Cosh,
+                        Set::Tanh,
+                        Set::Sigmoid,
+                        Set::ArcCos,
+                        Set::ArcSin,
+                        Set::ArcTan,
+                        Set::ArcCosh,
+                        Set::ArcSinh,
+                        Set::ArcTanh,
+                        Set::CosBackward,
+                        Set::SinBackward,
+                        Set::TanBackward,
+                        Set::CoshBackward,
+                        Set::SinhBackward,
+                        Set::TanhBackward,
+                        Set::ArcCosBackward,
+                        Set::ArcSinBackward,
+                        Set::ArcTanBackward,
+                        Set::ArcCoshBackward,
+                        Set::ArcSinhBackward,
+                        Set::ArcTanhBackward };
+}
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,92 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_REDUCEKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_REDUCEKERNEL_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Reduces contiguous row of size elements
+//! Sums are accumulated in float over blocks of RowReduceBlockSize elements,
+//! and sums of the blocks are accumulated in double
+using RowSumKernelFunc = double (*)(const float* x, unsigned int size);
+
+//! Returns sum of (x[i] - center)^2
+using RowDeviationKernelFunc = double (*)(const float* x, float center,
+                                          unsigned int size);
+
+//! Returns sum of a[i] * b[i]
+using RowDotKernelFunc = double (*)(const float* a, const float* b,
+                                    unsigned int size);
+
+//! Returns maximum (or minimum) of the row, or NaN if the row has NaN
+using RowExtremumKernelFunc = float (*)(const float* x, unsigned int size);
+
+//! Accumulates a row of size elements into size accumulators, one for each
+//! column, when the reduced dimension is not the innermost one
+//! Sums are compensated (Kahan), so sum[i] - compensation[i] is the sum of
+//! the column with error independent of the number of rows
+using ColumnSumKernelFunc = void (*)(float* sum, float* compensation,
+                                     const float* x, unsigned int size);
+
+//! Accumulates (x[i] - center[i])^2 with compensation
+using ColumnDeviationKernelFunc = void (*)(float* sum, float* compensation,
+                                           const float* x,
+                                           const float* center,
+                                           unsigned int size);
+
+//! Updates acc[i] to the maximum (or minimum) of acc[i] and x[i]
+//! Once acc[i] becomes NaN, it stays NaN
+using ColumnExtremumKernelFunc = void (*)(float* acc, const float* x,
+                                          unsigned int size);
+
+//! Updates max[i] and index[i] = rowIdx if x[i] > max[i], or if x[i] is the
+//! first NaN of the column
+//! Indices are kept as floats, so rowIdx should be below 2^24
+using ColumnArgMaxKernelFunc = void (*)(float* max, float* index,
+                                        const float* x, float rowIdx,
+                                        unsigned int size);
+
+constexpr unsigned int RowReduceBlockSize = 256;
+
+struct ReduceKernels
+{
+    RowSumKernelFunc RowSum;
+    RowDeviationKernelFunc RowDeviation;
+    RowDotKernelFunc RowDot;
+    RowExtremumKernelFunc RowMax;
+    RowExtremumKernelFunc RowMin;
+    ColumnSumKernelFunc ColumnSum;
+    ColumnDeviationKernelFunc ColumnDeviation;
+    ColumnExtremumKernelFunc ColumnMax;
+    ColumnExtremumKernelFunc ColumnMin;
+    ColumnArgMaxKernelFunc ColumnArgMax;
+};
+
+//! Reduction kernels for each instruction set
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags (see ReduceKernelTemplate.hpp)
+namespace Sse
+{
+extern const ReduceKernels Reductions;
+} // namespace Sse
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+extern const ReduceKernels Reductions;
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+extern const ReduceKernels Reductions;
+} // namespace Avx512
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,298 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_REDUCEKERNELTEMPLATE_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_REDUCEKERNELTEMPLATE_HPP
+
+//! Should be included only by translation units compiled for single
+//! instruction set (ReduceKernel*.cpp)
+//! Vector types given as template arguments must be declared in unnamed
+//! namespace. Instantiations then have internal linkage, so the linker never
+//! merges kernels compiled for different instruction sets
+
+#include <Sapphire/compute/dense/naive/kernels/ReduceKernel.hpp>
+#include <limits>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Vec should provide
+//! Type, Mask and Width (number of floats), and static functions
+//! Zero, Load, Store, Broadcast, Add, Sub, MulAdd(a, b, c) = a * b + c,
+//! Min and Max (returning second operand if any of them is NaN),
+//! Greater and IsNan (returning Mask) and Select(mask, a, b) = mask ? a : b
+template <typename Vec>
+float HorizontalSum(typename Vec::Type v)
+{
+    float lanes[Vec::Width];
+    Vec::Store(lanes, v);
+    //! Lanes are added pairwise
+    for (unsigned int width = Vec::Width / 2; width > 0; width /= 2)
+        for (unsigned int i = 0; i < width; ++i)
+            lanes[i] += lanes[i + width];
+    return lanes[0];
+}
+
+//! Each block is summed with four independent accumulators, so every lane
+//! adds at most RowReduceBlockSize / (4 * Width) elements in float
+template <typename Vec>
+double RowSum(const float* x, unsigned int size)
+{
+    using Type = typename Vec::Type;
+    constexpr unsigned int width = Vec::Width;
+
+    double total = 0.0;
+    unsigned int i = 0;
+    while (i < size)
+    {
+        const auto end = size - i < RowReduceBlockSize
+                             ? size
+                             : i + RowReduceBlockSize;
+        Type acc[4] = { Vec::Zero(), Vec::Zero(), Vec::Zero(), Vec::Zero() };
+        for (; i + 4 * width <= end; i += 4 * width)
+            for (unsigned int k = 0; k < 4; ++k)
+                acc[k] = Vec::Add(acc[k], Vec::Load(x + i + k * width));
+        for (; i + width <= end; i += width)
+            acc[0] = Vec::Add(acc[0], Vec::Load(x + i));
+
+        auto block = HorizontalSum<Vec>(
+            Vec::Add(Vec::Add(acc[0], acc[1]), Vec::Add(acc[2], acc[3])));
+        for (; i < end; ++i)
+            block += x[i];
+        total += block;
+    }
+    return total;
+}
+
+template <typename Vec>
+double RowDeviation(const float* x, float center, unsigned int size)
+{
+    using Type = typename Vec::Type;
+    constexpr unsigned int width = Vec::Width;
+    const Type c = Vec::Broadcast(center);
+
+    double total = 0.0;
+    unsigned int i = 0;
+    while (i < size)
+    {
+        const auto end = size - i < RowReduceBlockSize
+                             ? size
+                             : i + RowReduceBlockSize;
+        Type acc[4] = { Vec::Zero(), Vec::Zero(), Vec::Zero(), Vec::Zero() };
+        for (; i + 4 * width <= end; i += 4 * width)
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                const auto d = Vec::Sub(Vec::Load(x + i + k * width), c);
+                acc[k] = Vec::MulAdd(d, d, acc[k]);
+            }
+        for (; i + width <= end; i += width)
+        {
+            const auto d = Vec::Sub(Vec::Load(x + i), c);
+            acc[0] = Vec::MulAdd(d, d, acc[0]);
+        }
+
+        auto block = HorizontalSum<Vec>(
+            Vec::Add(Vec::Add(acc[0], acc[1]), Vec::Add(acc[2], acc[3])));
+        for (; i < end; ++i)
+            block += (x[i] - center) * (x[i] - center);
+        total += block;
+    }
+    return total;
+}
+
+template <typename Vec>
+double RowDot(const float* a, const float* b, unsigned int size)
+{
+    using Type = typename Vec::Type;
+    constexpr unsigned int width = Vec::Width;
+
+    double total = 0.0;
+    unsigned int i = 0;
+    while (i < size)
+    {
+        const auto end = size - i < RowReduceBlockSize
+                             ? size
+                             : i + RowReduceBlockSize;
+        Type acc[4] = { Vec::Zero(), Vec::Zero(), Vec::Zero(), Vec::Zero() };
+        for (; i + 4 * width <= end; i += 4 * width)
+            for (unsigned int k = 0; k < 4; ++k)
+                acc[k] = Vec::MulAdd(Vec::Load(a + i + k * width),
+                                     Vec::Load(b + i + k * width), acc[k]);
+        for (; i + width <= end; i += width)
+            acc[0] = Vec::MulAdd(Vec::Load(a + i), Vec::Load(b + i), acc[0]);
+
+        auto block = HorizontalSum<Vec>(
+            Vec::Add(Vec::Add(acc[0], acc[1]), Vec::Add(acc[2], acc[3])));
+        for (; i < end; ++i)
+            block += a[i] * b[i];
+        total += block;
+    }
+    return total;
+}
+
+//! Accumulators that became NaN are kept, and Max(acc, x) returns x if x is
+//! NaN, so NaN propagates in three instructions
+template <typename Vec, bool IsMax>
+typename Vec::Type ExtremumStep(typename Vec::Type acc, typename Vec::Type x)
+{
+    return Vec::Select(Vec::IsNan(acc), acc,
+                       IsMax ? Vec::Max(acc, x) : Vec::Min(acc, x));
+}
+
+//! Returns NaN if any of them is NaN
+//! Templated on Vec as well, so that it is not shared with other instruction
+//! sets
+template <typename Vec, bool IsMax>
+float ExtremumScalar(float a, float b)
+{
+    if (a != a)
+        return a;
+    return (IsMax ? a >= b : a <= b) ? a : b;
+}
+
+template <typename Vec, bool IsMax>
+float RowExtremum(const float* x, unsigned int size)
+{
+    using Type = typename Vec::Type;
+    constexpr unsigned int width = Vec::Width;
+    constexpr float init = IsMax ? -std::numeric_limits<float>::infinity()
+                                 : std::numeric_limits<float>::infinity();
+
+    Type acc[4] = { Vec::Broadcast(init), Vec::Broadcast(init),
+                    Vec::Broadcast(init), Vec::Broadcast(init) };
+    unsigned int i = 0;
+    for (; i + 4 * width <= size; i += 4 * width)
+        for (unsigned int k = 0; k < 4; ++k)
+            acc[k] = ExtremumStep<Vec, IsMax>(acc[k],
+                                              Vec::Load(x + i + k * width));
+    for (; i + width <= size; i += width)
+        acc[0] = ExtremumStep<Vec, IsMax>(acc[0], Vec::Load(x + i));
+
+    float lanes[4][Vec::Width];
+    for (unsigned int k = 0; k < 4; ++k)
+        Vec::Store(lanes[k], acc[k]);
+    auto result = init;
+    for (unsigned int k = 0; k < 4; ++k)
+        for (unsigned int lane = 0; lane < width; ++lane)
+            result = ExtremumScalar<Vec, IsMax>(result, lanes[k][lane]);
+    for (; i < size; ++i)
+        result = ExtremumScalar<Vec, IsMax>(result, x[i]);
+    return result;
+}
+
+//! Kahan summation : compensation holds the low order bits lost by the
+//! previous addition, and is subtracted from the next addend
+template <typename Vec>
+void ColumnSum(float* sum, float* compensation, const float* x,
+               unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + Vec::Width <= size; i += Vec::Width)
+    {
+        const auto s = Vec::Load(sum + i);
+        const auto y = Vec::Sub(Vec::Load(x + i),
+                                Vec::Load(compensation + i));
+        const auto t = Vec::Add(s, y);
+        Vec::Store(compensation + i, Vec::Sub(Vec::Sub(t, s), y));
+        Vec::Store(sum + i, t);
+    }
+    for (; i < size; ++i)
+    {
+        const auto y = x[i] - compensation[i];
+        const auto t = sum[i] + y;
+        compensation[i] = (t - sum[i]) - y;
+        sum[i] = t;
+    }
+}
+
+template <typename Vec>
+void ColumnDeviation(float* sum, float* compensation, const float* x,
+                     const float* center, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + Vec::Width <= size; i += Vec::Width)
+    {
+        const auto s = Vec::Load(sum + i);
+        const auto d = Vec::Sub(Vec::Load(x + i), Vec::Load(center + i));
+        const auto negated = Vec::Sub(Vec::Zero(),
+                                      Vec::Load(compensation + i));
+        const auto y = Vec::MulAdd(d, d, negated);
+        const auto t = Vec::Add(s, y);
+        Vec::Store(compensation + i, Vec::Sub(Vec::Sub(t, s), y));
+        Vec::Store(sum + i, t);
+    }
+    for (; i < size; ++i)
+    {
+        const auto d = x[i] - center[i];
+        const auto y = d * d - compensation[i];
+        const auto t = sum[i] + y;
+        compensation[i] = (t - sum[i]) - y;
+        sum[i] = t;
+    }
+}
+
+template <typename Vec, bool IsMax>
+void ColumnExtremum(float* acc, const float* x, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + Vec::Width <= size; i += Vec::Width)
+        Vec::Store(acc + i, ExtremumStep<Vec, IsMax>(Vec::Load(acc + i),
+                                                     Vec::Load(x + i)));
+    for (; i < size; ++i)
+        acc[i] = ExtremumScalar<Vec, IsMax>(acc[i], x[i]);
+}
+
+//! Greater elements replace the maximum first, then NaN elements replace
+//! maximums that are not NaN yet, so the first of equal maximums is kept
+template <typename Vec>
+void ColumnArgMax(float* max, float* index, const float* x, float rowIdx,
+                  unsigned int size)
+{
+    const auto row = Vec::Broadcast(rowIdx);
+    unsigned int i = 0;
+    for (; i + Vec::Width <= size; i += Vec::Width)
+    {
+        const auto value = Vec::Load(x + i);
+        auto acc = Vec::Load(max + i);
+        auto idx = Vec::Load(index + i);
+
+        const auto greater = Vec::Greater(value, acc);
+        acc = Vec::Select(greater, value, acc);
+        idx = Vec::Select(greater, row, idx);
+
+        const auto firstNan = Vec::IsNan(
+            Vec::Select(Vec::IsNan(acc), Vec::Zero(), value));
+        Vec::Store(max + i, Vec::Select(firstNan, value, acc));
+        Vec::Store(index + i, Vec::Select(firstNan, row, idx));
+    }
+    for (; i < size; ++i)
+    {
+        if (x[i] > max[i] || (x[i] != x[i] && max[i] == max[i]))
+        {
+            max[i] = x[i];
+            index[i] = rowIdx;
+        }
+    }
+}
+
+template <typename Vec>
+constexpr ReduceKernels MakeReduceKernels()
+{
+    return {
+        RowSum<Vec>,
+        RowDeviation<Vec>,
+        RowDot<Vec>,
+        RowExtremum<Vec, true>,
+        RowExtremum<Vec, false>,
+        ColumnSum<Vec>,
+        ColumnDeviation<Vec>,
+        ColumnExtremum<Vec, true>,
+        ColumnExtremum<Vec, false>,
+        ColumnArgMax<Vec>,
+    };
+}
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
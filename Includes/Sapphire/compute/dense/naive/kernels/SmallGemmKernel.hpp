@@ -0,0 +1,63 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_SMALLGEMMKERNEL_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_SMALLGEMMKERNEL_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Computes out = alpha * op(A) x op(B) + beta * out for batchSize contiguous
+//! (M x K) x (K x N) matrices, where M, N and K are fixed at compile time
+//! Loops are fully unrolled and the output block is kept in registers, so
+//! there is no packing or bound checking per matrix
+//! \param beta : out is not read if beta is zero
+using SmallGemmKernelFunc = void (*)(unsigned int batchSize, float* out,
+                                     const float* A, const float* B,
+                                     bool transA, bool transB, float alpha,
+                                     float beta);
+
+//! Sizes of M, N and K with specialized kernels
+constexpr unsigned int SmallGemmSizeCount = 4;
+constexpr unsigned int SmallGemmSizes[SmallGemmSizeCount] = { 4, 8, 16, 32 };
+
+//! Kernels for every combination of SmallGemmSizes
+//! Kernel for (SmallGemmSizes[m], SmallGemmSizes[n], SmallGemmSizes[k]) is
+//! stored at (m * SmallGemmSizeCount + n) * SmallGemmSizeCount + k
+struct SmallGemmTable
+{
+    SmallGemmKernelFunc Kernels[SmallGemmSizeCount * SmallGemmSizeCount *
+                                SmallGemmSizeCount];
+};
+
+//! Returns specialized kernel for given sizes, or nullptr if there is none
+SmallGemmKernelFunc FindSmallGemmKernel(const SmallGemmTable& table,
+                                        unsigned int M, unsigned int N,
+                                        unsigned int K);
+
+//! Kernel tables for each instruction set
+//! Each of them are defined in separate translation unit compiled with its
+//! own instruction set flags (see SmallGemmKernelTemplate.hpp)
+namespace Sse
+{
+extern const SmallGemmTable SmallGemmKernels;
+} // namespace Sse
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+extern const SmallGemmTable SmallGemmKernels;
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+extern const SmallGemmTable SmallGemmKernels;
+} // namespace Avx512
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,143 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_SMALLGEMMKERNELTEMPLATE_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_SMALLGEMMKERNELTEMPLATE_HPP
+
+//! Should be included only by translation units compiled for single
+//! instruction set (SmallGemmKernel*.cpp)
+//! Vector types given as template arguments must be declared in unnamed
+//! namespace. Instantiations then have internal linkage, so the linker never
+//! merges kernels compiled for different instruction sets
+
+#include <Sapphire/compute/dense/naive/kernels/SmallGemmKernel.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Vec should provide
+//! Type, Width (number of floats) and Accumulators (number of registers
+//! that can hold the output block), and static functions Zero, Load, Store,
+//! Broadcast, Mul and MulAdd(a, b, c) = a * b + c
+//! N must be multiple of Vec::Width
+template <typename Vec, unsigned int M, unsigned int N, unsigned int K>
+void SmallGemmBlock(float* out, const float* A, const float* B, float alpha,
+                    float beta)
+{
+    using Type = typename Vec::Type;
+    constexpr unsigned int vectorsPerRow = N / Vec::Width;
+    constexpr unsigned int rowsPerBlock =
+        Vec::Accumulators / vectorsPerRow < 1
+            ? 1
+            : (Vec::Accumulators / vectorsPerRow < M
+                   ? Vec::Accumulators / vectorsPerRow
+                   : M);
+
+    const Type alphaVec = Vec::Broadcast(alpha);
+    const Type betaVec = Vec::Broadcast(beta);
+
+    for (unsigned int rowIdx = 0; rowIdx < M; rowIdx += rowsPerBlock)
+    {
+        Type acc[rowsPerBlock][vectorsPerRow];
+        for (unsigned int i = 0; i < rowsPerBlock; ++i)
+            for (unsigned int j = 0; j < vectorsPerRow; ++j)
+                acc[i][j] = Vec::Zero();
+
+        for (unsigned int k = 0; k < K; ++k)
+        {
+            Type b[vectorsPerRow];
+            for (unsigned int j = 0; j < vectorsPerRow; ++j)
+                b[j] = Vec::Load(B + k * N + j * Vec::Width);
+
+            for (unsigned int i = 0; i < rowsPerBlock; ++i)
+            {
+                const Type a = Vec::Broadcast(A[(rowIdx + i) * K + k]);
+                for (unsigned int j = 0; j < vectorsPerRow; ++j)
+                    acc[i][j] = Vec::MulAdd(a, b[j], acc[i][j]);
+            }
+        }
+
+        for (unsigned int i = 0; i < rowsPerBlock; ++i)
+        {
+            float* row = out + (rowIdx + i) * N;
+            for (unsigned int j = 0; j < vectorsPerRow; ++j)
+            {
+                Type result = Vec::Mul(alphaVec, acc[i][j]);
+                if (beta != 0.0f)
+                    result = Vec::MulAdd(
+                        betaVec, Vec::Load(row + j * Vec::Width), result);
+                Vec::Store(row + j * Vec::Width, result);
+            }
+        }
+    }
+}
+
+//! Transposed operands are copied into contiguous buffer on the stack first,
+//! which costs much less than the product itself
+template <typename Vec, unsigned int M, unsigned int N, unsigned int K>
+void SmallGemm(unsigned int batchSize, float* out, const float* A,
+               const float* B, bool transA, bool transB, float alpha,
+               float beta)
+{
+    float bufferA[M * K];
+    float bufferB[K * N];
+
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        const float* a = A;
+        if (transA)
+        {
+            for (unsigned int i = 0; i < M; ++i)
+                for (unsigned int k = 0; k < K; ++k)
+                    bufferA[i * K + k] = A[k * M + i];
+            a = bufferA;
+        }
+
+        const float* b = B;
+        if (transB)
+        {
+            for (unsigned int k = 0; k < K; ++k)
+                for (unsigned int j = 0; j < N; ++j)
+                    bufferB[k * N + j] = B[j * K + k];
+            b = bufferB;
+        }
+
+        SmallGemmBlock<Vec, M, N, K>(out, a, b, alpha, beta);
+
+        A += M * K;
+        B += K * N;
+        out += M * N;
+    }
+}
+
+//! VecFor<N> should be the widest vector type whose width divides N
+template <template <unsigned int> class VecFor, std::size_t Idx>
+constexpr SmallGemmKernelFunc SmallGemmTableEntry()
+{
+    constexpr auto count = SmallGemmSizeCount;
+    constexpr auto M = SmallGemmSizes[Idx / (count * count)];
+    constexpr auto N = SmallGemmSizes[Idx / count % count];
+    constexpr auto K = SmallGemmSizes[Idx % count];
+    return &SmallGemm<VecFor<N>, M, N, K>;
+}
+
+template <template <unsigned int> class VecFor, std::size_t... Idx>
+constexpr SmallGemmTable MakeSmallGemmTable(std::index_sequence<Idx...>)
+{
+    return SmallGemmTable{ { SmallGemmTableEntry<VecFor, Idx>()... } };
+}
+
+template <template <unsigned int> class VecFor>
+constexpr SmallGemmTable MakeSmallGemmTable()
+{
+    return MakeSmallGemmTable<VecFor>(std::make_index_sequence<
+        SmallGemmSizeCount * SmallGemmSizeCount * SmallGemmSizeCount>());
+}
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
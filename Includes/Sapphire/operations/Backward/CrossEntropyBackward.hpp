@@ -0,0 +1,29 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_BACKPROP_CROSSENTROPYBACKWARD_HPP
+#define SAPPHIRE_BACKPROP_CROSSENTROPYBACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+
+namespace Sapphire::BackProp
+{
+//! Computes dy * (softmax(x) - onehot(label)) / rows from x and log-sum-exp
+//! of its rows saved by the forward pass
+class CrossEntropyBackward : public BackPropWrapper
+{
+public:
+    CrossEntropyBackward(TensorUtil::TensorData dx, TensorUtil::TensorData dy,
+                         TensorUtil::TensorData x,
+                         TensorUtil::TensorData logSumExp,
+                         TensorUtil::TensorData label);
+
+private:
+    void m_runBackProp() override;
+};
+} // namespace Sapphire::BackProp
+
+#endif
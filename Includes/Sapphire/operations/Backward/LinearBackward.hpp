@@ -17,6 +17,7 @@ constexpr static int dyIdx = 0;
 constexpr static int weightIdx = 0;
 constexpr static int biasIdx = 1;
 constexpr static int xIdx = 0;
+constexpr static int yIdx = 1;
 
 class LinearBackProp : public BackPropWrapper
 {
@@ -26,19 +27,32 @@ public:
                             TensorUtil::TensorData weight,
                             TensorUtil::TensorData bias,
                             TensorUtil::TensorData x,
+                            TensorUtil::TensorData y,
                             Optimizer::Optimizer* optimizer,
-                            int batchSize);
+                            int batchSize,
+                            Compute::GemmActivation activation =
+                                Compute::GemmActivation::None,
+                            float negativeSlope = 0.0f);
 
 private:
     void m_runBackProp() override;
 
-    void m_backProp(TensorUtil::TensorData& weight);
+    //! Returns gradient of the output before activation
+    //! dy itself is returned if there is no activation
+    [[nodiscard]] TensorUtil::TensorData m_activationBackProp() const;
 
-    void m_updateWeight(TensorUtil::TensorData& weight) const;
+    void m_backProp(const TensorUtil::TensorData& dz,
+                    TensorUtil::TensorData& weight);
 
-    void m_updateBias(TensorUtil::TensorData& bias) const;
+    void m_updateWeight(const TensorUtil::TensorData& dz,
+                        TensorUtil::TensorData& weight) const;
+
+    void m_updateBias(const TensorUtil::TensorData& dz,
+                      TensorUtil::TensorData& bias) const;
 
     int m_batchSize;
+    Compute::GemmActivation m_activation;
+    float m_negativeSlope;
 };
 } // namespace Sapphire::BackProp
 
@@ -14,8 +14,9 @@ namespace Sapphire::BackProp
 class SoftMaxBackward : public BackPropWrapper
 {
  public:
+    //! \param y : output of the softmax
     SoftMaxBackward(TensorUtil::TensorData dx, TensorUtil::TensorData dy,
-                    TensorUtil::TensorData x);
+                    TensorUtil::TensorData y);
 
 private:
     void m_runBackProp() override;
@@ -8,9 +8,11 @@
 #define SAPPHIRE_NN_CONV2D_HPP
 
 #include <Sapphire/operations/Initializers/Initialize.hpp>
+#include <Sapphire/operations/Quantization/Observer.hpp>
 #include <Sapphire/operations/Unit.hpp>
 #include <Sapphire/operations/optimizers/Optimizer.hpp>
 #include <Sapphire/tensor/Tensor.hpp>
+#include <memory>
 #include <utility>
 
 namespace Sapphire::NN
@@ -33,6 +35,14 @@ class Conv2D : public Unit
     Tensor operator()(Tensor& tensor, Tensor& filter, Tensor& bias);
     Tensor operator()(Tensor& tensor, Tensor& filter);
 
+    //! Records input of every forward pass to the observer while calibrating
+    //! the layer for quantization (see NN::QuantizedConv2D)
+    //! Observer is detached if nullptr is given
+    void SetObserver(std::shared_ptr<Quantization::Observer> observer)
+    {
+        m_observer = std::move(observer);
+    }
+
  private:
     [[nodiscard]] int m_registerOutputTensor(
         const TensorUtil::TensorDescriptor& xDesc) const;
@@ -48,6 +58,7 @@ class Conv2D : public Unit
     bool m_isSparse = false;
     int m_yRows = -1;
     int m_yCols = -1;
+    std::shared_ptr<Quantization::Observer> m_observer;
 };
 };  // namespace Sapphire::NN
 
@@ -7,20 +7,29 @@
 #ifndef SAPPHIRE_NN_LINEAR_HPP
 #define SAPPHIRE_NN_LINEAR_HPP
 
+#include <Sapphire/compute/BasicOps.hpp>
 #include <Sapphire/tensor/Tensor.hpp>
 #include <Sapphire/operations/optimizers/Optimizer.hpp>
 #include <Sapphire/operations/Unit.hpp>
 #include <Sapphire/operations/Initializers/Initialize.hpp>
+#include <Sapphire/operations/Quantization/Observer.hpp>
+#include <memory>
 
 namespace Sapphire::NN
 {
 class Linear : public Unit
 {
 public:
+    //! \param activation : activation fused into the layer. Output of the
+    //! layer is activation(x * weight^T + bias), computed in a single pass
+    //! over the output
+    //! \param negativeSlope : slope of LeakyReLU for negative inputs
     Linear(int inputFeatureSize, int outputFeatureSize,
            Optimizer::Optimizer* optimizer,
            CudaDevice device = CudaDevice(),
-           bool isSparse = false);
+           bool isSparse = false,
+           Compute::GemmActivation activation = Compute::GemmActivation::None,
+           float negativeSlope = 0.01f);
     ~Linear() override = default;
 
     Linear(const Linear& linear) = default;
@@ -30,6 +39,14 @@ public:
 
     Tensor operator()(Tensor& x, Tensor weight, Tensor bias);
 
+    //! Records input of every forward pass to the observer while calibrating
+    //! the layer for quantization (see NN::QuantizedLinear)
+    //! Observer is detached if nullptr is given
+    void SetObserver(std::shared_ptr<Quantization::Observer> observer)
+    {
+        m_observer = std::move(observer);
+    }
+
 protected:
     void m_addTensorData(std::string name, TensorUtil::TensorData tensorData)
     {
@@ -61,6 +78,9 @@ private:
     int m_outputs;
     CudaDevice m_device;
     bool m_isSparse;
+    Compute::GemmActivation m_activation;
+    float m_negativeSlope;
+    std::shared_ptr<Quantization::Observer> m_observer;
 };
 } // namespace Sapphire::NN
 
@@ -0,0 +1,74 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_QUANTIZED_CONV2D_HPP
+#define SAPPHIRE_NN_QUANTIZED_CONV2D_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/QuantizedTensorData.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <utility>
+
+namespace Sapphire::NN
+{
+//! Int8 replacement of trained NN::Conv2D for inference on host
+//! Filter is quantized per output channel and packed once on construction,
+//! and input is quantized with params chosen while calibrating the fp32
+//! layer (see NN::Conv2D::SetObserver)
+//! Output is fp32 and does not record history for back propagation
+class QuantizedConv2D : public Unit
+{
+ public:
+    //! Arguments are the same as NN::Conv2D without bias
+    //! \param filter : trained filter of shape (yC, xC, filterH, filterW).
+    //! Copied on construction
+    //! \param inputParams : UInt8 params of the input, usually from
+    //! Quantization::Observer::GetParams
+    QuantizedConv2D(int yChannels, int xChannels,
+                    std::pair<int, int> inputSize,
+                    std::pair<int, int> filterSize, std::pair<int, int> stride,
+                    std::pair<int, int> padSize, std::pair<int, int> dilation,
+                    Tensor filter, TensorUtil::QuantizationParams inputParams);
+
+    //! Arguments are the same as NN::Conv2D with bias
+    //! \param bias : trained bias of yC elements. Copied on construction
+    QuantizedConv2D(int yChannels, int xChannels,
+                    std::pair<int, int> inputSize,
+                    std::pair<int, int> filterSize, std::pair<int, int> stride,
+                    std::pair<int, int> padSize, std::pair<int, int> dilation,
+                    Tensor filter, Tensor bias,
+                    TensorUtil::QuantizationParams inputParams);
+
+    ~QuantizedConv2D() override = default;
+
+    QuantizedConv2D(const QuantizedConv2D& conv2D) = default;
+    QuantizedConv2D(QuantizedConv2D&& conv2D) = default;
+    QuantizedConv2D& operator=(const QuantizedConv2D& conv2D) = default;
+    QuantizedConv2D& operator=(QuantizedConv2D&& conv2D) noexcept = default;
+
+    Tensor operator()(Tensor& tensor);
+
+ private:
+    [[nodiscard]] int m_registerOutputTensor(
+        const TensorUtil::TensorDescriptor& xDesc) const;
+
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    std::pair<int, int> m_inputSize, m_filterSize, m_stride, m_padSize,
+        m_dilation;
+    int m_yChannels = -1;
+    int m_xChannels = -1;
+    bool m_useBias = false;
+    int m_yRows = -1;
+    int m_yCols = -1;
+    TensorUtil::QuantizationParams m_inputParams;
+    TensorUtil::QuantizedTensorData m_filter;
+    TensorUtil::TensorData m_bias;
+};
+} // namespace Sapphire::NN
+
+#endif
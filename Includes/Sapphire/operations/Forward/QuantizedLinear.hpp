@@ -0,0 +1,61 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_QUANTIZED_LINEAR_HPP
+#define SAPPHIRE_NN_QUANTIZED_LINEAR_HPP
+
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/QuantizedTensorData.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+
+namespace Sapphire::NN
+{
+//! Int8 replacement of trained NN::Linear for inference on host
+//! Weight is quantized per output channel and packed once on construction,
+//! and input is quantized with params chosen while calibrating the fp32
+//! layer (see NN::Linear::SetObserver)
+//! Output is fp32 and does not record history for back propagation
+class QuantizedLinear : public Unit
+{
+public:
+    //! \param weight, bias : trained parameters given to NN::Linear. Copied
+    //! on construction, so the fp32 parameters can be released afterwards
+    //! \param inputParams : UInt8 params of the input, usually from
+    //! Quantization::Observer::GetParams
+    QuantizedLinear(int inputFeatureSize, int outputFeatureSize,
+                    Tensor weight, Tensor bias,
+                    TensorUtil::QuantizationParams inputParams,
+                    Compute::GemmActivation activation =
+                        Compute::GemmActivation::None,
+                    float negativeSlope = 0.01f);
+    ~QuantizedLinear() override = default;
+
+    QuantizedLinear(const QuantizedLinear& linear) = default;
+    QuantizedLinear(QuantizedLinear&& linear) noexcept = default;
+    QuantizedLinear& operator=(const QuantizedLinear& linear) = default;
+    QuantizedLinear& operator=(QuantizedLinear&& linear) noexcept = default;
+
+    Tensor operator()(Tensor& x);
+
+private:
+    [[nodiscard]] int m_registerOutputTensor(
+        const TensorUtil::TensorDescriptor& xDesc) const;
+
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    int m_inputs;
+    int m_outputs;
+    TensorUtil::QuantizationParams m_inputParams;
+    Compute::GemmActivation m_activation;
+    float m_negativeSlope;
+    TensorUtil::QuantizedTensorData m_weight;
+    TensorUtil::TensorData m_bias;
+};
+} // namespace Sapphire::NN
+
+#endif
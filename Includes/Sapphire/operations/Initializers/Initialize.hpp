@@ -9,6 +9,8 @@
 #include <Sapphire/tensor/TensorData.hpp>
 #include <Sapphire/compute/Initialize.hpp>
 #include <Sapphire/Model.hpp>
+#include <cstdint>
+#include <optional>
 
 namespace Sapphire::Initialize
 {
@@ -78,6 +80,8 @@ private:
     float m_value;
 };
 
+//! Random initializers given a seed write the same data on every call
+//! Otherwise, they take new stream of the global seed (see Util::SetSeed)
 class Normal : public Initializer
 {
 public:
@@ -88,14 +92,58 @@ public:
     {
     }
 
+    Normal(float mean, float sd, std::uint64_t seed)
+        : Initializer(),
+          m_mean(mean),
+          m_sd(sd),
+          m_seed(seed)
+    {
+    }
+
     void operator()(TensorData& tensorData) override
     {
-        Compute::Initialize::Normal(tensorData, m_mean, m_sd);
+        if (m_seed)
+            Compute::Initialize::Normal(tensorData, m_mean, m_sd, *m_seed);
+        else
+            Compute::Initialize::Normal(tensorData, m_mean, m_sd);
     }
 
 private:
     float m_mean,
           m_sd;
+    std::optional<std::uint64_t> m_seed;
+};
+
+class Uniform : public Initializer
+{
+public:
+    Uniform(float min, float max)
+        : Initializer(),
+          m_min(min),
+          m_max(max)
+    {
+    }
+
+    Uniform(float min, float max, std::uint64_t seed)
+        : Initializer(),
+          m_min(min),
+          m_max(max),
+          m_seed(seed)
+    {
+    }
+
+    void operator()(TensorData& tensorData) override
+    {
+        if (m_seed)
+            Compute::Initialize::Uniform(tensorData, m_min, m_max, *m_seed);
+        else
+            Compute::Initialize::Uniform(tensorData, m_min, m_max);
+    }
+
+private:
+    float m_min,
+          m_max;
+    std::optional<std::uint64_t> m_seed;
 };
 
 class HeNormal : public Initializer
@@ -106,13 +154,23 @@ public:
     {
     }
 
+    HeNormal(int fanIn, std::uint64_t seed)
+        : m_fanIn(fanIn),
+          m_seed(seed)
+    {
+    }
+
     void operator()(TensorData& tensorData) override
     {
-        Compute::Initialize::HeNormal(tensorData, m_fanIn);
+        if (m_seed)
+            Compute::Initialize::HeNormal(tensorData, m_fanIn, *m_seed);
+        else
+            Compute::Initialize::HeNormal(tensorData, m_fanIn);
     }
 
 private:
     int m_fanIn;
+    std::optional<std::uint64_t> m_seed;
 };
 
 inline void Initialize(Tensor& tensor, std::unique_ptr<Initializer> initializer)
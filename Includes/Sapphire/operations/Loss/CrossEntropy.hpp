@@ -0,0 +1,26 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_CROSSENTROPY_HPP
+#define SAPPHIRE_CROSSENTROPY_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+
+namespace Sapphire::NN::Loss
+{
+//! Mean cross entropy between softmax of each row of logits (its last
+//! dimension) and the class given by label
+//! Softmax is fused into the loss, so neither probabilities nor one-hot
+//! labels are created. Computed on host
+//! \param label : class index of each row of input, stored as float values
+//! Throws std::invalid_argument if tensors are not on host or label does
+//! not have one element for each row, and std::out_of_range if a label is
+//! not a class of input
+[[maybe_unused]] Tensor CrossEntropy(const Tensor& input,
+                                     const Tensor& label);
+}
+
+#endif  // Sapphire_CROSSENTROPY_HPP
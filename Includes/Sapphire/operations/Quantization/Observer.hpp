@@ -0,0 +1,106 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_QUANTIZATION_OBSERVER_HPP
+#define SAPPHIRE_QUANTIZATION_OBSERVER_HPP
+
+#include <Sapphire/tensor/QuantizedTensorData.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::Quantization
+{
+using namespace TensorUtil;
+
+//! Records range of the values given while calibrating fp32 model, and
+//! chooses quantization params of the tensor from the recorded range
+//! Observers can be attached to units (e.g. NN::Linear::SetObserver) to
+//! record their inputs on every forward pass
+class Observer
+{
+public:
+    Observer() = default;
+    virtual ~Observer() = default;
+    Observer(const Observer& observer) = default;
+    Observer(Observer&& observer) noexcept = default;
+    Observer& operator=(const Observer& observer) = default;
+    Observer& operator=(Observer&& observer) noexcept = default;
+
+    //! Records data of x. Data on cuda is copied to host
+    void Observe(TensorData& x);
+
+    void Observe(const float* data, std::size_t size);
+
+    //! Number of values recorded since construction or last Reset
+    [[nodiscard]] std::size_t Count() const
+    {
+        return m_count;
+    }
+
+    //! Returns params that quantize the recorded range to given type
+    //! Throws std::runtime_error if nothing was recorded
+    [[nodiscard]] QuantizationParams GetParams(
+        QuantizedType type = QuantizedType::UInt8) const;
+
+    void Reset();
+
+protected:
+    virtual void m_observe(const float* data, std::size_t size) = 0;
+
+    //! Returns (min, max) of the range to be quantized
+    [[nodiscard]] virtual std::pair<float, float> m_range() const = 0;
+
+    virtual void m_reset() = 0;
+
+private:
+    std::size_t m_count = 0;
+};
+
+//! Quantizes the whole range of recorded values
+class MinMaxObserver : public Observer
+{
+protected:
+    void m_observe(const float* data, std::size_t size) override;
+    [[nodiscard]] std::pair<float, float> m_range() const override;
+    void m_reset() override;
+
+private:
+    float m_min = 0.0f;
+    float m_max = 0.0f;
+};
+
+//! Records histogram of the values, and quantizes the range that covers
+//! given fraction of them
+//! Clipping rare outliers keeps the resolution of the quantized values for
+//! the rest, which matters for activations with long tails
+class HistogramObserver : public Observer
+{
+public:
+    //! \param bins : number of bins of the histogram
+    //! \param coverage : fraction of the recorded values inside the chosen
+    //! range. Equal fraction of values is clipped from each tail
+    explicit HistogramObserver(int bins = 2048, float coverage = 0.9999f);
+
+protected:
+    void m_observe(const float* data, std::size_t size) override;
+    [[nodiscard]] std::pair<float, float> m_range() const override;
+    void m_reset() override;
+
+private:
+    //! Widens the range of the histogram to include [min, max], merging
+    //! recorded counts into the new bins
+    void m_extend(float min, float max);
+
+    float m_coverage;
+    float m_min = 0.0f;
+    float m_max = 0.0f;
+    std::vector<double> m_histogram;
+};
+} // namespace Sapphire::Quantization
+
+#endif
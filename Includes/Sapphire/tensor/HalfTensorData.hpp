@@ -0,0 +1,79 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TENSORUTIL_HALF_TENSOR_DATA_HPP
+#define SAPPHIRE_TENSORUTIL_HALF_TENSOR_DATA_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Sapphire::TensorUtil
+{
+//! Element type of HalfTensorData
+enum class HalfType
+{
+    //! IEEE half precision (5 bit exponent, 10 bit mantissa)
+    Float16,
+    //! bfloat16 (upper 16 bits of fp32, 8 bit exponent, 7 bit mantissa)
+    BFloat16,
+};
+
+//! Host tensor of 16-bit floats, stored as raw bits
+//! Takes half the memory and bandwidth of TensorData, and is computed by
+//! operations that convert it to fp32 on load and accumulate in fp32 (see
+//! compute/HalfOps.hpp)
+//! Unlike TensorData, data always resides on host and copies are deep
+class HalfTensorData
+{
+public:
+    HalfTensorData() = default;
+
+    //! Creates zero filled tensor
+    HalfTensorData(Shape shape, HalfType type);
+
+    //! Converts host data of x, rounding to nearest even
+    static HalfTensorData FromFloat(const TensorData& x, HalfType type,
+                                    int numThreads = 0);
+
+    //! Writes fp32 values to host data of y, which should have the same
+    //! number of elements. Conversion to fp32 is exact
+    void ToFloat(TensorData& y, int numThreads = 0) const;
+
+    [[nodiscard]] Shape GetShape() const
+    {
+        return m_shape;
+    }
+
+    [[nodiscard]] HalfType GetType() const
+    {
+        return m_type;
+    }
+
+    [[nodiscard]] bool IsBFloat16() const
+    {
+        return m_type == HalfType::BFloat16;
+    }
+
+    //! Getters for raw pointers
+    [[nodiscard]] const std::uint16_t* RawPtr() const
+    {
+        return m_data.data();
+    }
+
+    [[nodiscard]] std::uint16_t* MutableRawPtr()
+    {
+        return m_data.data();
+    }
+
+private:
+    Shape m_shape;
+    HalfType m_type = HalfType::Float16;
+    std::vector<std::uint16_t> m_data;
+};
+} // namespace Sapphire::TensorUtil
+
+#endif
@@ -0,0 +1,158 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TENSORUTIL_QUANTIZED_TENSOR_DATA_HPP
+#define SAPPHIRE_TENSORUTIL_QUANTIZED_TENSOR_DATA_HPP
+
+#include <Sapphire/compute/dense/naive/NaiveQuantizedGemm.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Sapphire::TensorUtil
+{
+//! Element type of QuantizedTensorData
+enum class QuantizedType
+{
+    Int8,
+    UInt8,
+};
+
+//! Maps quantized values to real values as
+//! real value = Scale * (quantized value - ZeroPoint)
+struct QuantizationParams
+{
+    float Scale = 1.0f;
+    std::int32_t ZeroPoint = 0;
+};
+
+//! Returns params that map [min, max] to the whole range of given type
+//! Range is extended to include zero, so that zero is represented exactly
+//! Int8 is quantized symmetrically (ZeroPoint is 0) over [-127, 127]
+QuantizationParams ChooseQuantizationParams(float min, float max,
+                                            QuantizedType type);
+
+//! Host tensor of 8-bit integers quantized from float tensor
+//! Tensor is quantized either per tensor, or per channel along single
+//! dimension with separate params for each channel
+//! Unlike TensorData, data always resides on host and copies are deep
+class QuantizedTensorData
+{
+public:
+    QuantizedTensorData() = default;
+
+    //! Creates zero filled tensor
+    //! \param params : params of each channel, or single params if
+    //! channelAxis is -1
+    //! \param channelAxis : dimension of the shape that channels are along,
+    //! or -1 if tensor is quantized per tensor
+    QuantizedTensorData(Shape shape, QuantizedType type,
+                        std::vector<QuantizationParams> params,
+                        int channelAxis = -1);
+
+    //! Quantizes host data of x per tensor with given params
+    static QuantizedTensorData Quantize(const TensorData& x,
+                                        QuantizedType type,
+                                        QuantizationParams params);
+
+    //! Quantizes host data of x per channel along channelAxis
+    //! Params of each channel are chosen from its min and max
+    static QuantizedTensorData QuantizePerChannel(const TensorData& x,
+                                                  QuantizedType type,
+                                                  int channelAxis);
+
+    //! Writes dequantized values to host data of y, which should have the
+    //! same number of elements
+    void Dequantize(TensorData& y) const;
+
+    [[nodiscard]] Shape GetShape() const
+    {
+        return m_shape;
+    }
+
+    [[nodiscard]] QuantizedType GetType() const
+    {
+        return m_type;
+    }
+
+    //! Returns dimension of the channels, or -1 if quantized per tensor
+    [[nodiscard]] int ChannelAxis() const
+    {
+        return m_channelAxis;
+    }
+
+    [[nodiscard]] int Channels() const
+    {
+        return static_cast<int>(m_scales.size());
+    }
+
+    [[nodiscard]] QuantizationParams GetParams(int channel) const
+    {
+        return { m_scales.at(channel), m_zeroPoints.at(channel) };
+    }
+
+    [[nodiscard]] const float* Scales() const
+    {
+        return m_scales.data();
+    }
+
+    [[nodiscard]] const std::int32_t* ZeroPoints() const
+    {
+        return m_zeroPoints.data();
+    }
+
+    //! Getters for raw pointers
+    //! Data should be accessed with the pointer of its type
+    [[nodiscard]] const std::int8_t* Int8RawPtr() const
+    {
+        return m_data.data();
+    }
+
+    [[nodiscard]] const std::uint8_t* UInt8RawPtr() const
+    {
+        return reinterpret_cast<const std::uint8_t*>(m_data.data());
+    }
+
+    [[nodiscard]] std::int8_t* Int8MutableRawPtr()
+    {
+        return m_data.data();
+    }
+
+    [[nodiscard]] std::uint8_t* UInt8MutableRawPtr()
+    {
+        return reinterpret_cast<std::uint8_t*>(m_data.data());
+    }
+
+    //! Packs Int8 matrix as (K x N) operand of int8 gemm, or (N x K) operand
+    //! if transposed is true
+    //! Data is viewed as matrix of At(0) rows, so that weights of shape
+    //! (outputs, inputs) and filters of shape (yC, xC, H, W) are packed with
+    //! one output channel per row
+    //! Packed operand is used by Compute::QuantizedGemm instead of packing
+    //! the data on every call. Should be called again if data is modified
+    void Prepack(bool transposed);
+
+    //! Returns operand packed by Prepack with given layout, or nullptr
+    [[nodiscard]] const Compute::Dense::Naive::PackedInt8Operand* Prepacked(
+        bool transposed) const;
+
+private:
+    Shape m_shape;
+    QuantizedType m_type = QuantizedType::Int8;
+    int m_channelAxis = -1;
+    std::vector<float> m_scales;
+    std::vector<std::int32_t> m_zeroPoints;
+    std::vector<std::int8_t> m_data;
+
+    //! Shared between copies, since packed data does not change
+    std::shared_ptr<const Compute::Dense::Naive::PackedInt8Operand>
+    m_prepacked;
+    bool m_prepackedTransposed = false;
+};
+} // namespace Sapphire::TensorUtil
+
+#endif
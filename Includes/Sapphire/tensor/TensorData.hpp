@@ -12,18 +12,27 @@
 #include <Sapphire/compute/sparse/SparseMatrix.hpp>
 #include <Sapphire/util/Shape.hpp>
 #include <Sapphire/util/CudaDevice.hpp>
+#include <Sapphire/util/DataType.hpp>
+#include <stdexcept>
 
 namespace Sapphire::TensorUtil
 {
+//! Elements are Float32 unless data type is given on construction
+//! Buffers are sized by the width of the data type, and data of other types
+//! should be accessed by the raw pointer getters of its type
 class TensorData
 {
 public:
     TensorData() = default;
     //! TensorData is defined only in Host Mode
     TensorData(Shape shape, Type type, bool preserve = false);
+    TensorData(Shape shape, Type type, DataType dataType,
+               bool preserve = false);
     //! TensorData is configured in both Host and Cuda Mode
     TensorData(Shape shape, Type type, CudaDevice device,
                bool preserve = false);
+    TensorData(Shape shape, Type type, CudaDevice device, DataType dataType,
+               bool preserve = false);
 
     TensorData(Shape shape, Type type, CudaDevice device,
                int parentDescKey, bool preserve = false);
@@ -39,6 +48,7 @@ public:
     unsigned long DenseTotalLengthCuda = 0;
     unsigned long SparseTotalLength = 0;
 
+    //! Data of other types than Float32 is converted from and to float
     [[nodiscard]] std::vector<float> GetDataCopy();
 
     void SetData(std::vector<float> data);
@@ -89,6 +99,18 @@ public:
         return m_type;
     }
 
+    //! Gets element type of the data
+    [[nodiscard]] DataType GetDataType() const
+    {
+        return m_dataType;
+    }
+
+    //! Gets size of single element in bytes
+    [[nodiscard]] std::size_t ElementSize() const
+    {
+        return DataTypeSize(m_dataType);
+    }
+
     [[nodiscard]] Shape GetShape() const
     {
         return m_shape;
@@ -118,6 +140,12 @@ public:
         return m_mode;
     }
 
+    //! Returns true if data is kept over iterations (e.g. weights)
+    [[nodiscard]] bool IsPreserved() const
+    {
+        return m_preserve;
+    }
+
     //! Transfers data to target cuda device from current device
     //! immediately returns false if change device is requested to same device
     //! This operation is available only on Cuda type tensorData
@@ -136,24 +164,66 @@ public:
 
 
     //!Getters for raw pointers
+    //! These are valid only for Float32 data, and throw
+    //! std::invalid_argument for other data types
     [[nodiscard]] const float* HostRawPtr() const
     {
-        return m_denseHost;
+        m_checkDataType<float>();
+        return static_cast<const float*>(m_denseHost);
     }
 
     [[nodiscard]] const float* CudaRawPtr() const
     {
-        return m_denseCuda;
+        m_checkDataType<float>();
+        return static_cast<const float*>(m_denseCuda);
     }
 
+    //! Packed copies of preserved data used by host gemm are invalidated,
+    //! since data may be modified through the returned pointer
     [[nodiscard]] float* HostMutableRawPtr() const
     {
-        return m_denseHost;
+        m_checkDataType<float>();
+        if (m_preserve)
+            m_invalidatePackedOperand();
+        return static_cast<float*>(m_denseHost);
     }
 
     [[nodiscard]] float* CudaMutableRawPtr() const
     {
-        return m_denseCuda;
+        m_checkDataType<float>();
+        return static_cast<float*>(m_denseCuda);
+    }
+
+    //! Getters for raw pointers of given element type
+    //! Throws std::invalid_argument if T does not match the data type
+    template <typename T>
+    [[nodiscard]] const T* HostRawPtr() const
+    {
+        m_checkDataType<T>();
+        return static_cast<const T*>(m_denseHost);
+    }
+
+    template <typename T>
+    [[nodiscard]] const T* CudaRawPtr() const
+    {
+        m_checkDataType<T>();
+        return static_cast<const T*>(m_denseCuda);
+    }
+
+    template <typename T>
+    [[nodiscard]] T* HostMutableRawPtr() const
+    {
+        m_checkDataType<T>();
+        if (m_preserve)
+            m_invalidatePackedOperand();
+        return static_cast<T*>(m_denseHost);
+    }
+
+    template <typename T>
+    [[nodiscard]] T* CudaMutableRawPtr() const
+    {
+        m_checkDataType<T>();
+        return static_cast<T*>(m_denseCuda);
     }
 
 
@@ -161,6 +231,19 @@ public:
     SparseMatrix* SparseMatCuda = nullptr;
 
 private:
+    template <typename T>
+    void m_checkDataType() const
+    {
+        if (DataTypeOf<T>::Value != m_dataType)
+            throw std::invalid_argument(
+                "TensorData - Data type mismatch. Data is " +
+                DataTypeToString(m_dataType) + ", requested : " +
+                DataTypeToString(DataTypeOf<T>::Value));
+    }
+
+    //! Removes packed copies of host data from the gemm operand cache
+    void m_invalidatePackedOperand() const;
+
     //! Copies data on the Host to Gpu
     //! Only available for Cuda tensors
     void m_toCuda();
@@ -176,15 +259,16 @@ private:
     void m_allocateCuda();
 
     Shape m_shape;
-    float* m_denseHost = nullptr;
-    float* m_denseCuda = nullptr;
+    void* m_denseHost = nullptr;
+    void* m_denseCuda = nullptr;
     int m_parentDescKey = -1;
 
     Type m_type = Type::Dense;
+    DataType m_dataType = DataType::Float32;
     DeviceType m_mode = DeviceType::Host;
 
     CudaDevice m_device;
-    bool m_preserve;
+    bool m_preserve = false;
 };
 } // namespace Sapphire::TensorUtil
 
@@ -0,0 +1,40 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_CPU_FEATURES_HPP
+#define SAPPHIRE_UTIL_CPU_FEATURES_HPP
+
+#include <string>
+
+namespace Sapphire::Util
+{
+//! Instruction set extensions available on the running CPU
+//! Each flag is set only if both CPU and operating system support it
+//! (e.g. AVX requires OS to save ymm registers on context switch)
+struct CpuFeatures
+{
+    bool Sse2 = false;
+    bool Sse41 = false;
+    bool Sse42 = false;
+    bool Avx = false;
+    bool Avx2 = false;
+    bool Fma = false;
+    bool F16c = false;
+    bool Avx512F = false;
+    bool Avx512Dq = false;
+    bool Avx512Bw = false;
+    bool Avx512Vl = false;
+    bool Avx512Vnni = false;
+    bool Avx512Bf16 = false;
+
+    [[nodiscard]] std::string ToString() const;
+};
+
+//! Queries cpuid once and returns cached result
+const CpuFeatures& GetCpuFeatures();
+} // namespace Sapphire::Util
+
+#endif
@@ -0,0 +1,123 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_DATA_TYPE_HPP
+#define SAPPHIRE_UTIL_DATA_TYPE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire
+{
+//! Element type of TensorData
+enum class DataType
+{
+    Float32,
+    Float64,
+    Int32,
+    Int8,
+    UInt8,
+    //! Stored as one byte per element, either 0 or 1
+    Bool,
+};
+
+//! Returns size of single element in bytes
+std::size_t DataTypeSize(DataType dataType);
+
+std::string DataTypeToString(DataType dataType);
+
+//! Returns true if elements of the type are integers (Bool is not)
+bool IsIntegral(DataType dataType);
+
+//! Maps C++ element type to DataType
+//! Only the types listed in DataType are defined
+template <typename T>
+struct DataTypeOf;
+
+template <>
+struct DataTypeOf<float>
+{
+    static constexpr DataType Value = DataType::Float32;
+};
+
+template <>
+struct DataTypeOf<double>
+{
+    static constexpr DataType Value = DataType::Float64;
+};
+
+template <>
+struct DataTypeOf<std::int32_t>
+{
+    static constexpr DataType Value = DataType::Int32;
+};
+
+template <>
+struct DataTypeOf<std::int8_t>
+{
+    static constexpr DataType Value = DataType::Int8;
+};
+
+template <>
+struct DataTypeOf<std::uint8_t>
+{
+    static constexpr DataType Value = DataType::UInt8;
+};
+
+template <>
+struct DataTypeOf<bool>
+{
+    static constexpr DataType Value = DataType::Bool;
+};
+
+//! Calls func with value initialized element of C++ type matching dataType,
+//! so that generic lambda can be instantiated for each element type
+//! e.g. DispatchDataType(type, [&](auto tag) { using T = decltype(tag); })
+template <typename Func>
+decltype(auto) DispatchDataType(DataType dataType, Func&& func)
+{
+    switch (dataType)
+    {
+    case DataType::Float32:
+        return func(float{});
+    case DataType::Float64:
+        return func(double{});
+    case DataType::Int32:
+        return func(std::int32_t{});
+    case DataType::Int8:
+        return func(std::int8_t{});
+    case DataType::UInt8:
+        return func(std::uint8_t{});
+    case DataType::Bool:
+        return func(bool{});
+    }
+    throw std::invalid_argument("DispatchDataType - Unknown data type");
+}
+
+//! Same as DispatchDataType, for integer types only
+//! Throws std::invalid_argument if dataType is not integral
+template <typename Func>
+decltype(auto) DispatchIntegralType(DataType dataType, Func&& func)
+{
+    switch (dataType)
+    {
+    case DataType::Int32:
+        return func(std::int32_t{});
+    case DataType::Int8:
+        return func(std::int8_t{});
+    case DataType::UInt8:
+        return func(std::uint8_t{});
+    default:
+        throw std::invalid_argument(
+            "DispatchIntegralType - " + DataTypeToString(dataType) +
+            " is not integral type");
+    }
+}
+} // namespace Sapphire
+
+#endif
@@ -0,0 +1,25 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_PARALLEL_HPP
+#define SAPPHIRE_UTIL_PARALLEL_HPP
+
+namespace Sapphire::Util
+{
+//! Sets number of threads used by host kernels
+//! \param numThreads : number of threads to use. If 0, number of threads is
+//! determined by OpenMP (OMP_NUM_THREADS or number of cores)
+void SetNumThreads(int numThreads);
+
+//! Returns number of threads used by host kernels
+int GetNumThreads();
+
+//! Returns numThreads if it is positive, or global setting otherwise
+//! Host kernels that accept per-call thread count use this to resolve it
+int ResolveNumThreads(int numThreads);
+} // namespace Sapphire::Util
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_RANDOM_HPP
+#define SAPPHIRE_UTIL_RANDOM_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace Sapphire::Util
+{
+//! Counter based random number generator Philox4x32-10 (Salmon et al.,
+//! "Parallel random numbers: as easy as 1, 2, 3")
+//! Returns 4 random 32 bit integers for given counter and key. Numbers
+//! depend only on counter and key, so any part of a sequence can be
+//! generated by any thread without generating the parts before it
+inline std::array<std::uint32_t, 4> Philox4x32(
+    std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key)
+{
+    constexpr std::uint64_t multiplier0 = 0xD2511F53;
+    constexpr std::uint64_t multiplier1 = 0xCD9E8D57;
+    constexpr std::uint32_t weyl0 = 0x9E3779B9;
+    constexpr std::uint32_t weyl1 = 0xBB67AE85;
+
+    for (int round = 0; round < 10; ++round)
+    {
+        const auto product0 = multiplier0 * counter[0];
+        const auto product1 = multiplier1 * counter[2];
+        counter = {
+            static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+            static_cast<std::uint32_t>(product1),
+            static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+            static_cast<std::uint32_t>(product0)
+        };
+        key[0] += weyl0;
+        key[1] += weyl1;
+    }
+    return counter;
+}
+
+//! Sequence of random numbers identified by a seed and a stream number
+//! Streams of the same seed are independent sequences
+struct RandomStream
+{
+    std::uint64_t Seed = 0;
+    std::uint64_t Stream = 0;
+
+    //! Returns index-th group of 4 random numbers of the sequence
+    [[nodiscard]] std::array<std::uint32_t, 4> Generate(
+        std::uint64_t index) const
+    {
+        return Philox4x32(
+            { static_cast<std::uint32_t>(index),
+              static_cast<std::uint32_t>(index >> 32),
+              static_cast<std::uint32_t>(Stream),
+              static_cast<std::uint32_t>(Stream >> 32) },
+            { static_cast<std::uint32_t>(Seed),
+              static_cast<std::uint32_t>(Seed >> 32) });
+    }
+};
+
+//! Sets global seed, and restarts streams returned by NextRandomStream
+//! Global seed is taken from std::random_device until this is called
+void SetSeed(std::uint64_t seed);
+
+//! Returns global seed
+std::uint64_t GetSeed();
+
+//! Returns next stream of global seed
+//! Random operations that are not given a seed take new stream on every
+//! call, so they give different numbers on each call, and the same numbers
+//! in the same order after SetSeed is called with the same seed
+RandomStream NextRandomStream();
+} // namespace Sapphire::Util
+
+#endif
@@ -0,0 +1,407 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/Basics/ElementwiseTest.hpp>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+#include <doctest.h>
+
+namespace Sapphire::Test
+{
+void ElementwiseBroadcastTest(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+    namespace Naive = Compute::Dense::Naive;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> normal(0.0f, 2.0f);
+    std::uniform_int_distribution<unsigned int> distribution(1, 100);
+
+    //! Large enough to be split over the threads
+    const unsigned int rows = distribution(gen) * 1000;
+    const auto defaultIsa = Naive::GetInstructionSet();
+
+    for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                            InstructionSet::Avx512 })
+    {
+        if (!Naive::IsSupported(isa))
+            continue;
+        Naive::SetInstructionSet(isa);
+
+        //! Scalar, short row that is tiled, and long row
+        for (const unsigned int stride : { 1u, distribution(gen) % 63 + 1,
+                                           distribution(gen) + 64 })
+        {
+            const auto totalSize = rows * stride / 100 + 3;
+            std::vector<float> full(totalSize), row(stride);
+            std::vector<float> y(totalSize), dy(totalSize);
+            std::vector<float> dFull(totalSize, 0.0f), dRow(stride, 0.0f);
+            for (auto& value : full)
+                value = normal(gen);
+            for (auto& value : row)
+                value = normal(gen);
+            for (auto& value : dy)
+                value = normal(gen);
+
+            if (print)
+                std::cout << Naive::InstructionSetToString(isa)
+                    << " size : " << totalSize << " stride : " << stride
+                    << std::endl;
+
+            Naive::Sub(totalSize, y.data(), row.data(), full.data(), stride,
+                       true, false);
+            for (unsigned int i = 0; i < totalSize; ++i)
+                CHECK(y[i] == row[i % stride] - full[i]);
+
+            Naive::Dot(totalSize, y.data(), full.data(), row.data(), stride,
+                       false, true);
+            for (unsigned int i = 0; i < totalSize; ++i)
+                CHECK(y[i] == full[i] * row[i % stride]);
+
+            Naive::DotBackward(totalSize, dFull.data(), dRow.data(),
+                               dy.data(), full.data(), row.data(), stride,
+                               false, true);
+            std::vector<double> expectedRow(stride, 0.0);
+            for (unsigned int i = 0; i < totalSize; ++i)
+            {
+                CHECK(dFull[i] ==
+                    doctest::Approx(dy[i] * row[i % stride]).epsilon(1e-5));
+                expectedRow[i % stride] +=
+                    static_cast<double>(dy[i]) * full[i];
+            }
+            for (unsigned int i = 0; i < stride; ++i)
+                CHECK(dRow[i] == doctest::Approx(expectedRow[i])
+                      .epsilon(1e-3));
+        }
+
+        std::vector<float> x(rows + 17), y(rows + 17);
+        for (auto& value : x)
+            value = normal(gen);
+        const auto size = static_cast<unsigned int>(x.size());
+
+        Naive::LeakyReLU(y.data(), x.data(), 0.1f, size);
+        for (unsigned int i = 0; i < size; ++i)
+            CHECK(y[i] == (x[i] > 0.0f ? x[i] : 0.1f * x[i]));
+
+        Naive::Pow(y.data(), x.data(), 2.0f, size);
+        for (unsigned int i = 0; i < size; ++i)
+            CHECK(y[i] == x[i] * x[i]);
+
+        Naive::Inverse(y.data(), x.data(), size);
+        for (unsigned int i = 0; i < size; ++i)
+            CHECK(y[i] == 1.0f / x[i]);
+    }
+
+    Naive::SetInstructionSet(defaultIsa);
+}
+
+void TranscendentalTest(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+    using Compute::Dense::Naive::MathPrecision;
+    namespace Naive = Compute::Dense::Naive;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> normal(0.0f, 10.0f);
+    std::uniform_real_distribution<float> uniform(-10000.0f, 10000.0f);
+    std::uniform_int_distribution<unsigned int> distribution(1, 100);
+
+    //! Arguments of trigonometric functions include large ones, which
+    //! accurate kernels reduce with libm
+    const unsigned int size = distribution(gen) * 1000 + 13;
+    std::vector<float> x(size), wide(size), y(size);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        x[i] = normal(gen);
+        wide[i] = i % 10 == 0 ? uniform(gen) : x[i];
+    }
+
+    //! Errors of kernels are a few ulp (see MathKernel.hpp)
+    const auto check = [&](double (*reference)(double), double epsilon)
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            const auto expected = reference(x[i]);
+            if (std::isnan(expected))
+                CHECK(std::isnan(y[i]));
+            else
+                CHECK(y[i] == doctest::Approx(expected).epsilon(epsilon)
+                      .scale(1e-30));
+        }
+    };
+
+    const auto defaultIsa = Naive::GetInstructionSet();
+    for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                            InstructionSet::Avx512 })
+    {
+        if (!Naive::IsSupported(isa))
+            continue;
+        Naive::SetInstructionSet(isa);
+
+        for (const auto precision :
+             { MathPrecision::Accurate, MathPrecision::Fast })
+        {
+            Naive::SetMathPrecision(precision);
+            if (print)
+                std::cout << Naive::InstructionSetToString(isa)
+                    << (precision == MathPrecision::Fast ? " fast"
+                                                         : " accurate")
+                    << " size : " << size << std::endl;
+
+            Naive::Exp(y.data(), x.data(), size);
+            check([](double v) { return std::exp(v); }, 1e-6);
+            Naive::log(y.data(), x.data(), size);
+            check([](double v) { return std::log(v); }, 1e-6);
+            Naive::log10(y.data(), x.data(), size);
+            check([](double v) { return std::log10(v); }, 1e-6);
+            Naive::Tanh(y.data(), x.data(), size);
+            check([](double v) { return std::tanh(v); }, 1e-6);
+            Naive::Sigmoid(y.data(), x.data(), size);
+            check([](double v) { return 1.0 / (1.0 + std::exp(-v)); }, 1e-6);
+            Naive::Sinh(y.data(), x.data(), size);
+            check([](double v) { return std::sinh(v); }, 1e-6);
+            Naive::Cosh(y.data(), x.data(), size);
+            check([](double v) { return std::cosh(v); }, 1e-6);
+
+            //! Absolute error of trigonometric functions is bounded instead,
+            //! since results near their zeros lose relative precision
+            Naive::Sin(y.data(), wide.data(), size);
+            for (unsigned int i = 0; i < size; ++i)
+                CHECK(y[i] == doctest::Approx(std::sin(
+                          static_cast<double>(wide[i]))).epsilon(1e-6));
+            Naive::Cos(y.data(), wide.data(), size);
+            for (unsigned int i = 0; i < size; ++i)
+                CHECK(y[i] == doctest::Approx(std::cos(
+                          static_cast<double>(wide[i]))).epsilon(1e-6));
+
+            //! Rows are long enough to exercise vector and remaining parts
+            const unsigned int unitSize = distribution(gen) + 7;
+            const unsigned int softmaxSize = size / unitSize * unitSize;
+            Naive::Softmax(y.data(), x.data(), softmaxSize, unitSize);
+            for (unsigned int rowIdx = 0; rowIdx < softmaxSize;
+                 rowIdx += unitSize)
+            {
+                double max = x[rowIdx], sum = 0.0;
+                for (unsigned int i = 0; i < unitSize; ++i)
+                    max = std::max(max, static_cast<double>(x[rowIdx + i]));
+                for (unsigned int i = 0; i < unitSize; ++i)
+                    sum += std::exp(x[rowIdx + i] - max);
+                for (unsigned int i = 0; i < unitSize; ++i)
+                    CHECK(y[rowIdx + i] ==
+                        doctest::Approx(std::exp(x[rowIdx + i] - max) / sum)
+                        .epsilon(1e-5).scale(1e-30));
+            }
+        }
+    }
+
+    Naive::SetMathPrecision(MathPrecision::Accurate);
+    Naive::SetInstructionSet(defaultIsa);
+}
+void TranscendentalBackwardTest(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+    using Compute::Dense::Naive::MathPrecision;
+    namespace Naive = Compute::Dense::Naive;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> normal(0.0f, 3.0f);
+    std::uniform_real_distribution<float> unit(-0.999f, 0.999f);
+    std::uniform_int_distribution<unsigned int> distribution(1, 100);
+
+    const unsigned int size = distribution(gen) * 1000 + 13;
+    std::vector<float> x(size), inside(size), above(size);
+    std::vector<float> y(size), dx(size), dy(size);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        x[i] = normal(gen);
+        //! Domains of acos, asin and atanh, and of acosh
+        inside[i] = unit(gen);
+        above[i] = 1.001f + std::fabs(normal(gen));
+        dy[i] = normal(gen);
+    }
+
+    const auto checkForward = [&](const std::vector<float>& input,
+                                  double (*reference)(double))
+    {
+        for (unsigned int i = 0; i < size; ++i)
+            CHECK(y[i] == doctest::Approx(reference(input[i]))
+                  .epsilon(1e-6));
+    };
+
+    //! Gradients are accumulated on dx initialized to one
+    const auto checkBackward =
+        [&](void (*backward)(float*, const float*, const float*,
+                             unsigned int),
+            const std::vector<float>& input, double (*derivative)(double))
+    {
+        std::fill(dx.begin(), dx.end(), 1.0f);
+        backward(dx.data(), dy.data(), input.data(), size);
+        for (unsigned int i = 0; i < size; ++i)
+            CHECK(dx[i] == doctest::Approx(1.0 + dy[i] * derivative(
+                               input[i])).epsilon(1e-5).scale(1.0));
+    };
+
+    const auto defaultIsa = Naive::GetInstructionSet();
+    for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                            InstructionSet::Avx512 })
+    {
+        if (!Naive::IsSupported(isa))
+            continue;
+        Naive::SetInstructionSet(isa);
+
+        for (const auto precision :
+             { MathPrecision::Accurate, MathPrecision::Fast })
+        {
+            Naive::SetMathPrecision(precision);
+            if (print)
+                std::cout << Naive::InstructionSetToString(isa)
+                    << (precision == MathPrecision::Fast ? " fast"
+                                                         : " accurate")
+                    << " size : " << size << std::endl;
+
+            Naive::ArcCos(y.data(), inside.data(), size);
+            checkForward(inside, [](double v) { return std::acos(v); });
+            Naive::ArcSin(y.data(), inside.data(), size);
+            checkForward(inside, [](double v) { return std::asin(v); });
+            Naive::ArcTan(y.data(), x.data(), size);
+            checkForward(x, [](double v) { return std::atan(v); });
+            Naive::ArcCosh(y.data(), above.data(), size);
+            checkForward(above, [](double v) { return std::acosh(v); });
+            Naive::ArcSinh(y.data(), x.data(), size);
+            checkForward(x, [](double v) { return std::asinh(v); });
+            Naive::ArcTanh(y.data(), inside.data(), size);
+            checkForward(inside, [](double v) { return std::atanh(v); });
+
+            checkBackward(Naive::CosBackward, x,
+                          [](double v) { return -std::sin(v); });
+            checkBackward(Naive::SinBackward, x,
+                          [](double v) { return std::cos(v); });
+            checkBackward(Naive::TanBackward, x, [](double v)
+            {
+                return 1.0 / (std::cos(v) * std::cos(v));
+            });
+            checkBackward(Naive::CoshBackward, x,
+                          [](double v) { return std::sinh(v); });
+            checkBackward(Naive::SinhBackward, x,
+                          [](double v) { return std::cosh(v); });
+            checkBackward(Naive::TanhBackward, x, [](double v)
+            {
+                return 1.0 / (std::cosh(v) * std::cosh(v));
+            });
+            checkBackward(Naive::ArcCosBackward, inside, [](double v)
+            {
+                return -1.0 / std::sqrt(1.0 - v * v);
+            });
+            checkBackward(Naive::ArcSinBackward, inside, [](double v)
+            {
+                return 1.0 / std::sqrt(1.0 - v * v);
+            });
+            checkBackward(Naive::ArcTanBackward, x,
+                          [](double v) { return 1.0 / (1.0 + v * v); });
+            checkBackward(Naive::ArcCoshBackward, above, [](double v)
+            {
+                return 1.0 / std::sqrt(v * v - 1.0);
+            });
+            checkBackward(Naive::ArcSinhBackward, x, [](double v)
+            {
+                return 1.0 / std::sqrt(v * v + 1.0);
+            });
+            checkBackward(Naive::ArcTanhBackward, inside,
+                          [](double v) { return 1.0 / (1.0 - v * v); });
+        }
+    }
+
+    Naive::SetMathPrecision(MathPrecision::Accurate);
+    Naive::SetInstructionSet(defaultIsa);
+}
+
+void SoftmaxTest(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+    namespace Naive = Compute::Dense::Naive;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> normal(0.0f, 30.0f);
+    std::uniform_int_distribution<unsigned int> distribution(1, 5000);
+
+    //! Second case masks prefix of the first row, longer than a block, with
+    //! -inf as masked logits are
+    for (const bool masked : { false, true })
+    {
+        //! Logits grow along the row, so the maximum is updated in later
+        //! blocks
+        const unsigned int unitSize =
+            masked ? 2048 + distribution(gen) % 1024 : distribution(gen);
+        const unsigned int rows = distribution(gen) % 8 + 1;
+        const unsigned int size = unitSize * rows;
+        const unsigned int maskSize =
+            masked ? 1024 + distribution(gen) % 1024 : 0;
+        std::vector<float> x(size), dy(size), y(size), dx(size);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            x[i] = i < maskSize
+                       ? -std::numeric_limits<float>::infinity()
+                       : normal(gen) + static_cast<float>(i % unitSize) *
+                         0.1f;
+            dy[i] = normal(gen) / 30.0f;
+        }
+
+        if (print)
+            std::cout << "rows : " << rows << " unitSize : " << unitSize
+                << " maskSize : " << maskSize << std::endl;
+
+        std::vector<double> expectedY(size), expectedDx(size);
+        for (unsigned int rowIdx = 0; rowIdx < size; rowIdx += unitSize)
+        {
+            double max = x[rowIdx], sum = 0.0, dot = 0.0;
+            for (unsigned int i = 0; i < unitSize; ++i)
+                max = std::max(max, static_cast<double>(x[rowIdx + i]));
+            for (unsigned int i = 0; i < unitSize; ++i)
+                sum += std::exp(x[rowIdx + i] - max);
+            for (unsigned int i = 0; i < unitSize; ++i)
+            {
+                expectedY[rowIdx + i] = std::exp(x[rowIdx + i] - max) / sum;
+                dot += dy[rowIdx + i] * expectedY[rowIdx + i];
+            }
+            //! Gradient is accumulated on 1
+            for (unsigned int i = 0; i < unitSize; ++i)
+                expectedDx[rowIdx + i] =
+                    1.0 + expectedY[rowIdx + i] * (dy[rowIdx + i] - dot);
+        }
+
+        const auto defaultIsa = Naive::GetInstructionSet();
+        for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                                InstructionSet::Avx512 })
+        {
+            if (!Naive::IsSupported(isa))
+                continue;
+            Naive::SetInstructionSet(isa);
+
+            Naive::Softmax(y.data(), x.data(), size, unitSize);
+            for (unsigned int i = 0; i < size; ++i)
+                CHECK(y[i] == doctest::Approx(expectedY[i]).epsilon(1e-5)
+                      .scale(1e-30));
+
+            std::fill(dx.begin(), dx.end(), 1.0f);
+            Naive::SoftmaxBackward(dx.data(), dy.data(), y.data(), size,
+                                   unitSize);
+            for (unsigned int i = 0; i < size; ++i)
+                CHECK(dx[i] == doctest::Approx(expectedDx[i]).epsilon(1e-5));
+        }
+        Naive::SetInstructionSet(defaultIsa);
+    }
+}
+} // namespace Sapphire::Test
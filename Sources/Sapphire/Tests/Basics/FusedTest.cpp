@@ -0,0 +1,96 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/Basics/FusedTest.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <doctest.h>
+
+namespace Sapphire::Test
+{
+void FusedExpressionTest(bool print)
+{
+    using namespace Compute::Fused;
+    using TensorUtil::TensorData;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> normal(0.0f, 2.0f);
+    std::uniform_int_distribution<int> distribution(1, 300);
+
+    //! Large enough to be split over the threads, with odd sizes so blocks
+    //! end in the middle of rows
+    const int batch = distribution(gen) % 4 + 1;
+    const int rows = distribution(gen) + 1;
+    const int cols = distribution(gen) + 2;
+
+    const auto makeTensor = [&](const Shape& shape)
+    {
+        TensorData data(shape, Type::Dense);
+        std::vector<float> values(shape.Size());
+        for (auto& value : values)
+            value = normal(gen);
+        data.SetData(values);
+        return data;
+    };
+
+    const Shape fullShape({ batch, rows, cols });
+    auto a = makeTensor(fullShape);
+    auto b = makeTensor(fullShape);
+    auto row = makeTensor(Shape({ cols }));
+    auto column = makeTensor(Shape({ rows, 1 }));
+    auto scalar = makeTensor(Shape({ 1 }));
+    TensorData y(fullShape, Type::Dense);
+
+    if (print)
+        std::cout << "shape : " << fullShape.ToString() << std::endl;
+
+    const auto va = a.GetDataCopy(), vb = b.GetDataCopy();
+    const auto vRow = row.GetDataCopy(), vColumn = column.GetDataCopy();
+    const auto vScalar = scalar.GetDataCopy()[0];
+    const auto size = static_cast<std::size_t>(fullShape.Size());
+    const auto rowOf = [&](std::size_t i) { return i / cols % rows; };
+
+    Assign(y, (Input(a) - Input(row)) * Input(column) + Input(scalar));
+    auto vy = y.GetDataCopy();
+    for (std::size_t i = 0; i < size; ++i)
+        CHECK(vy[i] == doctest::Approx((va[i] - vRow[i % cols]) *
+                                       vColumn[rowOf(i)] + vScalar));
+
+    Assign(y, ReLU(Input(a) * 0.5f - Input(b)) + 2.0f * Exp(Input(row)));
+    vy = y.GetDataCopy();
+    for (std::size_t i = 0; i < size; ++i)
+        CHECK(vy[i] == doctest::Approx(
+                  std::max(va[i] * 0.5f - vb[i], 0.0f) +
+                  2.0 * std::exp(static_cast<double>(vRow[i % cols])))
+              .epsilon(1e-5));
+
+    //! Output is also an input of the expression
+    TensorData z = a.CreateCopy();
+    Assign(z, Input(z) - Input(b) * 0.1f);
+    const auto vz = z.GetDataCopy();
+    for (std::size_t i = 0; i < size; ++i)
+        CHECK(vz[i] == doctest::Approx(va[i] - vb[i] * 0.1f));
+
+    TensorData mean(Shape({ 1 }), Type::Dense);
+    Mean(mean, Pow(Input(a) - Input(b), 2.0f));
+    double expected = 0.0;
+    for (std::size_t i = 0; i < size; ++i)
+        expected += (static_cast<double>(va[i]) - vb[i]) *
+            (static_cast<double>(va[i]) - vb[i]);
+    CHECK(mean.GetDataCopy()[0] ==
+        doctest::Approx(expected / static_cast<double>(size)).epsilon(1e-5));
+
+    TensorData wrongShape(Shape({ rows, cols + 1 }), Type::Dense);
+    CHECK_THROWS_AS(Assign(wrongShape, Input(a) + Input(b)),
+                    std::invalid_argument);
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,175 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/Basics/ReduceTest.hpp>
+#include <Sapphire/compute/ReduceOps.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+#include <doctest.h>
+
+namespace Sapphire::Test
+{
+void ReduceTest(bool print)
+{
+    using TensorUtil::TensorData;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> normal(3.0f, 2.0f);
+    std::uniform_int_distribution<int> distribution(1, 100);
+
+    const std::vector<int> shapeVector = { distribution(gen) % 5 + 1,
+                                           distribution(gen) + 1,
+                                           distribution(gen) + 1 };
+    const Shape xShape(shapeVector);
+    const auto size = static_cast<std::size_t>(xShape.Size());
+
+    //! Random non-empty subset of the axes, some of them given as negative
+    std::vector<int> axes;
+    std::vector<bool> reduced(3);
+    const auto mask = distribution(gen) % 7 + 1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        reduced[axis] = (mask >> axis & 1) != 0;
+        if (reduced[axis])
+            axes.emplace_back(distribution(gen) % 2 ? axis : axis - 3);
+    }
+    const bool keepDims = distribution(gen) % 2;
+    const auto yShape = Compute::ReducedShape(xShape, axes, keepDims);
+
+    if (print)
+        std::cout << "x : " << xShape.ToString() << " y : "
+            << yShape.ToString() << std::endl;
+
+    TensorData x(xShape, Type::Dense);
+    std::vector<float> vx(size);
+    for (auto& value : vx)
+        value = normal(gen);
+    x.SetData(vx);
+
+    //! Output index and index in reduced dimensions of each element of x
+    const auto outputSize = static_cast<std::size_t>(yShape.Size());
+    std::size_t reduceSize = 1;
+    for (int axis = 0; axis < 3; ++axis)
+        if (reduced[axis])
+            reduceSize *= shapeVector[axis];
+    const auto indexOf = [&](std::size_t i, bool reducedIndex)
+    {
+        std::size_t index = 0;
+        std::size_t rest = i;
+        std::size_t coords[3];
+        for (int axis = 2; axis >= 0; --axis)
+        {
+            coords[axis] = rest % shapeVector[axis];
+            rest /= shapeVector[axis];
+        }
+        for (int axis = 0; axis < 3; ++axis)
+            if (reduced[axis] == reducedIndex)
+                index = index * shapeVector[axis] + coords[axis];
+        return index;
+    };
+
+    std::vector<double> sum(outputSize, 0.0), squares(outputSize, 0.0);
+    std::vector<float> max(outputSize, -std::numeric_limits<float>::max());
+    std::vector<float> min(outputSize, std::numeric_limits<float>::max());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto output = indexOf(i, false);
+        sum[output] += vx[i];
+        max[output] = std::max(max[output], vx[i]);
+        min[output] = std::min(min[output], vx[i]);
+    }
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto output = indexOf(i, false);
+        const auto deviation =
+            vx[i] - sum[output] / static_cast<double>(reduceSize);
+        squares[output] += deviation * deviation;
+    }
+
+    TensorData y(yShape, Type::Dense);
+    Compute::Sum(y, x, axes);
+    auto vy = y.GetDataCopy();
+    for (std::size_t i = 0; i < outputSize; ++i)
+        CHECK(vy[i] == doctest::Approx(sum[i]).epsilon(1e-6));
+
+    Compute::Mean(y, x, axes);
+    vy = y.GetDataCopy();
+    for (std::size_t i = 0; i < outputSize; ++i)
+        CHECK(vy[i] == doctest::Approx(
+                  sum[i] / static_cast<double>(reduceSize)).epsilon(1e-6));
+
+    Compute::Max(y, x, axes);
+    vy = y.GetDataCopy();
+    for (std::size_t i = 0; i < outputSize; ++i)
+        CHECK(vy[i] == max[i]);
+
+    Compute::Min(y, x, axes);
+    vy = y.GetDataCopy();
+    for (std::size_t i = 0; i < outputSize; ++i)
+        CHECK(vy[i] == min[i]);
+
+    if (reduceSize > 1)
+    {
+        Compute::Var(y, x, axes, 1);
+        vy = y.GetDataCopy();
+        for (std::size_t i = 0; i < outputSize; ++i)
+            CHECK(vy[i] == doctest::Approx(
+                      squares[i] / static_cast<double>(reduceSize - 1))
+                  .epsilon(1e-5));
+    }
+
+    //! Mean backward broadcasts dy over reduced dimensions
+    TensorData dy(yShape, Type::Dense);
+    std::vector<float> vdy(outputSize);
+    for (auto& value : vdy)
+        value = normal(gen);
+    dy.SetData(vdy);
+    TensorData dx(xShape, Type::Dense);
+    dx.SetData(std::vector<float>(size, 1.0f));
+    Compute::MeanBackward(dx, dy, axes);
+    const auto vdx = dx.GetDataCopy();
+    for (std::size_t i = 0; i < size; ++i)
+        CHECK(vdx[i] == doctest::Approx(
+                  1.0f + vdy[indexOf(i, false)] /
+                  static_cast<float>(reduceSize)));
+
+    //! ArgMax over the last axis, where the maximum is repeated so that the
+    //! first index should be taken
+    const auto cols = shapeVector[2];
+    const auto rows = size / cols;
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        const auto argMax = static_cast<std::size_t>(distribution(gen)) %
+                            static_cast<std::size_t>(cols);
+        vx[row * cols + argMax] = 100.0f;
+        for (auto col = argMax + 1; col < static_cast<std::size_t>(cols);
+             col += 3)
+            vx[row * cols + col] = 100.0f;
+    }
+    x.SetData(vx);
+    TensorData indices(Compute::ReducedShape(xShape, { -1 }, false),
+                       Type::Dense, DataType::Int32);
+    Compute::ArgMax(indices, x, -1);
+    const auto vIndices = indices.GetDataCopy();
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        const auto begin = vx.begin() + static_cast<long>(row * cols);
+        CHECK(static_cast<long>(vIndices[row]) ==
+            std::max_element(begin, begin + cols) - begin);
+    }
+
+    TensorData wrongShape(Shape({ shapeVector[0] + 1 }), Type::Dense);
+    CHECK_THROWS_AS(Compute::Sum(wrongShape, x, { 1, 2 }),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(Compute::Sum(y, x, { 3 }), std::invalid_argument);
+}
+} // namespace Sapphire::Test
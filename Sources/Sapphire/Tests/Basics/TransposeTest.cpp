@@ -6,6 +6,8 @@
 
 #include <Sapphire/Tests/Basics/TransposeTest.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
 #include <Sapphire/compute/Initialize.hpp>
 #include <Sapphire/util/Shape.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
@@ -15,6 +17,8 @@
 #include <Sapphire/Model.hpp>
 #include <iostream>
 #include <random>
+#include <vector>
+#include <doctest.h>
 
 namespace Sapphire::Test
 {
@@ -73,4 +77,56 @@ void TransposeTest(bool printResult)
 
     delete[] cpuResult;
 }
+
+void TransposeHostTest(bool printResult)
+{
+    using Compute::Dense::Naive::InstructionSet;
+    namespace Naive = Compute::Dense::Naive;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<unsigned int> distribution(1, 200);
+    const auto defaultIsa = Naive::GetInstructionSet();
+
+    for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                            InstructionSet::Avx512 })
+    {
+        if (!Naive::IsSupported(isa))
+            continue;
+        Naive::SetInstructionSet(isa);
+
+        for (const bool broadcast : { false, true })
+        {
+            const auto rows = distribution(gen);
+            const auto cols = distribution(gen);
+            const auto batchSize = distribution(gen) % 4 + 1;
+            const auto matrixSize = rows * cols;
+
+            std::vector<float> input((broadcast ? 1 : batchSize) *
+                                     matrixSize);
+            std::vector<float> output(batchSize * matrixSize, 0.0f);
+            for (std::size_t i = 0; i < input.size(); ++i)
+                input[i] = static_cast<float>(i);
+
+            if (printResult)
+                std::cout << Naive::InstructionSetToString(isa) << " "
+                    << rows << "x" << cols << " batch : " << batchSize
+                    << " broadcast : " << broadcast << std::endl;
+
+            Naive::Transpose(output.data(), input.data(), rows, cols,
+                             batchSize, broadcast);
+            for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+            {
+                const auto* in = input.data() +
+                                 (broadcast ? 0 : batchIdx * matrixSize);
+                const auto* out = output.data() + batchIdx * matrixSize;
+                for (unsigned int i = 0; i < rows; ++i)
+                    for (unsigned int j = 0; j < cols; ++j)
+                        CHECK(out[j * rows + i] == in[i * cols + j]);
+            }
+        }
+    }
+
+    Naive::SetInstructionSet(defaultIsa);
+}
 }
@@ -14,6 +14,7 @@
 #include <Sapphire/Tests/TestUtil.hpp>
 #include <iostream>
 #include <random>
+#include <vector>
 
 namespace Sapphire::Test
 {
@@ -200,4 +201,88 @@ void BroadcastMixed(bool print)
 
     delete[] cpuGemmResult;
 }
+
+void BroadcastElementwiseOps(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distrib(1, 6);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+
+    const int dim = distrib(gen) % 5 + 1;
+    std::vector<int> outDims(dim), aDims(dim), bDims(dim);
+    for (int i = 0; i < dim; ++i)
+    {
+        outDims[i] = distrib(gen);
+        aDims[i] = distrib(gen) % 3 == 0 ? 1 : outDims[i];
+        bDims[i] = distrib(gen) % 3 == 0 ? 1 : outDims[i];
+    }
+    const Shape shapeA(aDims), shapeB(bDims), shapeOut(outDims);
+    if (print)
+        std::cout << "A : " << shapeA.ToString() << " B : "
+            << shapeB.ToString() << std::endl;
+
+    const CudaDevice cuda(0, "device0");
+    TensorUtil::TensorData A(shapeA, Type::Dense, cuda);
+    TensorUtil::TensorData B(shapeB, Type::Dense, cuda);
+    TensorUtil::TensorData Out(shapeOut, Type::Dense, cuda);
+    TensorUtil::TensorData dA(shapeA, Type::Dense, cuda);
+    TensorUtil::TensorData dB(shapeB, Type::Dense, cuda);
+    TensorUtil::TensorData dOut(shapeOut, Type::Dense, cuda);
+    for (auto* tensorData : { &A, &B, &Out, &dA, &dB, &dOut })
+        tensorData->SetMode(DeviceType::Host);
+
+    std::vector<float> a(shapeA.Size()), b(shapeB.Size());
+    std::vector<float> dy(shapeOut.Size());
+    for (auto* data : { &a, &b, &dy })
+        for (auto& value : *data)
+            value = normal(gen);
+    A.SetData(a);
+    B.SetData(b);
+    dOut.SetData(dy);
+    Compute::Initialize::Zeros(dA);
+    Compute::Initialize::Zeros(dB);
+
+    //! Offsets of A and B for each element of Out
+    std::vector<std::size_t> offsetA(shapeOut.Size()), offsetB(
+        shapeOut.Size());
+    for (int i = 0; i < shapeOut.Size(); ++i)
+    {
+        auto index = i;
+        std::size_t strideA = 1, strideB = 1;
+        for (int d = dim - 1; d >= 0; --d)
+        {
+            const auto idx = index % outDims[d];
+            index /= outDims[d];
+            offsetA[i] += (aDims[d] == 1 ? 0 : idx) * strideA;
+            offsetB[i] += (bDims[d] == 1 ? 0 : idx) * strideB;
+            strideA *= aDims[d];
+            strideB *= bDims[d];
+        }
+    }
+
+    Compute::Sub(Out, A, B);
+    auto result = Out.GetDataCopy();
+    for (int i = 0; i < shapeOut.Size(); ++i)
+        CHECK(result[i] == a[offsetA[i]] - b[offsetB[i]]);
+
+    Compute::Dot(Out, A, B);
+    result = Out.GetDataCopy();
+    for (int i = 0; i < shapeOut.Size(); ++i)
+        CHECK(result[i] == a[offsetA[i]] * b[offsetB[i]]);
+
+    Compute::DotBackward(dA, dB, dOut, A, B);
+    std::vector<double> expectedA(a.size(), 0.0), expectedB(b.size(), 0.0);
+    for (int i = 0; i < shapeOut.Size(); ++i)
+    {
+        expectedA[offsetA[i]] += static_cast<double>(dy[i]) * b[offsetB[i]];
+        expectedB[offsetB[i]] += static_cast<double>(dy[i]) * a[offsetA[i]];
+    }
+    const auto gradA = dA.GetDataCopy();
+    const auto gradB = dB.GetDataCopy();
+    for (std::size_t i = 0; i < a.size(); ++i)
+        CHECK(gradA[i] == doctest::Approx(expectedA[i]).epsilon(1e-4));
+    for (std::size_t i = 0; i < b.size(); ++i)
+        CHECK(gradB[i] == doctest::Approx(expectedB[i]).epsilon(1e-4));
+}
 } // namespace Sapphire::Test
@@ -9,6 +9,7 @@
 #include <Sapphire/compute/ConvolutionOps.hpp>
 #include <Sapphire/compute/dense/naive/Conv2D.hpp>
 #include <Sapphire/util/Shape.hpp>
+#include <cstdint>
 #include <iostream>
 #include <random>
 #include <vector>
@@ -336,6 +337,140 @@ void HostIm2ColTest(bool print)
                 << std::endl;
 }
 
+void HostIm2ColReferenceTest(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution dist(-10.0f, 10.0f);
+    std::uniform_int_distribution<> byteDist(0, 255);
+
+    //! { N, channels, inputRows, inputCols, filterRows, filterCols,
+    //! strideRow, strideCol, rowPadding, colPadding, dilationRow,
+    //! dilationCol }
+    //! Paddings wider than the filter leave whole rows and columns of the
+    //! input matrix padded, and the last shape moves enough elements to be
+    //! split over the threads
+    const int shapes[][12] = {
+        { 1, 2, 5, 5, 3, 3, 1, 1, 0, 0, 1, 1 },
+        { 2, 3, 7, 9, 3, 2, 2, 3, 2, 1, 2, 2 },
+        { 3, 1, 11, 6, 2, 3, 3, 2, 3, 4, 1, 2 },
+        { 2, 4, 8, 13, 4, 3, 2, 4, 1, 3, 2, 3 },
+        { 1, 1, 3, 3, 3, 3, 1, 1, 5, 5, 1, 1 },
+        { 4, 8, 40, 40, 3, 3, 1, 1, 1, 1, 1, 1 },
+    };
+    const float pad = -1.5f;
+    const std::uint8_t zeroPoint = 7;
+
+    for (const auto& shape : shapes)
+    {
+        const int N = shape[0], channels = shape[1];
+        const int inputRows = shape[2], inputCols = shape[3];
+        const int filterRows = shape[4], filterCols = shape[5];
+        const int strideRow = shape[6], strideCol = shape[7];
+        const int rowPadding = shape[8], colPadding = shape[9];
+        const int dilationRow = shape[10], dilationCol = shape[11];
+
+        const int outputRows = (inputRows + 2 * rowPadding -
+                                dilationRow * (filterRows - 1) - 1) /
+                               strideRow + 1;
+        const int outputCols = (inputCols + 2 * colPadding -
+                                dilationCol * (filterCols - 1) - 1) /
+                               strideCol + 1;
+        const int matrixRows = channels * filterRows * filterCols;
+        const int outputSize = outputRows * outputCols;
+
+        const Shape inputShape({ N, channels, inputRows, inputCols });
+        const Shape filterShape({ 1, channels, filterRows, filterCols });
+        const Shape matrixShape({ N, matrixRows, outputSize });
+
+        TensorUtil::TensorData x(inputShape, Type::Dense);
+        TensorUtil::TensorData dx(inputShape, Type::Dense);
+        TensorUtil::TensorData filter(filterShape, Type::Dense);
+        TensorUtil::TensorData matrix(matrixShape, Type::Dense);
+        TensorUtil::TensorData dMatrix(matrixShape, Type::Dense);
+
+        std::vector<std::uint8_t> quantizedX(x.Size());
+        std::vector<std::uint8_t> quantizedMatrix(matrix.Size());
+        for (int i = 0; i < x.Size(); ++i)
+        {
+            x.HostMutableRawPtr()[i] = dist(gen);
+            dx.HostMutableRawPtr()[i] = dist(gen);
+            quantizedX[i] = static_cast<std::uint8_t>(byteDist(gen));
+        }
+        for (int i = 0; i < dMatrix.Size(); ++i)
+            dMatrix.HostMutableRawPtr()[i] = dist(gen);
+
+        //! Filters are flipped, so that the last element of the filter is the
+        //! first row of the input matrix
+        std::vector<float> expectedMatrix(matrix.Size());
+        std::vector<std::uint8_t> expectedQuantizedMatrix(matrix.Size());
+        std::vector<float> expectedDx(dx.HostRawPtr(),
+                                      dx.HostRawPtr() + dx.Size());
+        for (int nIdx = 0; nIdx < N; ++nIdx)
+            for (int c = 0; c < channels; ++c)
+                for (int fr = 0; fr < filterRows; ++fr)
+                    for (int fc = 0; fc < filterCols; ++fc)
+                        for (int oRow = 0; oRow < outputRows; ++oRow)
+                            for (int oCol = 0; oCol < outputCols; ++oCol)
+                            {
+                                const int row = filterRows * filterCols *
+                                                (c + 1) -
+                                                (fr * filterCols + fc) - 1;
+                                const auto matrixIdx =
+                                    (static_cast<std::size_t>(nIdx) *
+                                     matrixRows + row) * outputSize +
+                                    oRow * outputCols + oCol;
+                                const int inputRow = oRow * strideRow +
+                                                     fr * dilationRow -
+                                                     rowPadding;
+                                const int inputCol = oCol * strideCol +
+                                                     fc * dilationCol -
+                                                     colPadding;
+                                if (inputRow < 0 || inputRow >= inputRows ||
+                                    inputCol < 0 || inputCol >= inputCols)
+                                {
+                                    expectedMatrix[matrixIdx] = pad;
+                                    expectedQuantizedMatrix[matrixIdx] =
+                                        zeroPoint;
+                                    continue;
+                                }
+                                const auto inputIdx =
+                                    ((static_cast<std::size_t>(nIdx) *
+                                      channels + c) * inputRows +
+                                     inputRow) * inputCols + inputCol;
+                                expectedMatrix[matrixIdx] =
+                                    x.HostRawPtr()[inputIdx];
+                                expectedQuantizedMatrix[matrixIdx] =
+                                    quantizedX[inputIdx];
+                                expectedDx[inputIdx] +=
+                                    dMatrix.HostRawPtr()[matrixIdx];
+                            }
+
+        Compute::Dense::Naive::Im2Col(matrix, filter, x, strideRow,
+                                      strideCol, rowPadding, colPadding,
+                                      dilationRow, dilationCol, pad);
+        CheckNoneZeroEquality(expectedMatrix.data(), matrix.HostRawPtr(),
+                              matrix.Size(), print, 0.0f);
+
+        Compute::Dense::Naive::Im2Col(quantizedMatrix.data(),
+                                      quantizedX.data(), inputShape,
+                                      filterRows, filterCols, strideRow,
+                                      strideCol, rowPadding, colPadding,
+                                      dilationRow, dilationCol, zeroPoint);
+        CheckNoneZeroEquality(expectedQuantizedMatrix.data(),
+                              quantizedMatrix.data(),
+                              static_cast<unsigned int>(
+                                  quantizedMatrix.size()),
+                              print, 0.0f);
+
+        Compute::Dense::Naive::Col2Im(dx, dMatrix, filter, strideCol,
+                                      strideRow, rowPadding, colPadding,
+                                      dilationRow, dilationCol);
+        CheckNoneZeroEquality(expectedDx.data(), dx.HostRawPtr(), dx.Size(),
+                              print, 1e-4f);
+    }
+}
+
 void HostConv2DTest(bool print)
 {
     std::random_device rd;
@@ -5,15 +5,29 @@
 // property of any third parties.
 
 #include <Sapphire/Tests/GemmTest.hpp>
+#include <Sapphire/compute/ActivationOps.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/HalfOps.hpp>
 #include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/QuantizedOps.hpp>
+#include <Sapphire/compute/dense/naive/GemmTuner.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
 #include <Sapphire/util/Shape.hpp>
+#include <Sapphire/tensor/HalfTensorData.hpp>
+#include <Sapphire/tensor/QuantizedTensorData.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
 #include <Sapphire/util/CudaDevice.hpp>
 #include <Sapphire/util/ResourceManager.hpp>
 #include <Sapphire/Tests/TestUtil.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <doctest.h>
 #include <iostream>
 #include <random>
+#include <string>
+#include <vector>
 
 namespace Sapphire::Test
 {
@@ -82,4 +96,780 @@ void Gemm1(bool print)
 
     delete[] cpuGemmResult;
 }
+
+void GemmReference(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+
+    //! Sizes are not multiples of MR and NR of any kernel, and cover edges
+    //! of MC, KC and NC blocks of default blocking
+    const int shapes[][3] = {
+        { 2, 3, 5 }, { 7, 9, 13 }, { 13, 17, 255 }, { 29, 33, 257 },
+        { 97, 47, 300 }, { 113, 31, 513 }, { 15, 2051, 19 },
+    };
+    const int batchSize = 2;
+    const float alpha = 0.5f, beta = 2.0f;
+
+    const auto defaultIsa = Compute::Dense::Naive::GetInstructionSet();
+
+    for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                            InstructionSet::Avx512 })
+    {
+        if (!Compute::Dense::Naive::IsSupported(isa))
+            continue;
+        Compute::Dense::Naive::SetInstructionSet(isa);
+
+        for (const auto& shape : shapes)
+            for (const bool transA : { false, true })
+                for (const bool transB : { false, true })
+                {
+                    const int M = shape[0], N = shape[1], K = shape[2];
+
+                    std::vector<float> A(batchSize * M * K);
+                    std::vector<float> B(batchSize * K * N);
+                    std::vector<float> out(batchSize * M * N);
+                    for (auto& value : A)
+                        value = distribution(gen);
+                    for (auto& value : B)
+                        value = distribution(gen);
+                    for (auto& value : out)
+                        value = distribution(gen);
+
+                    std::vector<float> expected(out);
+                    for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+                        for (int i = 0; i < M; ++i)
+                            for (int j = 0; j < N; ++j)
+                            {
+                                const float* a = A.data() + batchIdx * M * K;
+                                const float* b = B.data() + batchIdx * K * N;
+                                double sum = 0.0;
+                                for (int k = 0; k < K; ++k)
+                                    sum += static_cast<double>(
+                                               a[transA ? k * M + i
+                                                        : i * K + k]) *
+                                           b[transB ? j * K + k : k * N + j];
+                                auto& value =
+                                    expected[batchIdx * M * N + i * N + j];
+                                value = static_cast<float>(alpha * sum +
+                                                           beta * value);
+                            }
+
+                    Compute::Dense::Naive::Gemm(
+                        static_cast<unsigned int>(out.size()), out.data(),
+                        A.data(), B.data(), M, N, K, transA, transB, alpha,
+                        beta, 0);
+
+                    CheckNoneZeroEquality(expected.data(), out.data(),
+                                          static_cast<unsigned int>(
+                                              out.size()),
+                                          print, 1e-2f);
+                }
+    }
+
+    Compute::Dense::Naive::SetInstructionSet(defaultIsa);
+}
+
+void GemmInstructionSets(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 100);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+    const int batchSize = distribution(gen) % 30 + 1;
+
+    const Shape shapeA({ batchSize, M, K });
+    const Shape shapeB({ batchSize, K, N });
+    const Shape shapeOut({ batchSize, M, N });
+
+    const CudaDevice cuda(0, "device0");
+
+    TensorUtil::TensorData A(shapeA, Type::Dense, cuda);
+    TensorUtil::TensorData B(shapeB, Type::Dense, cuda);
+    TensorUtil::TensorData Out(shapeOut, Type::Dense, cuda);
+
+    A.SetMode(DeviceType::Host);
+    B.SetMode(DeviceType::Host);
+    Out.SetMode(DeviceType::Host);
+
+    Compute::Initialize::Normal(A, 10, 5);
+    Compute::Initialize::Normal(B, 10, 5);
+
+    const auto defaultIsa = Compute::Dense::Naive::GetInstructionSet();
+
+    //! Baseline kernels are always available
+    Compute::Dense::Naive::SetInstructionSet(InstructionSet::Sse);
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, A, B);
+
+    auto* baseResult = new float[Out.HostTotalSize];
+    std::memcpy(baseResult, Out.HostRawPtr(),
+                Out.HostTotalSize * sizeof(float));
+
+    for (const auto isa : { InstructionSet::Avx2, InstructionSet::Avx512 })
+    {
+        if (!Compute::Dense::Naive::IsSupported(isa))
+            continue;
+
+        std::cout << "Checking "
+            << Compute::Dense::Naive::InstructionSetToString(isa)
+            << std::endl;
+
+        Compute::Dense::Naive::SetInstructionSet(isa);
+        Compute::Initialize::Zeros(Out);
+        Compute::Gemm(Out, A, B);
+
+        CheckNoneZeroEquality(baseResult, Out.HostRawPtr(),
+                              Out.HostTotalSize, print, 2.0f);
+    }
+
+    Compute::Dense::Naive::SetInstructionSet(defaultIsa);
+    delete[] baseResult;
+}
+
+void GemmMultiThread(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 200);
+
+    //! Small batch exercises tile parallelism, large batch exercises batch
+    //! parallelism
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+    const int batchSize = distribution(gen) % 2 == 0
+                              ? 1
+                              : distribution(gen) % 30 + 1;
+
+    const Shape shapeA({ batchSize, M, K });
+    const Shape shapeB({ batchSize, K, N });
+    const Shape shapeOut({ batchSize, M, N });
+
+    const CudaDevice cuda(0, "device0");
+
+    TensorUtil::TensorData A(shapeA, Type::Dense, cuda);
+    TensorUtil::TensorData B(shapeB, Type::Dense, cuda);
+    TensorUtil::TensorData Out(shapeOut, Type::Dense, cuda);
+
+    A.SetMode(DeviceType::Host);
+    B.SetMode(DeviceType::Host);
+    Out.SetMode(DeviceType::Host);
+
+    Compute::Initialize::Normal(A, 10, 5);
+    Compute::Initialize::Normal(B, 10, 5);
+
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, A, B, false, false, 1.0f, 1.0f, 1);
+
+    auto* singleThreadResult = new float[Out.HostTotalSize];
+    std::memcpy(singleThreadResult, Out.HostRawPtr(),
+                Out.HostTotalSize * sizeof(float));
+
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, A, B, false, false, 1.0f, 1.0f, 7);
+
+    CheckNoneZeroEquality(singleThreadResult, Out.HostRawPtr(),
+                          Out.HostTotalSize, print, 0.0f);
+
+    delete[] singleThreadResult;
+}
+
+void GemmTranspose(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 100);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+    const int batchSize = distribution(gen) % 10 + 1;
+
+    const CudaDevice cuda(0, "device0");
+
+    //! A is stored as (K x M) and B is stored as (N x K)
+    TensorUtil::TensorData A(Shape({ batchSize, K, M }), Type::Dense, cuda);
+    TensorUtil::TensorData B(Shape({ batchSize, N, K }), Type::Dense, cuda);
+    TensorUtil::TensorData transposedA(Shape({ batchSize, M, K }), Type::Dense,
+                                       cuda);
+    TensorUtil::TensorData transposedB(Shape({ batchSize, K, N }), Type::Dense,
+                                       cuda);
+    TensorUtil::TensorData Out(Shape({ batchSize, M, N }), Type::Dense, cuda);
+
+    A.SetMode(DeviceType::Host);
+    B.SetMode(DeviceType::Host);
+    transposedA.SetMode(DeviceType::Host);
+    transposedB.SetMode(DeviceType::Host);
+    Out.SetMode(DeviceType::Host);
+
+    Compute::Initialize::Normal(A, 10, 5);
+    Compute::Initialize::Normal(B, 10, 5);
+    Compute::Transpose(transposedA, A);
+    Compute::Transpose(transposedB, B);
+
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, transposedA, transposedB);
+
+    auto* expected = new float[Out.HostTotalSize];
+    std::memcpy(expected, Out.HostRawPtr(),
+                Out.HostTotalSize * sizeof(float));
+
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, A, B, true, true);
+    CheckNoneZeroEquality(expected, Out.HostRawPtr(), Out.HostTotalSize,
+                          print, 2.0f);
+
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, transposedA, B, false, true);
+    CheckNoneZeroEquality(expected, Out.HostRawPtr(), Out.HostTotalSize,
+                          print, 2.0f);
+
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, A, transposedB, true, false);
+    CheckNoneZeroEquality(expected, Out.HostRawPtr(), Out.HostTotalSize,
+                          print, 2.0f);
+
+    delete[] expected;
+}
+
+void GemmAlphaBeta(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 100);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+    const int batchSize = distribution(gen) % 10 + 1;
+    const float alpha = 0.5f;
+    const float beta = 2.0f;
+
+    const Shape shapeA({ batchSize, M, K });
+    const Shape shapeB({ batchSize, K, N });
+    const Shape shapeOut({ batchSize, M, N });
+
+    const CudaDevice cuda(0, "device0");
+
+    TensorUtil::TensorData A(shapeA, Type::Dense, cuda);
+    TensorUtil::TensorData B(shapeB, Type::Dense, cuda);
+    TensorUtil::TensorData C(shapeOut, Type::Dense, cuda);
+    TensorUtil::TensorData Out(shapeOut, Type::Dense, cuda);
+    TensorUtil::TensorData Expected(shapeOut, Type::Dense, cuda);
+
+    A.SetMode(DeviceType::Host);
+    B.SetMode(DeviceType::Host);
+    C.SetMode(DeviceType::Host);
+    Out.SetMode(DeviceType::Host);
+    Expected.SetMode(DeviceType::Host);
+
+    Compute::Initialize::Normal(A, 10, 5);
+    Compute::Initialize::Normal(B, 10, 5);
+    Compute::Initialize::Normal(C, 10, 5);
+
+    //! Expected = alpha * A * B + beta * C
+    Compute::Initialize::Zeros(Expected);
+    Compute::Gemm(Expected, A, B);
+    Compute::Scale(Expected, Expected, alpha);
+    Compute::Scale(Out, C, beta);
+    Compute::Add(Expected, Expected, Out);
+
+    Compute::Scale(Out, C, 1.0f);
+    Compute::Gemm(Out, A, B, false, false, alpha, beta);
+    CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                          Out.HostTotalSize, print, 1.0f);
+
+    //! Out is not read if beta is zero
+    Compute::Initialize::Zeros(Expected);
+    Compute::Gemm(Expected, A, B, false, false, alpha, 1.0f);
+    Compute::Initialize::Normal(Out, 10, 5);
+    Compute::Gemm(Out, A, B, false, false, alpha, 0.0f);
+    CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                          Out.HostTotalSize, print, 1.0f);
+}
+
+void GemmBiasActivation(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 100);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+    const int batchSize = distribution(gen) % 10 + 1;
+    const float negativeSlope = 0.1f;
+
+    //! B is laid out as (N x K), same as weight of the linear layer
+    const Shape shapeA({ batchSize, M, K });
+    const Shape shapeB({ N, K });
+    const Shape shapeBias({ 1, N });
+    const Shape shapeOut({ batchSize, M, N });
+
+    const CudaDevice cuda(0, "device0");
+
+    TensorUtil::TensorData A(shapeA, Type::Dense, cuda);
+    TensorUtil::TensorData B(shapeB, Type::Dense, cuda);
+    TensorUtil::TensorData Bias(shapeBias, Type::Dense, cuda);
+    TensorUtil::TensorData Out(shapeOut, Type::Dense, cuda);
+    TensorUtil::TensorData Expected(shapeOut, Type::Dense, cuda);
+
+    A.SetMode(DeviceType::Host);
+    B.SetMode(DeviceType::Host);
+    Bias.SetMode(DeviceType::Host);
+    Out.SetMode(DeviceType::Host);
+    Expected.SetMode(DeviceType::Host);
+
+    Compute::Initialize::Normal(A, 0, 5);
+    Compute::Initialize::Normal(B, 0, 5);
+    Compute::Initialize::Normal(Bias, 0, 50);
+
+    const auto activations = { Compute::GemmActivation::None,
+                               Compute::GemmActivation::ReLU,
+                               Compute::GemmActivation::LeakyReLU };
+    for (const auto activation : activations)
+    {
+        //! Expected = activation(A * B^T + Bias)
+        Compute::Gemm(Expected, A, B, false, true, 1.0f, 0.0f);
+        Compute::Add(Expected, Expected, Bias);
+        if (activation == Compute::GemmActivation::ReLU)
+            Compute::ReLU(Expected, Expected);
+        else if (activation == Compute::GemmActivation::LeakyReLU)
+            Compute::LeakyReLU(Expected, Expected, negativeSlope);
+
+        //! Out is not read
+        Compute::Initialize::Normal(Out, 10, 5);
+        Compute::GemmBiasActivation(Out, A, B, Bias, false, true, activation,
+                                    negativeSlope);
+        CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                              Out.HostTotalSize, print, 1.0f);
+    }
+}
+
+void GemvCorrectness(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 500);
+
+    const int K = distribution(gen);
+    const int length = distribution(gen);
+    const int batchSize = distribution(gen) % 4 + 1;
+
+    const CudaDevice cuda(0, "device0");
+
+    for (const bool vectorIsA : { true, false })
+        for (const bool transpose : { false, true })
+        {
+            const int M = vectorIsA ? 1 : length;
+            const int N = vectorIsA ? length : 1;
+            const bool transA = !vectorIsA && transpose;
+            const bool transB = vectorIsA && transpose;
+
+            const Shape shapeA = transA ? Shape({ batchSize, K, M })
+                                        : Shape({ batchSize, M, K });
+            const Shape shapeB = transB ? Shape({ batchSize, N, K })
+                                        : Shape({ batchSize, K, N });
+            const Shape shapeOut({ batchSize, M, N });
+
+            TensorUtil::TensorData A(shapeA, Type::Dense, cuda);
+            TensorUtil::TensorData B(shapeB, Type::Dense, cuda);
+            TensorUtil::TensorData Out(shapeOut, Type::Dense, cuda);
+            TensorUtil::TensorData Expected(shapeOut, Type::Dense, cuda);
+
+            A.SetMode(DeviceType::Host);
+            B.SetMode(DeviceType::Host);
+            Out.SetMode(DeviceType::Host);
+            Expected.SetMode(DeviceType::Host);
+
+            Compute::Initialize::Normal(A, 10, 5);
+            Compute::Initialize::Normal(B, 10, 5);
+
+            Compute::Dense::Naive::Gemm(
+                Expected.HostTotalSize, Expected.HostMutableRawPtr(),
+                A.HostRawPtr(), B.HostRawPtr(), M, N, K, transA, transB, 1.0f,
+                0.0f, 0);
+            Compute::Gemm(Out, A, B, transA, transB, 1.0f, 0.0f);
+
+            CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                                  Out.HostTotalSize, print, 1.0f);
+        }
+}
+
+void GemmSmallBatched(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> sizeDistribution(0, 3);
+    std::uniform_int_distribution<> batchDistribution(1, 300);
+
+    const int sizes[] = { 4, 8, 16, 32 };
+    const int M = sizes[sizeDistribution(gen)];
+    const int N = sizes[sizeDistribution(gen)];
+    const int K = sizes[sizeDistribution(gen)];
+    const int batchSize = batchDistribution(gen);
+
+    const CudaDevice cuda(0, "device0");
+
+    for (const bool transA : { false, true })
+        for (const bool transB : { false, true })
+        {
+            const Shape shapeA = transA ? Shape({ batchSize, K, M })
+                                        : Shape({ batchSize, M, K });
+            const Shape shapeB = transB ? Shape({ batchSize, N, K })
+                                        : Shape({ batchSize, K, N });
+            const Shape shapeOut({ batchSize, M, N });
+
+            TensorUtil::TensorData A(shapeA, Type::Dense, cuda);
+            TensorUtil::TensorData B(shapeB, Type::Dense, cuda);
+            TensorUtil::TensorData Out(shapeOut, Type::Dense, cuda);
+
+            A.SetMode(DeviceType::Host);
+            B.SetMode(DeviceType::Host);
+            Out.SetMode(DeviceType::Host);
+
+            Compute::Initialize::Normal(A, 10, 5);
+            Compute::Initialize::Normal(B, 10, 5);
+            Compute::Initialize::Normal(Out, 10, 5);
+
+            const float alpha = 0.5f, beta = 2.0f;
+            const float* a = A.HostRawPtr();
+            const float* b = B.HostRawPtr();
+            std::vector<float> expected(Out.HostRawPtr(),
+                                        Out.HostRawPtr() + Out.HostTotalSize);
+            for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+                for (int i = 0; i < M; ++i)
+                    for (int j = 0; j < N; ++j)
+                    {
+                        const auto offsetA = batchIdx * M * K;
+                        const auto offsetB = batchIdx * K * N;
+                        float sum = 0.0f;
+                        for (int k = 0; k < K; ++k)
+                            sum += a[offsetA +
+                                     (transA ? k * M + i : i * K + k)] *
+                                   b[offsetB +
+                                     (transB ? j * K + k : k * N + j)];
+                        auto& value = expected[batchIdx * M * N + i * N + j];
+                        value = alpha * sum + beta * value;
+                    }
+
+            Compute::Dense::Naive::Gemm(
+                Out.HostTotalSize, Out.HostMutableRawPtr(), A.HostRawPtr(),
+                B.HostRawPtr(), M, N, K, transA, transB, alpha, beta, 0);
+
+            CheckNoneZeroEquality(expected.data(), Out.HostRawPtr(),
+                                  Out.HostTotalSize, print, 1.0f);
+        }
+}
+
+void GemmPackedCache(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(2, 300);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen) * 4;
+    const int K = distribution(gen);
+    //! Matrices of batched weight after the first one are cached with
+    //! pointers inside the buffer
+    const int batchSize = 2;
+
+    const CudaDevice cuda(0, "device0");
+
+    for (const bool transB : { false, true })
+    {
+        const Shape shapeB = transB ? Shape({ batchSize, N, K })
+                                    : Shape({ batchSize, K, N });
+        TensorUtil::TensorData A(Shape({ batchSize, M, K }), Type::Dense,
+                                 cuda);
+        TensorUtil::TensorData weight(shapeB, Type::Dense, cuda, true);
+        TensorUtil::TensorData copy(shapeB, Type::Dense, cuda);
+        TensorUtil::TensorData Out(Shape({ batchSize, M, N }), Type::Dense,
+                                   cuda);
+        TensorUtil::TensorData Expected(Shape({ batchSize, M, N }),
+                                        Type::Dense, cuda);
+
+        A.SetMode(DeviceType::Host);
+        weight.SetMode(DeviceType::Host);
+        copy.SetMode(DeviceType::Host);
+        Out.SetMode(DeviceType::Host);
+        Expected.SetMode(DeviceType::Host);
+
+        Compute::Initialize::Normal(A, 10, 5);
+
+        //! Second product with the same weight reads the cached operand, and
+        //! the others should see the data written in between by SetData,
+        //! initializer and compute operation
+        for (int iteration = 0; iteration < 4; ++iteration)
+        {
+            if (iteration == 0)
+            {
+                Compute::Initialize::Normal(copy, 10, 5);
+                weight.SetData(copy.GetDataCopy());
+            }
+            else if (iteration == 2)
+            {
+                Compute::Initialize::Normal(weight, 10, 5);
+                TensorUtil::TensorData::DeepCopy(copy, weight);
+            }
+            else if (iteration == 3)
+            {
+                Compute::Scale(weight, weight, 0.5f);
+                Compute::Scale(copy, copy, 0.5f);
+            }
+
+            Compute::Gemm(Out, A, weight, false, transB, 1.0f, 0.0f);
+            Compute::Gemm(Expected, A, copy, false, transB, 1.0f, 0.0f);
+
+            CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                                  Out.HostTotalSize, print, 1.0f);
+        }
+    }
+}
+
+void GemmAutotune(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(64, 300);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+    const int batchSize = distribution(gen) % 3 + 1;
+
+    const CudaDevice cuda(0, "device0");
+    TensorUtil::TensorData A(Shape({ batchSize, M, K }), Type::Dense, cuda);
+    TensorUtil::TensorData B(Shape({ batchSize, K, N }), Type::Dense, cuda);
+    TensorUtil::TensorData Out(Shape({ batchSize, M, N }), Type::Dense, cuda);
+    TensorUtil::TensorData Expected(Shape({ batchSize, M, N }), Type::Dense,
+                                    cuda);
+
+    A.SetMode(DeviceType::Host);
+    B.SetMode(DeviceType::Host);
+    Out.SetMode(DeviceType::Host);
+    Expected.SetMode(DeviceType::Host);
+
+    Compute::Initialize::Normal(A, 10, 5);
+    Compute::Initialize::Normal(B, 10, 5);
+
+    Compute::Dense::Naive::ClearGemmTunings();
+    Compute::Gemm(Expected, A, B, false, false, 1.0f, 0.0f);
+
+    //! First call searches the tuning, and second one uses stored one
+    Compute::Dense::Naive::SetGemmAutotune(true);
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        Compute::Gemm(Out, A, B, false, false, 1.0f, 0.0f);
+        CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                              Out.HostTotalSize, print, 1.0f);
+    }
+    Compute::Dense::Naive::SetGemmAutotune(false);
+
+    const std::string path = "GemmTuningTest.txt";
+    Compute::Dense::Naive::SaveGemmTuningFile(path);
+    Compute::Dense::Naive::ClearGemmTunings();
+    CHECK(Compute::Dense::Naive::LoadGemmTuningFile(path));
+    std::remove(path.c_str());
+
+    Compute::Gemm(Out, A, B, false, false, 1.0f, 0.0f);
+    CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                          Out.HostTotalSize, print, 1.0f);
+    Compute::Dense::Naive::ClearGemmTunings();
+}
+
+void QuantizedGemm(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 300);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+
+    TensorUtil::TensorData x(Shape({ M, K }), Type::Dense);
+    TensorUtil::TensorData weight(Shape({ N, K }), Type::Dense);
+    TensorUtil::TensorData bias(Shape({ 1, N }), Type::Dense);
+    TensorUtil::TensorData Out(Shape({ M, N }), Type::Dense);
+    TensorUtil::TensorData Expected(Shape({ M, N }), Type::Dense);
+
+    Compute::Initialize::Normal(x, 1, 2);
+    Compute::Initialize::Normal(weight, 0, 1);
+    Compute::Initialize::Normal(bias, 0, 1);
+
+    const auto data = x.GetDataCopy();
+    const auto [lowest, highest] =
+        std::minmax_element(data.begin(), data.end());
+    const auto a = TensorUtil::QuantizedTensorData::Quantize(
+        x, TensorUtil::QuantizedType::UInt8,
+        TensorUtil::ChooseQuantizationParams(*lowest, *highest,
+                                             TensorUtil::QuantizedType::UInt8));
+    auto b = TensorUtil::QuantizedTensorData::QuantizePerChannel(
+        weight, TensorUtil::QuantizedType::Int8, 0);
+
+    //! Quantization error is removed from the expected result by computing it
+    //! from the dequantized operands
+    a.Dequantize(x);
+    b.Dequantize(weight);
+    Compute::GemmBiasActivation(Expected, x, weight, bias, false, true,
+                                Compute::GemmActivation::ReLU);
+
+    const auto outParams = TensorUtil::ChooseQuantizationParams(
+        0.0f, 10.0f, TensorUtil::QuantizedType::UInt8);
+    const auto expectedQuantized = TensorUtil::QuantizedTensorData::Quantize(
+        Expected, TensorUtil::QuantizedType::UInt8, outParams);
+    TensorUtil::QuantizedTensorData outQuantized(
+        Shape({ M, N }), TensorUtil::QuantizedType::UInt8, { outParams });
+
+    const auto defaultIsa = Compute::Dense::Naive::GetInstructionSet();
+    for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                            InstructionSet::Avx512 })
+    {
+        if (!Compute::Dense::Naive::IsSupported(isa))
+            continue;
+        Compute::Dense::Naive::SetInstructionSet(isa);
+
+        //! Operand is packed on the call first, and prepacked one is used
+        //! afterwards
+        for (int iteration = 0; iteration < 2; ++iteration)
+        {
+            if (iteration == 1)
+                b.Prepack(true);
+
+            Compute::QuantizedGemmBiasActivation(
+                Out, a, b, bias, true, Compute::GemmActivation::ReLU);
+            CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                                  Out.HostTotalSize, print, 0.01f);
+
+            //! Requantized values can differ by rounding of values near the
+            //! middle of two steps
+            Compute::QuantizedGemmBiasActivation(
+                outQuantized, a, b, bias, true, Compute::GemmActivation::ReLU);
+            CheckNoneZeroEquality(expectedQuantized.UInt8RawPtr(),
+                                  outQuantized.UInt8RawPtr(),
+                                  Out.HostTotalSize, print, 1.0f);
+        }
+    }
+    Compute::Dense::Naive::SetInstructionSet(defaultIsa);
+}
+
+void HalfGemm(bool print)
+{
+    using Compute::Dense::Naive::InstructionSet;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 300);
+
+    const int M = distribution(gen);
+    const int N = distribution(gen);
+    const int K = distribution(gen);
+
+    TensorUtil::TensorData x(Shape({ M, K }), Type::Dense);
+    TensorUtil::TensorData weight(Shape({ N, K }), Type::Dense);
+    TensorUtil::TensorData bias(Shape({ 1, N }), Type::Dense);
+    TensorUtil::TensorData Out(Shape({ M, N }), Type::Dense);
+    TensorUtil::TensorData Expected(Shape({ M, N }), Type::Dense);
+    TensorUtil::TensorData sum(Shape({ M, K }), Type::Dense);
+    TensorUtil::TensorData expectedSum(Shape({ M, K }), Type::Dense);
+
+    const auto defaultIsa = Compute::Dense::Naive::GetInstructionSet();
+    for (const auto type : { TensorUtil::HalfType::Float16,
+                             TensorUtil::HalfType::BFloat16 })
+    {
+        Compute::Initialize::Normal(x, 0, 1);
+        Compute::Initialize::Normal(weight, 0, 1);
+        Compute::Initialize::Normal(bias, 0, 1);
+
+        //! Rounding error is removed from the expected results by computing
+        //! them from the converted operands
+        const auto a = TensorUtil::HalfTensorData::FromFloat(x, type);
+        const auto b = TensorUtil::HalfTensorData::FromFloat(weight, type);
+        a.ToFloat(x);
+        b.ToFloat(weight);
+        Compute::GemmBiasActivation(Expected, x, weight, bias, false, true,
+                                    Compute::GemmActivation::LeakyReLU, 0.1f);
+        Compute::Add(expectedSum, x, x);
+        TensorUtil::HalfTensorData halfSum(Shape({ M, K }), type);
+
+        for (const auto isa : { InstructionSet::Sse, InstructionSet::Avx2,
+                                InstructionSet::Avx512 })
+        {
+            if (!Compute::Dense::Naive::IsSupported(isa))
+                continue;
+            Compute::Dense::Naive::SetInstructionSet(isa);
+
+            Compute::HalfGemmBiasActivation(
+                Out, x, b, bias, true, Compute::GemmActivation::LeakyReLU,
+                0.1f);
+            CheckNoneZeroEquality(Expected.HostRawPtr(), Out.HostRawPtr(),
+                                  Out.HostTotalSize, print, 0.01f);
+
+            //! Sum of the same values is exact in 16 bits unless it
+            //! overflows
+            Compute::HalfAdd(halfSum, a, a);
+            halfSum.ToFloat(sum);
+            CheckNoneZeroEquality(expectedSum.HostRawPtr(), sum.HostRawPtr(),
+                                  sum.HostTotalSize, print);
+        }
+    }
+    Compute::Dense::Naive::SetInstructionSet(defaultIsa);
+}
+
+GemvLatency GemvPerformance(int inputs, int outputs, int iterations)
+{
+    const CudaDevice cuda(0, "device0");
+    TensorUtil::TensorData x(Shape({ 1, inputs }), Type::Dense, cuda);
+    TensorUtil::TensorData weight(Shape({ outputs, inputs }), Type::Dense,
+                                  cuda);
+    TensorUtil::TensorData y(Shape({ 1, outputs }), Type::Dense, cuda);
+
+    x.SetMode(DeviceType::Host);
+    weight.SetMode(DeviceType::Host);
+    y.SetMode(DeviceType::Host);
+
+    Compute::Initialize::Normal(x, 0, 1);
+    Compute::Initialize::Normal(weight, 0, 1);
+
+    const auto measure = [&](auto func)
+    {
+        std::vector<double> elapsedTimes(iterations);
+        for (auto& elapsedTime : elapsedTimes)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            func(y.HostTotalSize, y.HostMutableRawPtr(), x.HostRawPtr(),
+                 weight.HostRawPtr(), 1, y.Cols(), x.Cols(), false, true,
+                 1.0f, 0.0f, 0, false);
+            const auto end = std::chrono::steady_clock::now();
+            elapsedTime =
+                std::chrono::duration<double, std::micro>(end - begin).count();
+        }
+
+        std::sort(elapsedTimes.begin(), elapsedTimes.end());
+        const auto percentile = [&elapsedTimes](double ratio)
+        {
+            return elapsedTimes[static_cast<std::size_t>(
+                ratio * static_cast<double>(elapsedTimes.size() - 1))];
+        };
+        return std::make_pair(percentile(0.5), percentile(0.99));
+    };
+
+    const auto gemv = measure(Compute::Dense::Naive::Gemv);
+    const auto gemm = measure(Compute::Dense::Naive::Gemm);
+
+    return GemvLatency{ gemv.first, gemv.second, gemm.first, gemm.second };
+}
 } // namespace Sapphire::Test
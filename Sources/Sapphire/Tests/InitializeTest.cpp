@@ -0,0 +1,71 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/InitializeTest.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <Sapphire/util/Random.hpp>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <doctest.h>
+
+namespace Sapphire::Test
+{
+void SeededInitializeTest(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> distribution(1, 100);
+
+    //! Large enough to be split over the threads
+    const Shape shape({ distribution(gen), 1000 + distribution(gen) });
+    const auto seed = static_cast<std::uint64_t>(distribution(gen));
+    TensorUtil::TensorData data(shape, Type::Dense);
+
+    //! Same seed gives the same data for any number of threads
+    Util::SetNumThreads(1);
+    Compute::Initialize::Normal(data, 1.0f, 2.0f, seed);
+    const auto single = data.GetDataCopy();
+    Util::SetNumThreads(4);
+    Compute::Initialize::Normal(data, 1.0f, 2.0f, seed);
+    const auto multiple = data.GetDataCopy();
+    Util::SetNumThreads(0);
+    CHECK(single == multiple);
+
+    double sum = 0.0, squareSum = 0.0;
+    for (const auto value : single)
+    {
+        sum += value;
+        squareSum += static_cast<double>(value) * value;
+    }
+    const auto mean = sum / static_cast<double>(single.size());
+    const auto sd = std::sqrt(squareSum / static_cast<double>(single.size()) -
+                              mean * mean);
+    if (print)
+        std::cout << "Normal(1, 2) mean : " << mean << " sd : " << sd
+            << std::endl;
+    CHECK(std::abs(mean - 1.0) < 0.1);
+    CHECK(std::abs(sd - 2.0) < 0.1);
+
+    //! Calls without seed replay the same sequence after SetSeed
+    Util::SetSeed(seed);
+    Compute::Initialize::Uniform(data, -1.0f, 3.0f);
+    const auto first = data.GetDataCopy();
+    Compute::Initialize::Uniform(data, -1.0f, 3.0f);
+    const auto second = data.GetDataCopy();
+    Util::SetSeed(seed);
+    Compute::Initialize::Uniform(data, -1.0f, 3.0f);
+    CHECK(data.GetDataCopy() == first);
+    Compute::Initialize::Uniform(data, -1.0f, 3.0f);
+    CHECK(data.GetDataCopy() == second);
+    CHECK(first != second);
+
+    for (const auto value : first)
+        CHECK((value >= -1.0f && value <= 3.0f));
+}
+} // namespace Sapphire::Test
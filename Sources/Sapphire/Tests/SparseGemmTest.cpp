@@ -294,7 +294,8 @@ void SparseTestCorrectnessCuda(size_t m, size_t n, size_t k, size_t numMatrices,
     Compute::DeepCopyHostToDevice(cudaSparseB, hostSparseB, numMatrices, 0);
 
     Compute::Dense::Cuda::Gemm(m * n * numMatrices, cudaDenseOut, cudaDenseA,
-                               cudaDenseB, m, n, k, 0);
+                               cudaDenseB, m, n, k, false, false, 1.0f,
+                               1.0f, 0);
 
     Compute::Sparse::Cuda::Gemm(&hostSparseOut, &cudaSparseOut, cudaSparseA,
                                 cudaSparseB, m, n, numMatrices, 0, true);
@@ -497,7 +498,8 @@ PerformanceData PerformanceTest(size_t m, size_t n, size_t k,
     const auto cudaDenseBegin = std::chrono::system_clock::now();
 
     Compute::Dense::Cuda::Gemm(m * n * numMatrices, cudaDenseOut, cudaDenseA,
-                               cudaDenseB, m, n, k, 0);
+                               cudaDenseB, m, n, k, false, false, 1.0f,
+                               1.0f, 0);
     const auto cudaDenseEnd = std::chrono::system_clock::now();
 
     const auto naiveSparseBegin = std::chrono::system_clock::now();
@@ -7,8 +7,11 @@
 #include <Sapphire/Tests/TensorTest/TensorFunctionalityTest.hpp>
 #include <Sapphire/Tests/TestUtil.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/compute/IndexingOps.hpp>
 #include <Sapphire/compute/Initialize.hpp>
 #include <Sapphire/util/CudaDevice.hpp>
+#include <cstdint>
+#include <iostream>
 #include <random>
 #include <doctest.h>
 
@@ -125,4 +128,79 @@ void TensorDataCopyOnHost(bool print)
 
     TensorUtil::TensorData copyConstructedTensorData = tensorData;
 }
+
+void TensorDataTypes(bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> intDistrib(1, 100);
+
+    const int rows = intDistrib(gen);
+    const int cols = intDistrib(gen);
+    const int gatheredRows = intDistrib(gen);
+
+    TensorUtil::TensorData x(Shape({ rows, cols }), Type::Dense);
+    Compute::Initialize::Normal(x, 0, 50);
+
+    //! Buffers are sized by the element width
+    TensorUtil::TensorData labels(Shape({ rows, cols }), Type::Dense,
+                                  DataType::Int8);
+    TensorUtil::TensorData mask(Shape({ rows, cols }), Type::Dense,
+                                DataType::Bool);
+    CHECK(labels.ElementSize() == 1);
+    CHECK(mask.GetDataType() == DataType::Bool);
+    CHECK_THROWS_AS((void)labels.HostRawPtr<float>(), std::invalid_argument);
+    CHECK_THROWS_AS((void)labels.HostRawPtr(), std::invalid_argument);
+    CHECK_THROWS_AS((void)labels.HostMutableRawPtr(), std::invalid_argument);
+
+    Compute::Cast(labels, x);
+    Compute::Cast(mask, labels);
+    const auto data = x.GetDataCopy();
+    for (int i = 0; i < rows * cols; ++i)
+    {
+        const auto label = static_cast<std::int8_t>(data[i]);
+        CHECK(labels.HostRawPtr<std::int8_t>()[i] == label);
+        CHECK(mask.HostRawPtr<bool>()[i] == (label != 0));
+    }
+
+    //! Values of other data types are converted from float by SetData
+    labels.SetData(data);
+    const auto labelData = labels.GetDataCopy();
+    for (int i = 0; i < rows * cols; ++i)
+        CHECK(labelData[i] ==
+              static_cast<float>(static_cast<std::int8_t>(data[i])));
+
+    TensorUtil::TensorData indices(Shape({ gatheredRows }), Type::Dense,
+                                   DataType::Int32);
+    std::uniform_int_distribution<> indexDistrib(0, rows - 1);
+    for (int i = 0; i < gatheredRows; ++i)
+        indices.HostMutableRawPtr<std::int32_t>()[i] = indexDistrib(gen);
+
+    TensorUtil::TensorData gathered(Shape({ gatheredRows, cols }),
+                                    Type::Dense, DataType::Int8);
+    Compute::Gather(gathered, labels, indices);
+    for (int i = 0; i < gatheredRows; ++i)
+    {
+        const auto row = indices.HostRawPtr<std::int32_t>()[i];
+        for (int j = 0; j < cols; ++j)
+            CHECK(gathered.HostRawPtr<std::int8_t>()[i * cols + j] ==
+                  labels.HostRawPtr<std::int8_t>()[row * cols + j]);
+    }
+
+    indices.HostMutableRawPtr<std::int32_t>()[0] = rows;
+    CHECK_THROWS_AS(Compute::Gather(gathered, labels, indices),
+                    std::out_of_range);
+
+    //! Masked out elements of x are replaced with zeros
+    TensorUtil::TensorData zeros(Shape({ rows, cols }), Type::Dense);
+    TensorUtil::TensorData masked(Shape({ rows, cols }), Type::Dense);
+    Compute::Where(masked, mask, x, zeros);
+    for (int i = 0; i < rows * cols; ++i)
+        CHECK(masked.HostRawPtr()[i] ==
+              (mask.HostRawPtr<bool>()[i] ? data[i] : 0.0f));
+
+    if (print)
+        std::cout << "Tested " << DataTypeToString(labels.GetDataType())
+            << " data of shape " << labels.GetShape().ToString() << std::endl;
+}
 }
@@ -109,8 +109,30 @@ void LeakyReLUBackward(TensorData& dx, const TensorData& dy,
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::LeakyReLUBackward - Host not implemented");
+        Dense::Naive::LeakyReLUBackward(dx.HostMutableRawPtr(),
+                                        dy.HostRawPtr(), x.HostRawPtr(), a,
+                                        totalSize);
+    }
+}
+
+void SoftMaxBackward(TensorData& dx, const TensorData& dy,
+                     const TensorData& y)
+{
+    assert(dx.Mode() == dy.Mode() && dx.Mode() == y.Mode());
+    const auto device = dx.GetDevice();
+    const auto unitSize = dx.Cols();
+    const auto totalSize = dx.Size();
+
+    if (dx.Mode() == DeviceType::Cuda)
+    {
+        cudaSetDevice(device.GetID());
+        Dense::Cuda::SoftmaxBack(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
+                                 y.CudaRawPtr(), totalSize, unitSize);
+    }
+    else
+    {
+        Dense::Naive::SoftmaxBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                      y.HostRawPtr(), totalSize, unitSize);
     }
 }
 }
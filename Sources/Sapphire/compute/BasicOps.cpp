@@ -6,6 +6,9 @@
 
 #include <Sapphire/compute/Broadcast.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/ActivationOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/ReduceOps.hpp>
 #include <Sapphire/compute/dense/cuda/Basic.cuh>
 #include <Sapphire/compute/dense/cuda/Gemm.cuh>
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
@@ -13,6 +16,7 @@
 #include <Sapphire/compute/dense/cuda/BasicBackward.cuh>
 #include <algorithm>
 #include <cassert>
+#include <stdexcept>
 
 namespace Sapphire::Compute
 {
@@ -21,8 +25,6 @@ void Add(TensorData& y, const TensorData& a, const TensorData& b)
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
 
-    const auto device = y.GetDevice();
-
     auto shapeOut = y.GetShape();
     auto shapeA = a.GetShape();
     auto shapeB = b.GetShape();
@@ -34,24 +36,17 @@ void Add(TensorData& y, const TensorData& a, const TensorData& b)
     shapeA.Expand(maxDim);
     shapeB.Expand(maxDim);
 
-    const auto sizeOut = shapeOut.Size();
-    const auto sizeA = shapeA.Size();
-    const auto sizeB = shapeB.Size();
-
     if (y.Mode() == DeviceType::Cuda)
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
-                             y.CudaMutableRawPtr(), a.CudaRawPtr(),
-                             b.CudaRawPtr(), 0,
-                             0, Dense::Cuda::Add, 0, false, false);
+        BroadcastElementwise(shapeOut, shapeA, shapeB, y.CudaMutableRawPtr(),
+                             a.CudaRawPtr(), b.CudaRawPtr(), Dense::Cuda::Add,
+                             false);
     }
     else
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
-                             y.HostMutableRawPtr(),
-                             a.HostRawPtr(), b.HostRawPtr(), 0, 0,
-                             Dense::Naive::Add, 0, false, false);
+        BroadcastElementwise(shapeOut, shapeA, shapeB, y.HostMutableRawPtr(),
+                             a.HostRawPtr(), b.HostRawPtr(), Dense::Naive::Add,
+                             true);
     }
 }
 
@@ -60,8 +55,6 @@ void Sub(TensorData& y, const TensorData& a, const TensorData& b)
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
 
-    const auto device = y.GetDevice();
-
     auto shapeOut = y.GetShape();
     auto shapeA = a.GetShape();
     auto shapeB = b.GetShape();
@@ -73,24 +66,17 @@ void Sub(TensorData& y, const TensorData& a, const TensorData& b)
     shapeA.Expand(maxDim);
     shapeB.Expand(maxDim);
 
-    const auto sizeOut = shapeOut.Size();
-    const auto sizeA = shapeA.Size();
-    const auto sizeB = shapeB.Size();
-
     if (y.Mode() == DeviceType::Cuda)
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
-                             y.CudaMutableRawPtr(), a.CudaRawPtr(),
-                             b.CudaRawPtr(), 0, 0, Dense::Cuda::Sub, 0, false,
+        BroadcastElementwise(shapeOut, shapeA, shapeB, y.CudaMutableRawPtr(),
+                             a.CudaRawPtr(), b.CudaRawPtr(), Dense::Cuda::Sub,
                              false);
     }
     else
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
-                             y.HostMutableRawPtr(),
-                             a.HostRawPtr(), b.HostRawPtr(), 0, 0,
-                             Dense::Naive::Sub, 0, false, false);
+        BroadcastElementwise(shapeOut, shapeA, shapeB, y.HostMutableRawPtr(),
+                             a.HostRawPtr(), b.HostRawPtr(), Dense::Naive::Sub,
+                             true);
     }
 }
 
@@ -99,8 +85,6 @@ void Dot(TensorData& y, const TensorData& a, const TensorData& b)
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
 
-    const auto device = y.GetDevice();
-
     auto shapeOut = y.GetShape();
     auto shapeA = a.GetShape();
     auto shapeB = b.GetShape();
@@ -112,24 +96,17 @@ void Dot(TensorData& y, const TensorData& a, const TensorData& b)
     shapeA.Expand(maxDim);
     shapeB.Expand(maxDim);
 
-    const auto sizeOut = shapeOut.Size();
-    const auto sizeA = shapeA.Size();
-    const auto sizeB = shapeB.Size();
-
     if (y.Mode() == DeviceType::Cuda)
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
-                             y.CudaMutableRawPtr(), a.CudaRawPtr(),
-                             b.CudaRawPtr(), 0, 0, Dense::Cuda::Dot, 0, false,
+        BroadcastElementwise(shapeOut, shapeA, shapeB, y.CudaMutableRawPtr(),
+                             a.CudaRawPtr(), b.CudaRawPtr(), Dense::Cuda::Dot,
                              false);
     }
     else
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
-                             y.HostMutableRawPtr(),
-                             a.HostRawPtr(), b.HostRawPtr(), 0, 0,
-                             Dense::Naive::Dot, 0, false, false);
+        BroadcastElementwise(shapeOut, shapeA, shapeB, y.HostMutableRawPtr(),
+                             a.HostRawPtr(), b.HostRawPtr(), Dense::Naive::Dot,
+                             true);
     }
 }
 
@@ -141,8 +118,6 @@ void DotBackward(TensorData& da, TensorData& db, const TensorData& dy,
     assert(dy.GetDevice() == a.GetDevice());
     assert(dy.GetDevice() == b.GetDevice());
 
-    const auto device = dy.GetDevice();
-
     const auto maxDim = std::max(
         { dy.GetShape().Dim(), da.GetShape().Dim(), db.GetShape().Dim() });
 
@@ -154,24 +129,24 @@ void DotBackward(TensorData& da, TensorData& db, const TensorData& dy,
     shapeA.Expand(maxDim);
     shapeB.Expand(maxDim);
 
-    const auto sizeOut = shapeOut.Size();
-    const auto sizeA = shapeA.Size();
-    const auto sizeB = shapeB.Size();
-
     if (dy.Mode() == DeviceType::Cuda)
     {
-        BroadcastBackwardWith2Inputs(
-            shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB, dy.CudaRawPtr(),
-            da.CudaMutableRawPtr(), db.CudaMutableRawPtr(), a.CudaRawPtr(),
-            b.CudaRawPtr(), 0, 0, Dense::Cuda::DotBackward, 0, false, false);
+        BroadcastElementwiseBackward(
+            shapeOut, shapeA, shapeB, dy.CudaRawPtr(), da.CudaMutableRawPtr(),
+            db.CudaMutableRawPtr(), a.CudaRawPtr(), b.CudaRawPtr(),
+            Dense::Cuda::DotBackward);
     }
     else
     {
-        throw std::runtime_error("Compute::DotBackward - Host not implemented");
+        BroadcastElementwiseBackward(
+            shapeOut, shapeA, shapeB, dy.HostRawPtr(), da.HostMutableRawPtr(),
+            db.HostMutableRawPtr(), a.HostRawPtr(), b.HostRawPtr(),
+            Dense::Naive::DotBackward);
     }
 }
 
-void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
+void Gemm(TensorData& y, const TensorData& a, const TensorData& b,
+          bool transA, bool transB, float alpha, float beta, int numThreads)
 {
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
@@ -188,7 +163,7 @@ void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
     const auto device = y.GetDevice();
     const auto M = shapeOut.Rows();
     const auto N = shapeOut.Cols();
-    const auto K = shapeA.Cols();
+    const auto K = transA ? shapeA.Rows() : shapeA.Cols();
 
     //! Faster broadcast multiply for Cuda if all tensor dimensions are fixed to
     //! 2
@@ -203,7 +178,7 @@ void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
             Dense::Cuda::GemmMatrixWiseBroadcast(
                 y.CudaMutableRawPtr(), a.CudaRawPtr(), b.CudaRawPtr(),
                 M, N, K, batchSize, a.GetBatchSize(2) == 1,
-                b.GetBatchSize(2) == 1, 0);
+                b.GetBatchSize(2) == 1, transA, transB, alpha, beta, 0);
             return;
         }
     }
@@ -220,24 +195,104 @@ void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
     const auto sizeA = shapeA.Size();
     const auto sizeB = shapeB.Size();
 
+    //! If output is broadcast, several products accumulate into the same
+    //! output matrix. beta is applied once beforehand in that case
+    const auto numOutputs = sizeOut / (M * N);
+    const auto numProducts =
+        std::max({ numOutputs, sizeA / (M * K), sizeB / (K * N) });
+    if (numProducts > numOutputs && beta != 1.0f)
+    {
+        if (beta == 0.0f)
+            Initialize::Zeros(y);
+        else
+            Scale(y, y, beta);
+        beta = 1.0f;
+    }
+
     if (y.Mode() == DeviceType::Cuda)
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA,
-                             sizeB, y.CudaMutableRawPtr(),
-                             a.CudaRawPtr(),
-                             b.CudaRawPtr(), 0, 2, Dense::Cuda::Gemm, M, N, K,
-                             y.GetDevice().GetID());
+        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, y.CudaMutableRawPtr(),
+                             a.CudaRawPtr(), b.CudaRawPtr(), 2,
+                             Dense::Cuda::Gemm, M, N, K, transA, transB,
+                             alpha, beta, y.GetDevice().GetID());
     }
     else
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
-                             y.HostMutableRawPtr(), a.HostRawPtr(),
-                             b.HostRawPtr(), 0, 2, Dense::Naive::Gemm, M,
-                             N, K);
+        //! Vector-matrix products (e.g. linear layer with batch size 1) are
+        //! streamed by gemv instead of blocked gemm
+        const auto func = M == 1 || N == 1 ? Dense::Naive::Gemv
+                                           : Dense::Naive::Gemm;
+        //! Preserved b (e.g. weights) is packed once and reused until it is
+        //! modified
+        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, y.HostMutableRawPtr(),
+                             a.HostRawPtr(), b.HostRawPtr(), 2, func, M, N,
+                             K, transA, transB, alpha, beta, numThreads,
+                             b.IsPreserved());
     }
 }
 
+void GemmBiasActivation(TensorData& y, const TensorData& a,
+                        const TensorData& b, const TensorData& bias,
+                        bool transA, bool transB, GemmActivation activation,
+                        float negativeSlope, int numThreads)
+{
+    assert(y.Mode() == a.Mode());
+    assert(y.Mode() == b.Mode());
+    assert(y.Mode() == bias.Mode());
+
+    auto shapeOut = y.GetShape();
+    auto shapeA = a.GetShape();
+    auto shapeB = b.GetShape();
+
+    shapeOut.Expand(2);
+    shapeA.Expand(2);
+    shapeB.Expand(2);
+
+    const auto M = shapeOut.Rows();
+    const auto N = shapeOut.Cols();
+    const auto K = transA ? shapeA.Rows() : shapeA.Cols();
+
+    if (bias.GetShape().Size() != N)
+        throw std::invalid_argument(
+            "Compute::GemmBiasActivation - Bias size mismatch");
+
+    if (y.Mode() == DeviceType::Cuda)
+    {
+        //! Not fused on cuda yet
+        Gemm(y, a, b, transA, transB, 1.0f, 0.0f);
+        Add(y, y, bias);
+        if (activation == GemmActivation::ReLU)
+            ReLU(y, y);
+        else if (activation == GemmActivation::LeakyReLU)
+            LeakyReLU(y, y, negativeSlope);
+        return;
+    }
+
+    const auto maxDim = std::max({ y.GetShape().Dim(), a.GetShape().Dim(),
+                                   b.GetShape().Dim() });
+
+    shapeOut.Expand(maxDim);
+    shapeA.Expand(maxDim);
+    shapeB.Expand(maxDim);
+
+    const auto numOutputs = shapeOut.Size() / (M * N);
+    if (shapeA.Size() / (M * K) > numOutputs ||
+        shapeB.Size() / (K * N) > numOutputs)
+        throw std::invalid_argument(
+            "Compute::GemmBiasActivation - Output cannot be broadcast");
+
+    const bool activate = activation != GemmActivation::None;
+    const auto slope =
+        activation == GemmActivation::LeakyReLU ? negativeSlope : 0.0f;
+
+    const auto func = M == 1 || N == 1 ? Dense::Naive::GemvBiasActivation
+                                       : Dense::Naive::GemmBiasActivation;
+    BroadcastWith2Inputs(shapeOut, shapeA, shapeB, y.HostMutableRawPtr(),
+                         a.HostRawPtr(), b.HostRawPtr(), 2, func,
+                         bias.HostRawPtr(), M, N, K, transA, transB, activate,
+                         slope, numThreads, b.IsPreserved());
+}
+
 void Scale(TensorData& y, const TensorData& x, const float factor)
 {
     assert(y.Mode() == x.Mode());
@@ -334,6 +389,21 @@ void log10(TensorData& y, const TensorData& x)
     }
 }
 
+void exp(TensorData& y, const TensorData& x)
+{
+    assert(y.Mode() == x.Mode());
+    const auto totalSize = y.GetShape().Size();
+
+    if (y.Mode() == DeviceType::Cuda)
+    {
+        throw std::runtime_error("Compute::exp - Cuda not implemented");
+    }
+    else
+    {
+        Dense::Naive::Exp(y.HostMutableRawPtr(), x.HostRawPtr(), totalSize);
+    }
+}
+
 void Inverse(TensorData& y, const TensorData& x)
 {
     assert(y.Mode() == x.Mode());
@@ -352,30 +422,63 @@ void Inverse(TensorData& y, const TensorData& x)
     }
 }
 
-void Mean(TensorData& y, const TensorData& x, int dim)
+void PowBackward(TensorData& dx, const TensorData& dy, const TensorData& x,
+                 const float factor)
 {
-    assert(y.Mode() == x.Mode());
-    assert(y.GetShape().At(dim) == 1);
+    assert(dx.Mode() == dy.Mode());
+    assert(dx.Mode() == x.Mode());
+    const auto totalSize = dx.GetShape().Size();
 
-    int stride = 1;
-    for (int i = dim; i < y.GetShape().Dim(); ++i)
+    if (dx.Mode() == DeviceType::Cuda)
+    {
+        Dense::Cuda::PowBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
+                                 x.CudaRawPtr(), factor, totalSize);
+    }
+    else
     {
-        stride *= y.GetShape().At(i);
+        Dense::Naive::PowBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                  x.HostRawPtr(), factor, totalSize);
     }
+}
 
-    const auto device = y.GetDevice();
-    const auto unitSize = x.GetShape().At(dim);
-    const auto ySize = y.GetShape().Size();
+void InverseBackward(TensorData& dx, const TensorData& dy,
+                     const TensorData& x)
+{
+    assert(dx.Mode() == dy.Mode());
+    assert(dx.Mode() == x.Mode());
+    const auto totalSize = dx.GetShape().Size();
+
+    if (dx.Mode() == DeviceType::Cuda)
+    {
+        throw std::runtime_error(
+            "Compute::InverseBackward - Cuda not implemented");
+    }
+    else
+    {
+        Dense::Naive::InverseBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                      x.HostRawPtr(), totalSize);
+    }
+}
+
+void Mean(TensorData& y, const TensorData& x, int dim)
+{
+    assert(y.Mode() == x.Mode());
+    assert(y.GetShape().At(dim) == 1);
 
     if (y.Mode() == DeviceType::Cuda)
     {
-        Dense::Cuda::Mean(y.CudaMutableRawPtr(), x.CudaRawPtr(), ySize,
-                          unitSize, stride);
+        int stride = 1;
+        for (int i = dim; i < y.GetShape().Dim(); ++i)
+        {
+            stride *= y.GetShape().At(i);
+        }
+
+        Dense::Cuda::Mean(y.CudaMutableRawPtr(), x.CudaRawPtr(),
+                          y.GetShape().Size(), x.GetShape().At(dim), stride);
     }
     else
     {
-        Dense::Naive::Mean(y.HostMutableRawPtr(), x.HostRawPtr(), ySize
-                           , unitSize, stride);
+        Mean(y, x, std::vector<int>{ dim });
     }
 }
 
@@ -386,25 +489,22 @@ void MeanBackward(TensorData& dx, const TensorData& dy,
     assert(dy.GetDevice() == dx.GetDevice());
     assert(dx.GetShape().Dim() == dy.GetShape().Dim());
 
-    const auto device = dy.GetDevice();
-    const auto yShape = dy.GetShape();
-    const auto xShape = dx.GetShape();
-
-    int stride = 1;
-    for (int i = dim; i < yShape.Dim(); ++i)
-    {
-        stride *= yShape.At(i);
-    }
-
     if (dy.Mode() == DeviceType::Cuda)
     {
+        const auto yShape = dy.GetShape();
+        int stride = 1;
+        for (int i = dim; i < yShape.Dim(); ++i)
+        {
+            stride *= yShape.At(i);
+        }
+
         Dense::Cuda::MeanBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
-                                  yShape.Size(), xShape.At(dim), stride);
+                                  yShape.Size(), dx.GetShape().At(dim),
+                                  stride);
     }
     else
     {
-        Dense::Naive::MeanBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
-                                   yShape.Size(), xShape.At(dim), stride);
+        MeanBackward(dx, dy, std::vector<int>{ dim });
     }
 }
 } // namespace Sapphire::Compute
@@ -0,0 +1,168 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/FusedOps.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <cmath>
+#include <vector>
+
+namespace Sapphire::Compute::Fused
+{
+namespace
+{
+//! Expressions smaller than this are evaluated on single thread
+constexpr std::size_t ParallelThreshold = 1u << 16;
+} // namespace
+
+Shape BroadcastShape(const Shape& a, const Shape& b)
+{
+    const auto dim = std::max(a.Dim(), b.Dim());
+    auto shapeA = a;
+    auto shapeB = b;
+    shapeA.Expand(dim);
+    shapeB.Expand(dim);
+
+    std::vector<int> shape(dim);
+    for (int i = 0; i < dim; ++i)
+    {
+        const auto sizeA = shapeA.At(i);
+        const auto sizeB = shapeB.At(i);
+        if (sizeA != sizeB && sizeA != 1 && sizeB != 1)
+            throw std::invalid_argument(
+                "Compute::Fused::BroadcastShape - Shapes " + a.ToString() +
+                " and " + b.ToString() + " cannot be broadcast");
+        shape[i] = std::max(sizeA, sizeB);
+    }
+    return Shape(shape);
+}
+
+void GatherBroadcast(float* out, const float* data,
+                     const BroadcastLayout<2>& layout, std::size_t offset,
+                     unsigned int count)
+{
+    //! Operand is contiguous or repeated along the innermost dimension, so
+    //! elements are copied in runs up to the end of each innermost index
+    const auto numDims = layout.NumDims();
+    const auto inner = numDims - 1;
+    const std::size_t innerExtent = layout.Extents[inner];
+    const bool contiguous = layout.IsFull(1, inner);
+
+    for (unsigned int done = 0; done < count;)
+    {
+        const auto index = offset + done;
+        const auto source =
+            data + BroadcastOffsets(layout, numDims, index)[1];
+        const auto run = static_cast<unsigned int>(std::min<std::size_t>(
+            innerExtent - index % innerExtent, count - done));
+        if (contiguous)
+            std::memcpy(out + done, source, run * sizeof(float));
+        else
+            std::fill(out + done, out + done + run, *source);
+        done += run;
+    }
+}
+
+void ForEachBlock(std::size_t totalSize,
+                  const std::function<void(std::size_t, unsigned int)>& func)
+{
+    const auto numBlocks =
+        static_cast<long long>((totalSize + BlockSize - 1) / BlockSize);
+
+    const auto threads = Util::ResolveNumThreads(0);
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1 && totalSize >= ParallelThreshold)
+    for (long long blockIdx = 0; blockIdx < numBlocks; ++blockIdx)
+    {
+        const auto offset = static_cast<std::size_t>(blockIdx) * BlockSize;
+        func(offset, static_cast<unsigned int>(
+                 std::min<std::size_t>(BlockSize, totalSize - offset)));
+    }
+}
+
+double ReduceBlocks(std::size_t totalSize,
+                    const std::function<double(std::size_t, unsigned int)>&
+                    func)
+{
+    std::vector<double> results((totalSize + BlockSize - 1) / BlockSize);
+    ForEachBlock(totalSize, [&](std::size_t offset, unsigned int count)
+    {
+        results[offset / BlockSize] = func(offset, count);
+    });
+
+    double sum = 0.0;
+    for (const auto result : results)
+        sum += result;
+    return sum;
+}
+
+double SumBlock(const float* data, unsigned int count)
+{
+    //! Independent accumulators hide latency of the additions
+    double sums[4] = {};
+    unsigned int i = 0;
+    for (; i + 4 <= count; i += 4)
+        for (unsigned int lane = 0; lane < 4; ++lane)
+            sums[lane] += data[i + lane];
+    for (; i < count; ++i)
+        sums[0] += data[i];
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+Context MakeContext()
+{
+    const auto& kernels = Dense::Naive::GetHostKernels();
+    return { &kernels, &Dense::Naive::GetMathKernels(kernels) };
+}
+
+void CheckHostTensor(const TensorData& data, const char* caller)
+{
+    if (data.Mode() != DeviceType::Host)
+        throw std::invalid_argument(std::string(caller) +
+                                    " - Only host tensors are supported");
+    if (data.GetDataType() != DataType::Float32)
+        throw std::invalid_argument(std::string(caller) +
+                                    " - Only float tensors are supported");
+}
+
+Leaf::Leaf(const TensorData& data)
+    : m_data(data.HostRawPtr()),
+      m_shape(data.GetShape())
+{
+    CheckHostTensor(data, "Compute::Fused::Input");
+}
+
+void Leaf::Bind(const Shape& shape)
+{
+    m_full = m_shape.Size() == shape.Size();
+    m_layout = BroadcastLayout<2>();
+    if (m_full || m_shape.Size() == 1)
+        return;
+
+    const auto dim = std::max(shape.Dim(), m_shape.Dim());
+    auto outShape = shape;
+    auto leafShape = m_shape;
+    outShape.Expand(dim);
+    leafShape.Expand(dim);
+    m_layout = MakeBroadcastLayout<2>({ &outShape, &leafShape }, 0);
+}
+
+namespace Ops
+{
+void Pow::Apply(const Context& context, float* out, const float* in,
+                float exponent, unsigned int count)
+{
+    if (exponent == 2.0f)
+        context.Kernels->Dot(out, in, in, count);
+    else if (exponent == -1.0f)
+        context.Kernels->Inverse(out, in, count);
+    else if (exponent == 1.0f)
+        std::memmove(out, in, count * sizeof(float));
+    else
+        for (unsigned int i = 0; i < count; ++i)
+            out[i] = std::pow(in[i], exponent);
+}
+} // namespace Ops
+} // namespace Sapphire::Compute::Fused
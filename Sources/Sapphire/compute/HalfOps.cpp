@@ -0,0 +1,134 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/HalfOps.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/compute/dense/naive/NaiveHalf.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Compute
+{
+namespace
+{
+void Check(bool condition, const std::string& message,
+           const std::string& caller)
+{
+    if (!condition)
+        throw std::invalid_argument("Compute::" + caller + " - " + message);
+}
+
+struct HalfGemmArgs
+{
+    unsigned int M = 0;
+    unsigned int N = 0;
+    unsigned int K = 0;
+};
+
+HalfGemmArgs ResolveArgs(const TensorData& y, const TensorData& a,
+                         const HalfTensorData& b, bool transB,
+                         const std::string& caller)
+{
+    const auto shapeA = a.GetShape();
+    const auto shapeB = b.GetShape();
+    Check(y.Mode() == DeviceType::Host && a.Mode() == DeviceType::Host,
+          "y and a should be on host", caller);
+    Check(shapeB.Size() == shapeB.Rows() * shapeB.Cols(),
+          "b should be single matrix. Given shape : " + shapeB.ToString(),
+          caller);
+
+    HalfGemmArgs args;
+    args.K = static_cast<unsigned int>(shapeA.Cols());
+    args.M = args.K == 0 ? 0 : shapeA.Size() / args.K;
+    args.N = static_cast<unsigned int>(transB ? shapeB.Rows()
+                                              : shapeB.Cols());
+    const auto kB = static_cast<unsigned int>(transB ? shapeB.Cols()
+                                                     : shapeB.Rows());
+    Check(kB == args.K, "Inner dimensions do not match. a : " +
+                        shapeA.ToString() + " b : " + shapeB.ToString(),
+          caller);
+    Check(static_cast<long long>(y.GetShape().Size()) ==
+          static_cast<long long>(args.M) * args.N,
+          "Output should have " + std::to_string(args.M * args.N) +
+          " elements", caller);
+    return args;
+}
+
+void CheckElementwise(const HalfTensorData& y, const HalfTensorData& a,
+                      const HalfTensorData& b, const std::string& caller)
+{
+    Check(a.GetType() == y.GetType() && b.GetType() == y.GetType(),
+          "Types of the operands do not match", caller);
+    Check(a.GetShape().Size() == y.GetShape().Size() &&
+          b.GetShape().Size() == y.GetShape().Size(),
+          "Sizes of the operands do not match. y : " +
+          y.GetShape().ToString() + " a : " + a.GetShape().ToString() +
+          " b : " + b.GetShape().ToString(), caller);
+}
+} // namespace
+
+void HalfGemm(TensorData& y, const TensorData& a, const HalfTensorData& b,
+              bool transB, int numThreads)
+{
+    const auto args = ResolveArgs(y, a, b, transB, "HalfGemm");
+    Dense::Naive::HalfGemm(args.M * args.N, y.HostMutableRawPtr(),
+                           a.HostRawPtr(), b.RawPtr(), b.IsBFloat16(), args.M,
+                           args.N, args.K, false, transB, 1.0f, 0.0f,
+                           numThreads);
+}
+
+void HalfGemmBiasActivation(TensorData& y, const TensorData& a,
+                            const HalfTensorData& b, const TensorData& bias,
+                            bool transB, GemmActivation activation,
+                            float negativeSlope, int numThreads)
+{
+    const std::string caller = "HalfGemmBiasActivation";
+    const auto args = ResolveArgs(y, a, b, transB, caller);
+    Check(bias.Mode() == DeviceType::Host, "bias should be on host", caller);
+    Check(bias.GetShape().Size() == static_cast<int>(args.N),
+          "bias should have " + std::to_string(args.N) + " elements",
+          caller);
+
+    Dense::Naive::HalfGemmBiasActivation(
+        args.M * args.N, y.HostMutableRawPtr(), a.HostRawPtr(), b.RawPtr(),
+        b.IsBFloat16(), bias.HostRawPtr(), args.M, args.N, args.K, false,
+        transB, activation != GemmActivation::None,
+        activation == GemmActivation::LeakyReLU ? negativeSlope : 0.0f,
+        numThreads);
+}
+
+void HalfAdd(HalfTensorData& y, const HalfTensorData& a,
+             const HalfTensorData& b, int numThreads)
+{
+    CheckElementwise(y, a, b, "HalfAdd");
+    Dense::Naive::HalfAdd(y.GetShape().Size(), y.MutableRawPtr(), a.RawPtr(),
+                          b.RawPtr(), y.IsBFloat16(), numThreads);
+}
+
+void HalfSub(HalfTensorData& y, const HalfTensorData& a,
+             const HalfTensorData& b, int numThreads)
+{
+    CheckElementwise(y, a, b, "HalfSub");
+    Dense::Naive::HalfSub(y.GetShape().Size(), y.MutableRawPtr(), a.RawPtr(),
+                          b.RawPtr(), y.IsBFloat16(), numThreads);
+}
+
+void HalfDot(HalfTensorData& y, const HalfTensorData& a,
+             const HalfTensorData& b, int numThreads)
+{
+    CheckElementwise(y, a, b, "HalfDot");
+    Dense::Naive::HalfDot(y.GetShape().Size(), y.MutableRawPtr(), a.RawPtr(),
+                          b.RawPtr(), y.IsBFloat16(), numThreads);
+}
+
+void HalfScale(HalfTensorData& y, const HalfTensorData& x, float factor,
+               int numThreads)
+{
+    CheckElementwise(y, x, x, "HalfScale");
+    Dense::Naive::HalfScale(y.GetShape().Size(), y.MutableRawPtr(),
+                            x.RawPtr(), factor, y.IsBFloat16(), numThreads);
+}
+} // namespace Sapphire::Compute
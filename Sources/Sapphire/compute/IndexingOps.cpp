@@ -5,15 +5,150 @@
 // property of any third parties.
 
 #include <Sapphire/compute/IndexingOps.hpp>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+#include <stdexcept>
+#include <string>
 
 namespace Sapphire::Compute
 {
 using namespace TensorUtil;
 
+namespace
+{
+void Check(bool condition, const std::string& message,
+           const std::string& caller)
+{
+    if (!condition)
+        throw std::invalid_argument("Compute::" + caller + " - " + message);
+}
+
+void CheckHost(std::initializer_list<const TensorData*> data,
+               const std::string& caller)
+{
+    for (const auto* tensorData : data)
+        Check(tensorData->Mode() == DeviceType::Host,
+              "Data should be on host", caller);
+}
+
+template <typename TOut, typename TIn>
+void CastImpl(TOut* y, const TIn* x, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if constexpr (std::is_same_v<TOut, bool>)
+            y[i] = x[i] != TIn{};
+        else
+            y[i] = static_cast<TOut>(x[i]);
+    }
+}
+
+template <typename TIndex>
+void GatherImpl(char* y, const char* x, const TIndex* indices,
+                std::size_t rows, std::size_t xRows, std::size_t rowBytes)
+{
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        const auto index = static_cast<long long>(indices[i]);
+        if (index < 0 || index >= static_cast<long long>(xRows))
+            throw std::out_of_range(
+                "Compute::Gather - Index " + std::to_string(index) +
+                " is out of range of " + std::to_string(xRows) + " rows");
+        std::memcpy(y + i * rowBytes,
+                    x + static_cast<std::size_t>(index) * rowBytes,
+                    rowBytes);
+    }
+}
+} // namespace
+
 void Flatten(TensorData& tensorData)
 {
     const auto shape = tensorData.GetShape();
     const Shape newShape({ 1, shape.Size() });
     tensorData.Reshape(newShape);
 }
+
+void Cast(TensorData& y, const TensorData& x)
+{
+    CheckHost({ &y, &x }, "Cast");
+    Check(y.Size() == x.Size(),
+          "Sizes of y and x do not match. y : " + y.GetShape().ToString() +
+          " x : " + x.GetShape().ToString(), "Cast");
+
+    const auto size = static_cast<std::size_t>(x.Size());
+    DispatchDataType(y.GetDataType(), [&](auto outTag)
+    {
+        using TOut = decltype(outTag);
+        DispatchDataType(x.GetDataType(), [&](auto inTag)
+        {
+            using TIn = decltype(inTag);
+            CastImpl(y.HostMutableRawPtr<TOut>(), x.HostRawPtr<TIn>(), size);
+        });
+    });
+}
+
+void Gather(TensorData& y, const TensorData& x, const TensorData& indices)
+{
+    CheckHost({ &y, &x, &indices }, "Gather");
+    Check(y.GetDataType() == x.GetDataType(),
+          "Data types of y and x do not match", "Gather");
+    Check(y.Cols() == x.Cols(),
+          "Rows of y and x should have the same number of elements. y : " +
+          y.GetShape().ToString() + " x : " + x.GetShape().ToString(),
+          "Gather");
+
+    const auto cols = static_cast<std::size_t>(x.Cols());
+    const auto rows = cols == 0 ? 0 : static_cast<std::size_t>(y.Size()) /
+                                      cols;
+    const auto xRows = cols == 0 ? 0 : static_cast<std::size_t>(x.Size()) /
+                                       cols;
+    Check(static_cast<std::size_t>(indices.Size()) == rows,
+          "Expected " + std::to_string(rows) + " indices, given : " +
+          std::to_string(indices.Size()), "Gather");
+
+    //! Rows are copied as bytes, so data type is dispatched only to get the
+    //! pointers
+    char* yPtr = nullptr;
+    const char* xPtr = nullptr;
+    DispatchDataType(x.GetDataType(), [&](auto tag)
+    {
+        using T = decltype(tag);
+        yPtr = reinterpret_cast<char*>(y.HostMutableRawPtr<T>());
+        xPtr = reinterpret_cast<const char*>(x.HostRawPtr<T>());
+    });
+    const auto rowBytes = cols * x.ElementSize();
+    DispatchIntegralType(indices.GetDataType(), [&](auto indexTag)
+    {
+        using TIndex = decltype(indexTag);
+        GatherImpl(yPtr, xPtr, indices.HostRawPtr<TIndex>(), rows, xRows,
+                   rowBytes);
+    });
+}
+
+void Where(TensorData& y, const TensorData& mask, const TensorData& a,
+           const TensorData& b)
+{
+    CheckHost({ &y, &mask, &a, &b }, "Where");
+    Check(mask.GetDataType() == DataType::Bool, "mask should be Bool",
+          "Where");
+    Check(a.GetDataType() == y.GetDataType() &&
+          b.GetDataType() == y.GetDataType(),
+          "Data types of y, a and b do not match", "Where");
+    Check(mask.Size() == y.Size() && a.Size() == y.Size() &&
+          b.Size() == y.Size(),
+          "Sizes of the operands do not match", "Where");
+
+    const auto size = static_cast<std::size_t>(y.Size());
+    const auto* maskPtr = mask.HostRawPtr<bool>();
+    DispatchDataType(y.GetDataType(), [&](auto tag)
+    {
+        using T = decltype(tag);
+        auto* out = y.HostMutableRawPtr<T>();
+        const auto* aPtr = a.HostRawPtr<T>();
+        const auto* bPtr = b.HostRawPtr<T>();
+        for (std::size_t i = 0; i < size; ++i)
+            out[i] = maskPtr[i] ? aPtr[i] : bPtr[i];
+    });
+}
 }
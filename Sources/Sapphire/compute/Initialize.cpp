@@ -7,43 +7,82 @@
 #include <Sapphire/compute/Initialize.hpp>
 #include <Sapphire/compute/dense/cuda/Initialize.cuh>
 #include <Sapphire/compute/dense/naive/NaiveInitialize.hpp>
-#include <chrono>
+#include <Sapphire/util/Random.hpp>
 #include <cmath>
 
 namespace Sapphire::Compute::Initialize
 {
-void Normal(TensorUtil::TensorData& data, float mean, float sd)
+namespace
+{
+//! Curand takes single seed, so it is derived from both seed and stream
+int CudaSeed(const Util::RandomStream& stream)
+{
+    return static_cast<int>(stream.Generate(0)[0]);
+}
+
+void Normal(TensorUtil::TensorData& data, float mean, float sd,
+            const Util::RandomStream& stream)
 {
-    const auto device = data.GetDevice();
     if (data.Mode() == DeviceType::Cuda)
     {
         Dense::Cuda::Normal(data.CudaMutableRawPtr(), mean, sd,
-                            data.DenseTotalLengthCuda,
-                            static_cast<int>(std::clock()));
+                            data.DenseTotalLengthCuda, CudaSeed(stream));
     }
     else
     {
         Dense::Naive::Normal(data.HostMutableRawPtr(), mean, sd,
-                             data.GetShape());
+                             data.GetShape(), stream);
     }
 }
 
-void Uniform(TensorUtil::TensorData& data, float min, float max)
+void Uniform(TensorUtil::TensorData& data, float min, float max,
+             const Util::RandomStream& stream)
 {
-    if (const auto device = data.GetDevice();
-        data.Mode() == DeviceType::Cuda)
+    if (data.Mode() == DeviceType::Cuda)
     {
         Dense::Cuda::Uniform(data.CudaMutableRawPtr(), min, max,
-                             data.DenseTotalLengthCuda,
-                             static_cast<int>(std::clock()));
+                             data.DenseTotalLengthCuda, CudaSeed(stream));
     }
     else
     {
         Dense::Naive::Uniform(data.HostMutableRawPtr(), min, max,
-                              data.GetShape());
+                              data.GetShape(), stream);
     }
 }
 
+float HeNormalSd(int fanIn)
+{
+    return 2.0f / std::sqrt(static_cast<float>(fanIn));
+}
+
+float XavierSd(int fanIn, int fanOut)
+{
+    return 1.0f / std::sqrt(static_cast<float>(fanIn + fanOut));
+}
+} // namespace
+
+void Normal(TensorUtil::TensorData& data, float mean, float sd)
+{
+    Normal(data, mean, sd, Util::NextRandomStream());
+}
+
+void Normal(TensorUtil::TensorData& data, float mean, float sd,
+            std::uint64_t seed)
+{
+    Normal(data, mean, sd, Util::RandomStream{ seed, 0 });
+}
+
+void Uniform(TensorUtil::TensorData& data, float min, float max)
+{
+    Uniform(data, min, max, Util::NextRandomStream());
+}
+
+void Uniform(TensorUtil::TensorData& data, float min, float max,
+             std::uint64_t seed)
+{
+    Uniform(data, min, max, Util::RandomStream{ seed, 0 });
+}
+
 void Ones(TensorUtil::TensorData& data)
 {
     const auto device = data.GetDevice();
@@ -88,38 +127,23 @@ void Scalar(TensorUtil::TensorData& data, float value)
 
 void HeNormal(TensorUtil::TensorData& data, int fanIn)
 {
-    const auto device = data.GetDevice();
-    if (data.Mode() == DeviceType::Cuda)
-    {
-        Dense::Cuda::Normal(
-            data.CudaMutableRawPtr(), 0.0,
-            2.0f / std::sqrt(static_cast<float>(fanIn)),
-            data.DenseTotalLengthCuda, static_cast<int>(std::clock()));
-    }
-    else
-    {
-        Dense::Naive::Normal(data.HostMutableRawPtr(), 0.0,
-                             2.0f / std::sqrt(static_cast<float>(fanIn)),
-                             data.GetShape());
-    }
+    Normal(data, 0.0f, HeNormalSd(fanIn), Util::NextRandomStream());
+}
+
+void HeNormal(TensorUtil::TensorData& data, int fanIn, std::uint64_t seed)
+{
+    Normal(data, 0.0f, HeNormalSd(fanIn), Util::RandomStream{ seed, 0 });
 }
 
 void Xavier(TensorUtil::TensorData& data, int fanIn, int fanOut)
 {
-    const auto device = data.GetDevice();
-    if (data.Mode() == DeviceType::Cuda)
-    {
-        Dense::Cuda::Normal(
-            data.CudaMutableRawPtr(), 0.0,
-            1.0f / std::sqrt(static_cast<float>(fanIn + fanOut)),
-            data.DenseTotalLengthCuda, static_cast<int>(std::clock()));
-    }
-    else
-    {
-        Dense::Naive::Normal(data.HostMutableRawPtr(), 0.0,
-                             1.0f / std::sqrt(
-                                 static_cast<float>(fanIn + fanOut)),
-                             data.GetShape());
-    }
+    Normal(data, 0.0f, XavierSd(fanIn, fanOut), Util::NextRandomStream());
+}
+
+void Xavier(TensorUtil::TensorData& data, int fanIn, int fanOut,
+            std::uint64_t seed)
+{
+    Normal(data, 0.0f, XavierSd(fanIn, fanOut),
+           Util::RandomStream{ seed, 0 });
 }
 } // namespace Sapphire::Compute::Initialize
@@ -0,0 +1,105 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/LossOps.hpp>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Compute
+{
+namespace
+{
+void Check(bool condition, const std::string& message,
+           const std::string& caller)
+{
+    if (!condition)
+        throw std::invalid_argument("Compute::" + caller + " - " + message);
+}
+
+//! Checks operands, and returns labels as Int32 after checking their range
+std::vector<std::int32_t> CheckLabels(const TensorData& x,
+                                      const TensorData& logSumExp,
+                                      const TensorData& label,
+                                      const std::string& caller)
+{
+    Check(x.Mode() == DeviceType::Host &&
+          logSumExp.Mode() == DeviceType::Host &&
+          label.Mode() == DeviceType::Host, "Data should be on host",
+          caller);
+    Check(x.GetDataType() == DataType::Float32 &&
+          logSumExp.GetDataType() == DataType::Float32,
+          "x and logSumExp should be Float32 data", caller);
+
+    const auto cols = static_cast<std::size_t>(x.Cols());
+    Check(cols > 0, "x should not be empty", caller);
+    const auto rows = static_cast<std::size_t>(x.Size()) / cols;
+    Check(static_cast<std::size_t>(label.Size()) == rows &&
+          static_cast<std::size_t>(logSumExp.Size()) == rows,
+          "Expected " + std::to_string(rows) +
+          " elements of label and logSumExp, given : " +
+          std::to_string(label.Size()) + ", " +
+          std::to_string(logSumExp.Size()), caller);
+
+    std::vector<std::int32_t> classes(rows);
+    DispatchIntegralType(label.GetDataType(), [&](auto tag)
+    {
+        using TIndex = decltype(tag);
+        const auto* labelPtr = label.HostRawPtr<TIndex>();
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            const auto index = static_cast<long long>(labelPtr[i]);
+            if (index < 0 || index >= static_cast<long long>(cols))
+                throw std::out_of_range(
+                    "Compute::" + caller + " - Label " +
+                    std::to_string(index) + " is out of range of " +
+                    std::to_string(cols) + " classes");
+            classes[i] = static_cast<std::int32_t>(index);
+        }
+    });
+    return classes;
+}
+} // namespace
+
+void CrossEntropy(TensorData& loss, TensorData& logSumExp,
+                  const TensorData& x, const TensorData& label)
+{
+    const auto classes = CheckLabels(x, logSumExp, label, "CrossEntropy");
+    Check(loss.Mode() == DeviceType::Host &&
+          loss.GetDataType() == DataType::Float32 && loss.Size() == 1,
+          "loss should be float data of single element on host",
+          "CrossEntropy");
+
+    const auto total = Dense::Naive::CrossEntropy(
+        logSumExp.HostMutableRawPtr(), x.HostRawPtr(), classes.data(),
+        x.Size(), x.Cols());
+    *loss.HostMutableRawPtr() =
+        static_cast<float>(total / static_cast<double>(classes.size()));
+}
+
+void CrossEntropyBackward(TensorData& dx, const TensorData& dy,
+                          const TensorData& x, const TensorData& logSumExp,
+                          const TensorData& label)
+{
+    const auto classes =
+        CheckLabels(x, logSumExp, label, "CrossEntropyBackward");
+    Check(dx.Mode() == DeviceType::Host &&
+          dx.GetDataType() == DataType::Float32 && dx.Size() == x.Size(),
+          "dx should be float data on host of the same size as x",
+          "CrossEntropyBackward");
+    Check(dy.Mode() == DeviceType::Host &&
+          dy.GetDataType() == DataType::Float32 && dy.Size() == 1,
+          "dy should be float data of single element on host",
+          "CrossEntropyBackward");
+
+    Dense::Naive::CrossEntropyBackward(
+        dx.HostMutableRawPtr(), x.HostRawPtr(), logSumExp.HostRawPtr(),
+        classes.data(), *dy.HostRawPtr() / static_cast<float>(classes.size()),
+        x.Size(), x.Cols());
+}
+} // namespace Sapphire::Compute
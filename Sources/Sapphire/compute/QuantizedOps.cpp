@@ -0,0 +1,253 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/QuantizedOps.hpp>
+#include <Sapphire/compute/dense/naive/Conv2D.hpp>
+#include <Sapphire/compute/dense/naive/NaiveQuantizedGemm.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Compute
+{
+namespace
+{
+//! Operands of quantized gemm resolved from given tensors
+struct QuantizedGemmArgs
+{
+    unsigned int M = 0;
+    unsigned int N = 0;
+    unsigned int K = 0;
+    //! Points to prepacked operand of b, or to Packed
+    const Dense::Naive::PackedInt8Operand* B = nullptr;
+    Dense::Naive::PackedInt8Operand Packed;
+    //! Params of b for each column of op(b)
+    std::vector<float> ScaleB;
+    std::vector<std::int32_t> ZeroPointB;
+};
+
+void Check(bool condition, const std::string& message,
+           const std::string& caller = "QuantizedGemm")
+{
+    if (!condition)
+        throw std::invalid_argument("Compute::" + caller + " - " + message);
+}
+
+//! Resolves params and packed operand of b, whose (K x N) operand has output
+//! channels along channelAxis of b
+void ResolveOperandB(QuantizedGemmArgs& args, const QuantizedTensorData& b,
+                     bool transB, int channelAxis, int numThreads,
+                     const std::string& caller)
+{
+    Check(b.ChannelAxis() < 0 || b.ChannelAxis() == channelAxis,
+          "b should be quantized per tensor or per output channel", caller);
+    for (unsigned int j = 0; j < args.N; ++j)
+    {
+        const auto params = b.GetParams(b.ChannelAxis() < 0 ? 0 : j);
+        args.ScaleB.emplace_back(params.Scale);
+        args.ZeroPointB.emplace_back(params.ZeroPoint);
+    }
+
+    //! Prepacked operand is used only if it was packed with the same view
+    args.B = b.Prepacked(transB);
+    if (!args.B || args.B->K != args.K || args.B->N != args.N)
+    {
+        args.Packed = Dense::Naive::PackInt8Operand(
+            b.Int8RawPtr(), args.K, args.N, transB, numThreads);
+        args.B = &args.Packed;
+    }
+}
+
+void ResolveArgs(QuantizedGemmArgs& args, const QuantizedTensorData& a,
+                 const QuantizedTensorData& b, bool transB,
+                 int outputSize, int numThreads)
+{
+    const auto shapeA = a.GetShape();
+    const auto shapeB = b.GetShape();
+    Check(a.GetType() == QuantizedType::UInt8 && a.ChannelAxis() < 0,
+          "a should be UInt8 quantized per tensor");
+    Check(b.GetType() == QuantizedType::Int8, "b should be Int8");
+    Check(shapeB.Size() == shapeB.Rows() * shapeB.Cols(),
+          "b should be single matrix. Given shape : " + shapeB.ToString());
+
+    args.K = static_cast<unsigned int>(shapeA.Cols());
+    args.M = args.K == 0 ? 0 : shapeA.Size() / args.K;
+    args.N = static_cast<unsigned int>(transB ? shapeB.Rows()
+                                              : shapeB.Cols());
+    const auto kB = static_cast<unsigned int>(transB ? shapeB.Cols()
+                                                     : shapeB.Rows());
+    Check(kB == args.K, "Inner dimensions do not match. a : " +
+                        shapeA.ToString() + " b : " + shapeB.ToString());
+    Check(static_cast<long long>(outputSize) ==
+          static_cast<long long>(args.M) * args.N,
+          "Output should have " + std::to_string(args.M * args.N) +
+          " elements");
+
+    //! Output channels are the columns of op(b)
+    ResolveOperandB(args, b, transB, shapeB.Dim() - (transB ? 2 : 1),
+                    numThreads, "QuantizedGemm");
+}
+
+const float* ResolveBias(const TensorData& bias, unsigned int N,
+                         const std::string& caller = "QuantizedGemm")
+{
+    Check(bias.Mode() == DeviceType::Host, "bias should be on host", caller);
+    Check(bias.GetShape().Size() == static_cast<int>(N),
+          "bias should have " + std::to_string(N) + " elements", caller);
+    return bias.HostRawPtr();
+}
+
+//! Computes quantized convolution as gemm of (P x K) matrix of input patches
+//! and (K x yC) filter for each batch, where P is number of output pixels
+//! Output of each gemm is written transposed, so that y is laid out as
+//! (N, yC, yH, yW)
+void QuantizedConv2DImpl(TensorData& y, const QuantizedTensorData& x,
+                         const QuantizedTensorData& filter,
+                         const TensorData* bias, int strideRow,
+                         int strideCol, int dilationRow, int dilationCol,
+                         int rowPadding, int columnPadding, int numThreads)
+{
+    const std::string caller = "QuantizedConv2DForward";
+    const auto xShape = x.GetShape();
+    const auto filterShape = filter.GetShape();
+    const auto yShape = y.GetShape();
+    Check(y.Mode() == DeviceType::Host, "y should be on host", caller);
+    Check(x.GetType() == QuantizedType::UInt8 && x.ChannelAxis() < 0,
+          "x should be UInt8 quantized per tensor", caller);
+    Check(filter.GetType() == QuantizedType::Int8, "filter should be Int8",
+          caller);
+    Check(xShape.Dim() >= 4 && filterShape.Dim() == 4 &&
+          yShape.Dim() == xShape.Dim(),
+          "x and y should have shape of (*, C, H, W), and filter should have "
+          "shape of (yC, xC, H, W)", caller);
+
+    const auto xChannels = xShape.At(xShape.Dim() - 3);
+    const auto yChannels = filterShape.At(0);
+    Check(filterShape.At(1) == xChannels,
+          "Channels of filter and x do not match. x : " + xShape.ToString() +
+          " filter : " + filterShape.ToString(), caller);
+
+    const auto outputRows =
+        (xShape.Rows() + 2 * rowPadding -
+         dilationRow * (filterShape.Rows() - 1) - 1) / strideRow + 1;
+    const auto outputCols =
+        (xShape.Cols() + 2 * columnPadding -
+         dilationCol * (filterShape.Cols() - 1) - 1) / strideCol + 1;
+    Check(outputRows > 0 && outputCols > 0, "Output is empty", caller);
+    Check(yShape.At(yShape.Dim() - 3) == yChannels &&
+          yShape.Rows() == outputRows && yShape.Cols() == outputCols &&
+          yShape.Size() / (yChannels * outputRows * outputCols) ==
+          xShape.Size() / (xChannels * xShape.Rows() * xShape.Cols()),
+          "y should have shape of (*, " + std::to_string(yChannels) + ", " +
+          std::to_string(outputRows) + ", " + std::to_string(outputCols) +
+          "). Given shape : " + yShape.ToString(), caller);
+
+    QuantizedGemmArgs args;
+    args.M = static_cast<unsigned int>(outputRows * outputCols);
+    args.N = static_cast<unsigned int>(yChannels);
+    args.K = static_cast<unsigned int>(filterShape.Size() / yChannels);
+    ResolveOperandB(args, filter, true, 0, numThreads, caller);
+    const float* biasPtr =
+        bias ? ResolveBias(*bias, args.N, caller) : nullptr;
+
+    const auto paramsX = x.GetParams(0);
+    const auto batchSize = xShape.Size() /
+                           (xChannels * xShape.Rows() * xShape.Cols());
+    const auto inputMatrixSize = static_cast<std::size_t>(args.K) * args.M;
+    std::vector<std::uint8_t> inputMatrix(inputMatrixSize * batchSize);
+    Dense::Naive::Im2Col(inputMatrix.data(), x.UInt8RawPtr(), xShape,
+                         filterShape.Rows(), filterShape.Cols(), strideRow,
+                         strideCol, rowPadding, columnPadding, dilationRow,
+                         dilationCol,
+                         static_cast<std::uint8_t>(paramsX.ZeroPoint));
+
+    const auto outputSize = static_cast<std::size_t>(args.N) * args.M;
+    for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        Dense::Naive::QuantizedGemm(
+            y.HostMutableRawPtr() + outputSize * batchIdx,
+            inputMatrix.data() + inputMatrixSize * batchIdx, *args.B, args.M,
+            true, true, paramsX.Scale, paramsX.ZeroPoint, args.ScaleB.data(),
+            args.ZeroPointB.data(), biasPtr, false, 0.0f, numThreads);
+}
+} // namespace
+
+void QuantizedGemm(TensorData& y, const QuantizedTensorData& a,
+                   const QuantizedTensorData& b, bool transB, int numThreads)
+{
+    Check(y.Mode() == DeviceType::Host, "y should be on host");
+    QuantizedGemmArgs args;
+    ResolveArgs(args, a, b, transB, y.GetShape().Size(), numThreads);
+
+    const auto paramsA = a.GetParams(0);
+    Dense::Naive::QuantizedGemm(
+        y.HostMutableRawPtr(), a.UInt8RawPtr(), *args.B, args.M, false, false,
+        paramsA.Scale, paramsA.ZeroPoint, args.ScaleB.data(),
+        args.ZeroPointB.data(), nullptr, false, 0.0f, numThreads);
+}
+
+void QuantizedGemmBiasActivation(TensorData& y, const QuantizedTensorData& a,
+                                 const QuantizedTensorData& b,
+                                 const TensorData& bias, bool transB,
+                                 GemmActivation activation,
+                                 float negativeSlope, int numThreads)
+{
+    Check(y.Mode() == DeviceType::Host, "y should be on host");
+    QuantizedGemmArgs args;
+    ResolveArgs(args, a, b, transB, y.GetShape().Size(), numThreads);
+
+    const auto paramsA = a.GetParams(0);
+    Dense::Naive::QuantizedGemm(
+        y.HostMutableRawPtr(), a.UInt8RawPtr(), *args.B, args.M, false, false,
+        paramsA.Scale, paramsA.ZeroPoint, args.ScaleB.data(),
+        args.ZeroPointB.data(), ResolveBias(bias, args.N),
+        activation != GemmActivation::None,
+        activation == GemmActivation::LeakyReLU ? negativeSlope : 0.0f,
+        numThreads);
+}
+
+void QuantizedGemmBiasActivation(QuantizedTensorData& y,
+                                 const QuantizedTensorData& a,
+                                 const QuantizedTensorData& b,
+                                 const TensorData& bias, bool transB,
+                                 GemmActivation activation,
+                                 float negativeSlope, int numThreads)
+{
+    Check(y.GetType() == QuantizedType::UInt8 && y.ChannelAxis() < 0,
+          "y should be UInt8 quantized per tensor");
+    QuantizedGemmArgs args;
+    ResolveArgs(args, a, b, transB, y.GetShape().Size(), numThreads);
+
+    const auto paramsA = a.GetParams(0);
+    const auto paramsY = y.GetParams(0);
+    Dense::Naive::QuantizedGemmRequantize(
+        y.UInt8MutableRawPtr(), a.UInt8RawPtr(), *args.B, args.M, false, false,
+        paramsA.Scale, paramsA.ZeroPoint, args.ScaleB.data(),
+        args.ZeroPointB.data(), ResolveBias(bias, args.N),
+        activation != GemmActivation::None,
+        activation == GemmActivation::LeakyReLU ? negativeSlope : 0.0f,
+        paramsY.Scale, paramsY.ZeroPoint, numThreads);
+}
+
+void QuantizedConv2DForward(TensorData& y, const QuantizedTensorData& x,
+                            const QuantizedTensorData& filter, int strideRow,
+                            int strideCol, int dilationRow, int dilationCol,
+                            int rowPadding, int columnPadding, int numThreads)
+{
+    QuantizedConv2DImpl(y, x, filter, nullptr, strideRow, strideCol,
+                        dilationRow, dilationCol, rowPadding, columnPadding,
+                        numThreads);
+}
+
+void QuantizedConv2DForward(TensorData& y, const QuantizedTensorData& x,
+                            const QuantizedTensorData& filter,
+                            const TensorData& bias, int strideRow,
+                            int strideCol, int dilationRow, int dilationCol,
+                            int rowPadding, int columnPadding, int numThreads)
+{
+    QuantizedConv2DImpl(y, x, filter, &bias, strideRow, strideCol,
+                        dilationRow, dilationCol, rowPadding, columnPadding,
+                        numThreads);
+}
+} // namespace Sapphire::Compute
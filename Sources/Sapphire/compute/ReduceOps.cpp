@@ -0,0 +1,127 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/ReduceOps.hpp>
+#include <Sapphire/compute/dense/naive/NaiveReduce.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Compute
+{
+namespace
+{
+void Check(bool condition, const std::string& message,
+           const std::string& caller)
+{
+    if (!condition)
+        throw std::invalid_argument("Compute::" + caller + " - " + message);
+}
+
+//! Returns whether each dimension of shape is reduced
+std::vector<bool> ReducedDims(const Shape& shape, const std::vector<int>& axes,
+                              const std::string& caller)
+{
+    const auto dim = shape.Dim();
+    std::vector<bool> reduced(dim, axes.empty());
+    for (const auto axis : axes)
+    {
+        Check(axis >= -dim && axis < dim,
+              "Axis " + std::to_string(axis) + " is out of range of " +
+              shape.ToString(), caller);
+        reduced[axis < 0 ? axis + dim : axis] = true;
+    }
+    return reduced;
+}
+
+Dense::Naive::ReduceLayout MakeLayout(const TensorData& y,
+                                      const TensorData& x,
+                                      const std::vector<int>& axes,
+                                      DataType yType,
+                                      const std::string& caller)
+{
+    Check(y.Mode() == DeviceType::Host && x.Mode() == DeviceType::Host,
+          "Data should be on host", caller);
+    Check(x.GetDataType() == DataType::Float32, "x should be Float32 data",
+          caller);
+    Check(y.GetDataType() == yType,
+          "y should be " + DataTypeToString(yType) + " data", caller);
+
+    const auto xShape = x.GetShape();
+    const auto yShape = y.GetShape();
+    auto reduced = ReducedDims(xShape, axes, caller);
+    Check(yShape == ReducedShape(xShape, axes, true) ||
+          yShape == ReducedShape(xShape, axes, false),
+          "Shape of y " + yShape.ToString() +
+          " does not match reduction of " + xShape.ToString(), caller);
+    return Dense::Naive::MakeReduceLayout(xShape.GetShapeVector(), reduced);
+}
+} // namespace
+
+Shape ReducedShape(const Shape& shape, const std::vector<int>& axes,
+                   bool keepDims)
+{
+    const auto reduced = ReducedDims(shape, axes, "ReducedShape");
+    std::vector<int> result;
+    for (int i = 0; i < shape.Dim(); ++i)
+    {
+        if (!reduced[i])
+            result.emplace_back(shape.At(i));
+        else if (keepDims)
+            result.emplace_back(1);
+    }
+    if (result.empty())
+        result.emplace_back(1);
+    return Shape(result);
+}
+
+void Sum(TensorData& y, const TensorData& x, const std::vector<int>& axes)
+{
+    const auto layout = MakeLayout(y, x, axes, DataType::Float32, "Sum");
+    Dense::Naive::Sum(y.HostMutableRawPtr(), x.HostRawPtr(), layout);
+}
+
+void Mean(TensorData& y, const TensorData& x, const std::vector<int>& axes)
+{
+    const auto layout = MakeLayout(y, x, axes, DataType::Float32, "Mean");
+    Dense::Naive::Mean(y.HostMutableRawPtr(), x.HostRawPtr(), layout);
+}
+
+void Max(TensorData& y, const TensorData& x, const std::vector<int>& axes)
+{
+    const auto layout = MakeLayout(y, x, axes, DataType::Float32, "Max");
+    Dense::Naive::Max(y.HostMutableRawPtr(), x.HostRawPtr(), layout);
+}
+
+void Min(TensorData& y, const TensorData& x, const std::vector<int>& axes)
+{
+    const auto layout = MakeLayout(y, x, axes, DataType::Float32, "Min");
+    Dense::Naive::Min(y.HostMutableRawPtr(), x.HostRawPtr(), layout);
+}
+
+void ArgMax(TensorData& y, const TensorData& x, int axis)
+{
+    const auto layout = MakeLayout(y, x, { axis }, DataType::Int32, "ArgMax");
+    Dense::Naive::ArgMax(y.HostMutableRawPtr<std::int32_t>(), x.HostRawPtr(),
+                         layout);
+}
+
+void Var(TensorData& y, const TensorData& x, const std::vector<int>& axes,
+         unsigned int correction)
+{
+    const auto layout = MakeLayout(y, x, axes, DataType::Float32, "Var");
+    Dense::Naive::Variance(y.HostMutableRawPtr(), x.HostRawPtr(), layout,
+                           correction);
+}
+
+void MeanBackward(TensorData& dx, const TensorData& dy,
+                  const std::vector<int>& axes)
+{
+    const auto layout =
+        MakeLayout(dy, dx, axes, DataType::Float32, "MeanBackward");
+    Dense::Naive::MeanBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                               layout);
+}
+} // namespace Sapphire::Compute
@@ -118,7 +118,8 @@ void ArcCos(TensorData& y, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::ArcCos - Host not implemented");
+        Dense::Naive::ArcCos(y.HostMutableRawPtr(), x.HostRawPtr(),
+                             totalSize);
     }
 }
 
@@ -134,7 +135,8 @@ void Arcsin(TensorData& y, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::ArcSin - Host not implemented");
+        Dense::Naive::ArcSin(y.HostMutableRawPtr(), x.HostRawPtr(),
+                             totalSize);
     }
 }
 
@@ -151,7 +153,8 @@ void ArcTan(TensorData& y, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::ArcTan - Host not implemented");
+        Dense::Naive::ArcTan(y.HostMutableRawPtr(), x.HostRawPtr(),
+                             totalSize);
     }
 }
 
@@ -166,7 +169,8 @@ void ArcCosh(TensorData& y, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::ArcCosh - Host not implemented");
+        Dense::Naive::ArcCosh(y.HostMutableRawPtr(), x.HostRawPtr(),
+                              totalSize);
     }
 }
 
@@ -182,7 +186,8 @@ void ArcSinh(TensorData& y, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::ArcSinh - Host not implemented");
+        Dense::Naive::ArcSinh(y.HostMutableRawPtr(), x.HostRawPtr(),
+                              totalSize);
     }
 }
 
@@ -198,7 +203,8 @@ void ArcTanh(TensorData& y, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::ArcTanh - Host not implemented");
+        Dense::Naive::ArcTanh(y.HostMutableRawPtr(), x.HostRawPtr(),
+                              totalSize);
     }
 }
 
@@ -214,7 +220,8 @@ void CosBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::CosBackward - Host not implemented");
+        Dense::Naive::CosBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                  x.HostRawPtr(), totalSize);
     }
 }
 
@@ -230,7 +237,8 @@ void SinBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::SinBackward - Host not implemented");
+        Dense::Naive::SinBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                  x.HostRawPtr(), totalSize);
     }
 }
 
@@ -246,7 +254,8 @@ void TanBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error("Compute::TanBackward - Host not implemented");
+        Dense::Naive::TanBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                  x.HostRawPtr(), totalSize);
     }
 }
 
@@ -262,8 +271,8 @@ void CoshBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::CoshBackward - Host not implemented");
+        Dense::Naive::CoshBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                   x.HostRawPtr(), totalSize);
     }
 }
 
@@ -279,8 +288,8 @@ void SinhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::SinhBackward - Host not implemented");
+        Dense::Naive::SinhBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                   x.HostRawPtr(), totalSize);
     }
 }
 
@@ -296,8 +305,8 @@ void TanhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::TanhBackward - Host not implemented");
+        Dense::Naive::TanhBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                   x.HostRawPtr(), totalSize);
     }
 }
 
@@ -313,8 +322,8 @@ void ArcCosBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::ArcCosBackward - Host not implemented");
+        Dense::Naive::ArcCosBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                     x.HostRawPtr(), totalSize);
     }
 }
 
@@ -330,8 +339,8 @@ void ArcSinBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::ArcSinBackward - Host not implemented");
+        Dense::Naive::ArcSinBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                     x.HostRawPtr(), totalSize);
     }
 }
 
@@ -347,8 +356,8 @@ void ArcTanBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::ArcTanBackward- Host not implemented");
+        Dense::Naive::ArcTanBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                     x.HostRawPtr(), totalSize);
     }
 }
 
@@ -365,8 +374,8 @@ void ArcCoshBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::ArcCoshBackward - Host not implemented");
+        Dense::Naive::ArcCoshBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                      x.HostRawPtr(), totalSize);
     }
 }
 
@@ -383,8 +392,8 @@ void ArcSinhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::ArcSinhBackward - Host not implemented");
+        Dense::Naive::ArcSinhBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                      x.HostRawPtr(), totalSize);
     }
 }
 
@@ -401,8 +410,8 @@ void ArcTanhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
     }
     else
     {
-        throw std::runtime_error(
-            "Compute::ArcTanhBackward - Host not implemented");
+        Dense::Naive::ArcTanhBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
+                                      x.HostRawPtr(), totalSize);
     }
 }
 }
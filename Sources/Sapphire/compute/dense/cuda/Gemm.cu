@@ -18,8 +18,8 @@ namespace Sapphire::Compute::Dense::Cuda
 //! batch sizes must be multiple of each other
 __host__ void Gemm(unsigned int totalSize, float* out, const float* A,
                    const float* B, unsigned int M, unsigned int N,
-                   unsigned int K,
-                   int deviceId)
+                   unsigned int K, bool transA, bool transB, float alpha,
+                   float beta, int deviceId)
 {
     const auto tid = std::this_thread::get_id();
     if (!Util::ResourceManager::HasCublasHandle(deviceId, tid))
@@ -30,9 +30,6 @@ __host__ void Gemm(unsigned int totalSize, float* out, const float* A,
         deviceId, tid);
     cublasSetMathMode(*handle, CUBLAS_TF32_TENSOR_OP_MATH);
 
-    const float alpha = 1.0f;
-    const float beta = 1.0f;
-
     const auto strideA = M * K;
     const auto strideB = K * N;
     const auto strideOut = M * N;
@@ -41,10 +38,18 @@ __host__ void Gemm(unsigned int totalSize, float* out, const float* A,
     const float* ptrB = B;
     float* ptrOut = out;
 
+    //! cublas is column-major, so row-major out^T = op(B)^T x op(A)^T is
+    //! computed instead
+    const auto opA = transA ? CUBLAS_OP_T : CUBLAS_OP_N;
+    const auto opB = transB ? CUBLAS_OP_T : CUBLAS_OP_N;
+    const auto lda = transA ? M : K;
+    const auto ldb = transB ? K : N;
+
     CHECK_CUBLAS(cublasGemmStridedBatchedEx(
-        *handle, CUBLAS_OP_N, CUBLAS_OP_N, static_cast<int>(N),
+        *handle, opB, opA, static_cast<int>(N),
         static_cast<int>(M), static_cast<int>(K), &alpha, ptrB, CUDA_R_32F,
-        static_cast<int>(N), strideB, ptrA, CUDA_R_32F, static_cast<int>(K),
+        static_cast<int>(ldb), strideB, ptrA, CUDA_R_32F,
+        static_cast<int>(lda),
         strideA, &beta, ptrOut, CUDA_R_32F, static_cast<int>(N), strideOut,
         static_cast<int>(totalSize / strideOut), CUBLAS_COMPUTE_32F_FAST_TF32,
         CUBLAS_GEMM_DEFAULT_TENSOR_OP))
@@ -56,7 +61,9 @@ __host__ void GemmMatrixWiseBroadcast(float* out, const float* A,
                                       const float* B, 
                                       unsigned int M, unsigned int N,
                                       unsigned int K, unsigned int batchSize,
-                                      bool broadcastA, bool broadcastB,int deviceId)
+                                      bool broadcastA, bool broadcastB,
+                                      bool transA, bool transB, float alpha,
+                                      float beta, int deviceId)
 {
     const auto tid = std::this_thread::get_id();
     if (!Util::ResourceManager::HasCublasHandle(deviceId, tid))
@@ -67,18 +74,19 @@ __host__ void GemmMatrixWiseBroadcast(float* out, const float* A,
 
     cublasSetMathMode(*handle, CUBLAS_TF32_TENSOR_OP_MATH);
 
-    const float alpha = 1.0f;
-    const float beta = 1.0f;
-
     const auto strideA = (broadcastA ? 0 : (M * K));
     const auto strideB = (broadcastB ? 0 : (K * N));
     const auto strideOut = M * N;
 
+    const auto opA = transA ? CUBLAS_OP_T : CUBLAS_OP_N;
+    const auto opB = transB ? CUBLAS_OP_T : CUBLAS_OP_N;
+    const auto lda = transA ? M : K;
+    const auto ldb = transB ? K : N;
 
     CHECK_CUBLAS(cublasGemmStridedBatchedEx(
-        *handle, CUBLAS_OP_N, CUBLAS_OP_N, static_cast<int>(N),
+        *handle, opB, opA, static_cast<int>(N),
         static_cast<int>(M), static_cast<int>(K), &alpha, B, CUDA_R_32F,
-        static_cast<int>(N), strideB, A, CUDA_R_32F, static_cast<int>(K),
+        static_cast<int>(ldb), strideB, A, CUDA_R_32F, static_cast<int>(lda),
         strideA, &beta, out, CUDA_R_32F, static_cast<int>(N), strideOut,
         static_cast<int>(batchSize), CUBLAS_COMPUTE_32F_FAST_TF32,
         CUBLAS_GEMM_DEFAULT_TENSOR_OP))
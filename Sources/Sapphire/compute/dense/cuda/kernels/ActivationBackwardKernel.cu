@@ -35,7 +35,7 @@ __global__ void LeakyReLUBackwardKernel(float* dx, const float* dy,
     for (unsigned int i = 0; i < numLoops; i++)
     {
         const auto idx = blockOffset + blockDim.x * i + threadIdx.x;
-        dx[idx] = x[idx] > 0.0f ? dy[idx] : a;
+        dx[idx] = x[idx] > 0.0f ? dy[idx] : a * dy[idx];
     }
 }
 
@@ -59,7 +59,7 @@ __global__ void SoftMaxBackwardKernel(float* dx, const float* dy,
             else
                 gradX += dy[j] * (-y[i] * y[j]);
         }
-        dx[i] = gradX;
+        dx[i] += gradX;
     }
 }
 }
@@ -46,7 +46,7 @@ __global__ void TanBackwardKernel(float* dx, const float* dy, const float* x,
     for (unsigned int i = 0; i < numLoops; i++)
     {
         const auto idx = blockOffset + blockDim.x * i + threadIdx.x;
-        dx[idx] -= dy[idx] * powf((1 / cosf(x[idx])), 2);
+        dx[idx] += dy[idx] * powf((1 / cosf(x[idx])), 2);
     }
 }
 
@@ -102,7 +102,7 @@ __global__ void ArcCosBackwardKernel(float* dx, const float* dy, const float* x,
     for (unsigned int i = 0; i < numLoops; i++)
     {
         const auto idx = blockOffset + blockDim.x * i + threadIdx.x;
-        dx[idx] -= dy[idx] / (1 - powf(x[idx], 2));
+        dx[idx] -= dy[idx] / sqrtf(1 - powf(x[idx], 2));
     }
 }
 
@@ -116,7 +116,7 @@ __global__ void ArcSinBackwardKernel(float* dx, const float* dy, const float* x,
     for (unsigned int i = 0; i < numLoops; i++)
     {
         const auto idx = blockOffset + blockDim.x * i + threadIdx.x;
-        dx[idx] += dy[idx] / (1 - powf(x[idx], 2));
+        dx[idx] += dy[idx] / sqrtf(1 - powf(x[idx], 2));
     }
 }
 
@@ -144,7 +144,7 @@ __global__ void ArcCoshBackwardKernel(float* dx, const float* dy,
     for (unsigned int i = 0; i < numLoops; i++)
     {
         const auto idx = blockOffset + blockDim.x * i + threadIdx.x;
-        dx[idx] += dy[idx] / (powf(x[idx], 2) - 1);
+        dx[idx] += dy[idx] / sqrtf(powf(x[idx], 2) - 1);
     }
 }
 
@@ -158,7 +158,7 @@ __global__ void ArcSinhBackwardKernel(float* dx, const float* dy,
     for (unsigned int i = 0; i < numLoops; i++)
     {
         const auto idx = blockOffset + blockDim.x * i + threadIdx.x;
-        dx[idx] += dy[idx] / (1 + powf(x[idx], 2));
+        dx[idx] += dy[idx] / sqrtf(1 + powf(x[idx], 2));
     }
 }
 
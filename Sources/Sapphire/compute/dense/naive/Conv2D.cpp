@@ -4,215 +4,314 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <memory>
 #include <Sapphire/compute/dense/naive/Conv2D.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/util/Parallel.hpp>
 
 namespace Sapphire::Compute::Dense::Naive
 {
 using namespace TensorUtil;
 
+namespace
+{
+//! Im2Col and Col2Im are parallel over planes of (batch, channel) if they
+//! move at least this many elements
+constexpr std::size_t ParallelThreshold = 1u << 16;
+
+//! Geometry of the convolution shared by Im2Col and Col2Im
+//! Each (channel, filterRow, filterCol) selects a row of the input matrix,
+//! and each output row maps to contiguous run of OutputCols elements of it,
+//! which are taken from single row of the input with stride of StrideCol
+struct Im2ColLayout
+{
+    int Channels, InputRows, InputCols;
+    int FilterRows, FilterCols;
+    int OutputRows, OutputCols;
+    int StrideRow, StrideCol;
+    int RowPadding, ColPadding;
+    int DilationRow, DilationCol;
+
+    [[nodiscard]] std::size_t InputPlaneSize() const
+    {
+        return static_cast<std::size_t>(InputRows) * InputCols;
+    }
+
+    [[nodiscard]] std::size_t OutputSize() const
+    {
+        return static_cast<std::size_t>(OutputRows) * OutputCols;
+    }
+
+    //! Filters are flipped, so that rows of the input matrix are ordered
+    //! from the last element of the filter to the first one
+    [[nodiscard]] std::size_t MatrixRow(int channelIdx, int filterRowIdx,
+                                        int filterColIdx) const
+    {
+        return static_cast<std::size_t>(FilterRows) * FilterCols *
+               (channelIdx + 1) -
+               (filterRowIdx * FilterCols + filterColIdx) - 1;
+    }
+
+    //! Range [first, last) of output columns whose input column
+    //! (outputColIdx * StrideCol + inputColOffset) is inside the input
+    void ColumnRange(int inputColOffset, int& first, int& last) const
+    {
+        first = inputColOffset >= 0
+                    ? 0
+                    : (-inputColOffset + StrideCol - 1) / StrideCol;
+        last = InputCols - inputColOffset <= 0
+                   ? 0
+                   : (InputCols - inputColOffset + StrideCol - 1) / StrideCol;
+        last = std::min(last, OutputCols);
+        first = std::min(first, last);
+    }
+};
+
+Im2ColLayout MakeIm2ColLayout(const Shape& inputShape, int filterRows,
+                              int filterCols, int strideRow, int strideCol,
+                              int rowPadding, int colPadding, int dilationRow,
+                              int dilationCol)
+{
+    Im2ColLayout layout{};
+    layout.Channels = inputShape.At(inputShape.Dim() - 3);
+    layout.InputRows = inputShape.Rows();
+    layout.InputCols = inputShape.Cols();
+    layout.FilterRows = filterRows;
+    layout.FilterCols = filterCols;
+    layout.OutputRows = (inputShape.Rows() + 2 * rowPadding -
+                         dilationRow * (filterRows - 1) - 1) / strideRow + 1;
+    layout.OutputCols = (inputShape.Cols() + 2 * colPadding -
+                         dilationCol * (filterCols - 1) - 1) / strideCol + 1;
+    layout.StrideRow = strideRow;
+    layout.StrideCol = strideCol;
+    layout.RowPadding = rowPadding;
+    layout.ColPadding = colPadding;
+    layout.DilationRow = dilationRow;
+    layout.DilationCol = dilationCol;
+    return layout;
+}
+
+//! Calls func(batchIdx, channelIdx) for every plane of the input, split over
+//! the threads. Each call touches only its own rows of the input matrix and
+//! its own plane of the input, so planes are independent
+template <typename Func>
+void ForEachPlane(const Im2ColLayout& layout, int batchSize, Func func)
+{
+    const long long numPlanes =
+        static_cast<long long>(batchSize) * layout.Channels;
+    const auto work = static_cast<std::size_t>(numPlanes) *
+                      layout.FilterRows * layout.FilterCols *
+                      layout.OutputSize();
+    const auto threads = Util::ResolveNumThreads(0);
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1 && numPlanes > 1 && work >= ParallelThreshold)
+    for (long long planeIdx = 0; planeIdx < numPlanes; ++planeIdx)
+        func(static_cast<int>(planeIdx / layout.Channels),
+             static_cast<int>(planeIdx % layout.Channels));
+}
+
+//! Writes rows of the input matrix for single plane of the input
+//! Padded rows are filled, and interior of the other rows is copied as
+//! contiguous run (or gathered with stride of StrideCol) between the padded
+//! columns
+template <typename T, typename CopyFunc>
+void Im2ColPlane(T* inputMatrix, const T* inputPlane,
+                 const Im2ColLayout& layout, int channelIdx, T pad,
+                 CopyFunc copy)
+{
+    const auto outputSize = layout.OutputSize();
+    for (int filterRowIdx = 0; filterRowIdx < layout.FilterRows;
+         ++filterRowIdx)
+        for (int filterColIdx = 0; filterColIdx < layout.FilterCols;
+             ++filterColIdx)
+        {
+            auto* matrixRow =
+                inputMatrix +
+                layout.MatrixRow(channelIdx, filterRowIdx, filterColIdx) *
+                outputSize;
+            const auto inputColOffset =
+                filterColIdx * layout.DilationCol - layout.ColPadding;
+            int firstCol, lastCol;
+            layout.ColumnRange(inputColOffset, firstCol, lastCol);
+
+            for (int outputRowIdx = 0; outputRowIdx < layout.OutputRows;
+                 ++outputRowIdx)
+            {
+                const auto inputRowIdx = outputRowIdx * layout.StrideRow +
+                                         filterRowIdx * layout.DilationRow -
+                                         layout.RowPadding;
+                auto* dst = matrixRow + static_cast<std::size_t>(
+                                outputRowIdx) * layout.OutputCols;
+
+                if (inputRowIdx < 0 || inputRowIdx >= layout.InputRows)
+                {
+                    std::fill(dst, dst + layout.OutputCols, pad);
+                    continue;
+                }
+
+                const auto* src =
+                    inputPlane +
+                    static_cast<std::size_t>(inputRowIdx) * layout.InputCols +
+                    inputColOffset + firstCol * layout.StrideCol;
+                std::fill(dst, dst + firstCol, pad);
+                copy(dst + firstCol, src,
+                     static_cast<unsigned int>(lastCol - firstCol));
+                std::fill(dst + lastCol, dst + layout.OutputCols, pad);
+            }
+        }
+}
+} // namespace
+
 void Im2Col(TensorData& inputMatrix, const TensorData& filter,
             const TensorData& input, int strideRow, int strideCol,
             int rowPadding, int colPadding, int dilationRow, int dilationCol,
             float pad)
 {
-    const auto inputShape = input.GetShape();
     const auto filterShape = filter.GetShape();
-    const auto numChannels = filterShape.At(filterShape.Dim() - 3);
-    const auto inputMatrixShape = inputMatrix.GetShape();
-
-    int N = 1;
-    for (int i = 0; i < inputShape.Dim() - 3; ++i)
-        N *= inputShape.At(i);
-
-    //! Size of the output after the full convolution
-    const int outputRows =
-        (inputShape.Rows() + 2 * rowPadding -
-         dilationRow * (filterShape.Rows() - 1) - 1) /
-        strideRow +
-        1;
-    const int outputCols =
-        (inputShape.Cols() + 2 * colPadding -
-         dilationCol * (filterShape.Cols() - 1) - 1) /
-        strideCol +
-        1;
-
-    const auto InputSizePerBatch =
-        numChannels * inputShape.Rows() * inputShape.Cols();
-    const auto InputMatrixSizePerBatch =
-        inputMatrixShape.Rows() * inputMatrixShape.Cols();
-
-    for (int nIdx = 0; nIdx < N; ++nIdx)
+    const auto layout = MakeIm2ColLayout(
+        input.GetShape(), filterShape.Rows(), filterShape.Cols(), strideRow,
+        strideCol, rowPadding, colPadding, dilationRow, dilationCol);
+    assert(layout.Channels == filterShape.At(filterShape.Dim() - 3));
+
+    const auto inputSizePerBatch = layout.InputPlaneSize() * layout.Channels;
+    const auto inputMatrixSizePerBatch =
+        static_cast<std::size_t>(layout.Channels) * layout.FilterRows *
+        layout.FilterCols * layout.OutputSize();
+    const auto N = static_cast<int>(input.Size() / inputSizePerBatch);
+
+    const auto* inputData = input.HostRawPtr();
+    auto* inputMatrixData = inputMatrix.HostMutableRawPtr();
+    const auto gather = GetHostKernels().Gather;
+    const auto stride = static_cast<unsigned int>(strideCol);
+
+    ForEachPlane(layout, N, [&](int nIdx, int channelIdx)
     {
-        const auto* inputDataHost =
-            input.HostRawPtr() + InputSizePerBatch * nIdx;
-        auto* inputMatrixDataHost =
-            inputMatrix.HostMutableRawPtr() + InputMatrixSizePerBatch *
-            nIdx;
-        for (int channelIdx = 0; channelIdx < numChannels;
-             ++channelIdx)
-        {
-            for (int outputRowIdx = 0; outputRowIdx < outputRows;
-                 outputRowIdx += 1)
-                for (int outputColIdx = 0; outputColIdx < outputCols;
-                     outputColIdx += 1)
-                    for (int filterRowIdx = 0;
-                         filterRowIdx < (filterShape.Rows());
-                         ++filterRowIdx)
-                        for (int filterColIdx = 0;
-                             filterColIdx <
-                             (filterShape.Cols());
-                             ++filterColIdx)
+        Im2ColPlane(inputMatrixData + inputMatrixSizePerBatch * nIdx,
+                    inputData + inputSizePerBatch * nIdx +
+                    layout.InputPlaneSize() * channelIdx,
+                    layout, channelIdx, pad,
+                    [gather, stride](float* dst, const float* src,
+                                     unsigned int count)
+                    {
+                        gather(dst, src, count, stride);
+                    });
+    });
+}
+
+void Im2Col(std::uint8_t* inputMatrix, const std::uint8_t* input,
+            const Shape& inputShape, int filterRows, int filterCols,
+            int strideRow, int strideCol, int rowPadding, int colPadding,
+            int dilationRow, int dilationCol, std::uint8_t pad)
+{
+    const auto layout = MakeIm2ColLayout(inputShape, filterRows, filterCols,
+                                         strideRow, strideCol, rowPadding,
+                                         colPadding, dilationRow,
+                                         dilationCol);
+    const auto inputSizePerBatch = layout.InputPlaneSize() * layout.Channels;
+    const auto inputMatrixSizePerBatch =
+        static_cast<std::size_t>(layout.Channels) * filterRows * filterCols *
+        layout.OutputSize();
+    const auto N = static_cast<int>(inputShape.Size() / inputSizePerBatch);
+
+    //! Rows of the filter are mapped in the same order as float Im2Col,
+    //! so that filters are laid out the same for both
+    ForEachPlane(layout, N, [&](int nIdx, int channelIdx)
+    {
+        Im2ColPlane(inputMatrix + inputMatrixSizePerBatch * nIdx,
+                    input + inputSizePerBatch * nIdx +
+                    layout.InputPlaneSize() * channelIdx,
+                    layout, channelIdx, pad,
+                    [strideCol](std::uint8_t* dst, const std::uint8_t* src,
+                                unsigned int count)
+                    {
+                        if (strideCol == 1)
                         {
-                            const auto windowRowIdx = outputRowIdx * strideRow;
-                            const auto windowColIdx = outputColIdx * strideCol;
-
-                            const auto rowIdx =
-                                windowRowIdx + filterRowIdx * dilationRow;
-                            const auto colIdx =
-                                windowColIdx + filterColIdx * dilationCol;
-
-                            const auto inputRowIdx = rowIdx - rowPadding;
-                            const auto inputColIdx = colIdx - colPadding;
-
-                            const auto inputMatrixRowIdx =
-                                filterShape.Rows() * filterShape.Cols() *
-                                channelIdx +
-                                filterShape.Rows() * filterShape.Cols() -
-                                (filterRowIdx * filterShape.Cols() +
-                                 filterColIdx) -
-                                1;
-                            const auto inputMatrixColIdx =
-                                outputRowIdx * outputCols + outputColIdx;
-
-                            const auto combinedInputMatrixIdx =
-                                inputMatrixRowIdx * inputMatrixShape.Cols() +
-                                inputMatrixColIdx;
-                            const auto combinedInputIdx =
-                                inputShape.Rows() * inputShape.Cols() *
-                                channelIdx +
-                                inputRowIdx * inputShape.Cols() + inputColIdx;
-
-                            auto* inputMatrixDataPtr =
-                                inputMatrixDataHost + combinedInputMatrixIdx;
-
-                            const auto* inputDataPtr =
-                                inputDataHost + combinedInputIdx;
-
-                            if (inputRowIdx >= 0 &&
-                                inputRowIdx <
-                                (inputShape.Rows()) &&
-                                inputColIdx >= 0 &&
-                                inputColIdx <
-                                (inputShape.Cols()))
-                                *inputMatrixDataPtr = *inputDataPtr;
-                            else
-                                *inputMatrixDataPtr = pad;
+                            std::memcpy(dst, src, count);
+                            return;
                         }
-        }
-    }
+                        for (unsigned int i = 0; i < count; ++i)
+                            dst[i] = src[static_cast<std::size_t>(i) *
+                                         strideCol];
+                    });
+    });
 }
 
 void Col2Im(TensorData& input, const TensorData& inputMatrix,
             const TensorData& filter, int strideCol, int strideRow,
             int rowPadding, int colPadding, int dilationRow, int dilationCol)
 {
-    const auto inputShape = input.GetShape();
     const auto filterShape = filter.GetShape();
-    const auto numChannels = filterShape.At(filterShape.Dim() - 3);
-    const auto inputMatrixShape = inputMatrix.GetShape();
-
-    int N = 1;
-    for (int i = 0; i < inputShape.Dim() - 3; ++i)
-        N *= (inputShape.At(i));
-
-    //! Size of the output after the full convolution
-    const int outputRows =
-        ((inputShape.Rows()) + 2 * rowPadding -
-         dilationRow * (filterShape.Rows() - 1) - 1) /
-        strideRow +
-        1;
-    const int outputCols =
-        ((inputShape.Cols()) + 2 * colPadding -
-         dilationCol * (filterShape.Cols() - 1) - 1) /
-        strideCol +
-        1;
-
-    const auto inputSizePerBatch =
-        numChannels * inputShape.Rows() * inputShape.Cols();
-    const auto inputMatrixSizePerBatch =
-        inputMatrixShape.Rows() * inputMatrixShape.Cols();
-
-    //! Padded total size of input and inputMatrix per batch
+    const auto layout = MakeIm2ColLayout(
+        input.GetShape(), filterShape.Rows(), filterShape.Cols(), strideRow,
+        strideCol, rowPadding, colPadding, dilationRow, dilationCol);
+    assert(layout.Channels == filterShape.At(filterShape.Dim() - 3));
 
-    for (int nIdx = 0; nIdx < N; ++nIdx)
+    const auto inputSizePerBatch = layout.InputPlaneSize() * layout.Channels;
+    const auto inputMatrixSizePerBatch =
+        static_cast<std::size_t>(layout.Channels) * layout.FilterRows *
+        layout.FilterCols * layout.OutputSize();
+    const auto N = static_cast<int>(input.Size() / inputSizePerBatch);
+
+    auto* inputData = input.HostMutableRawPtr();
+    const auto* inputMatrixData = inputMatrix.HostRawPtr();
+    const auto add = GetHostKernels().Add;
+
+    //! Transpose of Im2Col : each run of the input matrix that Im2Col copied
+    //! from the input is added back to the same run of the input. Padded
+    //! elements are skipped
+    ForEachPlane(layout, N, [&](int nIdx, int channelIdx)
     {
-        auto* inputDataHost =
-            input.HostMutableRawPtr() + inputSizePerBatch * nIdx;
-        const auto* inputMatrixDataHost =
-            inputMatrix.HostRawPtr() + inputMatrixSizePerBatch * nIdx;
-        for (int channelIdx = 0; channelIdx < (numChannels);
-             ++channelIdx)
-        {
-            for (int outputRowIdx = 0; outputRowIdx < outputRows;
-                 outputRowIdx += 1)
-                for (int outputColIdx = 0; outputColIdx < outputCols;
-                     outputColIdx += 1)
-                    for (int filterRowIdx = 0;
-                         filterRowIdx < (filterShape.Rows());
-                         ++filterRowIdx)
-                        for (int filterColIdx = 0;
-                             filterColIdx <
-                             (filterShape.Cols());
-                             ++filterColIdx)
-                        {
-                            const auto windowRowIdx = outputRowIdx * strideRow;
-                            const auto windowColIdx = outputColIdx * strideCol;
-
-                            const auto rowIdx =
-                                windowRowIdx + filterRowIdx * dilationRow;
-                            const auto colIdx =
-                                windowColIdx + filterColIdx * dilationCol;
-
-                            const auto inputRowIdx = rowIdx - rowPadding;
-                            const auto inputColIdx = colIdx - colPadding;
-
-                            const auto inputMatrixRowIdx =
-                                filterShape.Rows() * filterShape.Cols() *
-                                channelIdx +
-                                filterShape.Rows() * filterShape.Cols() -
-                                (filterRowIdx * filterShape.Cols() +
-                                 filterColIdx) -
-                                1;
-                            const auto inputMatrixColIdx =
-                                outputRowIdx * outputCols + outputColIdx;
-
-                            const auto combinedInputMatrixIdx =
-                                inputMatrixRowIdx * inputMatrixShape.Cols() +
-                                inputMatrixColIdx;
-                            const auto combinedInputIdx =
-                                inputShape.Rows() * inputShape.Cols() *
-                                channelIdx +
-                                inputRowIdx * inputShape.Cols() + inputColIdx;
-
-                            const auto* inputMatrixDataPtr =
-                                inputMatrixDataHost + combinedInputMatrixIdx;
-
-                            auto* inputDataPtr =
-                                inputDataHost + combinedInputIdx;
-
-                            if (inputRowIdx >= 0 &&
-                                inputRowIdx <
-                                (inputShape.Rows()) &&
-                                inputColIdx >= 0 &&
-                                inputColIdx <
-                                (inputShape.Cols()))
-                                *inputDataPtr += *inputMatrixDataPtr;
-                        }
-        }
-    }
+        auto* inputPlane = inputData + inputSizePerBatch * nIdx +
+                           layout.InputPlaneSize() * channelIdx;
+        const auto* matrix = inputMatrixData + inputMatrixSizePerBatch * nIdx;
+        for (int filterRowIdx = 0; filterRowIdx < layout.FilterRows;
+             ++filterRowIdx)
+            for (int filterColIdx = 0; filterColIdx < layout.FilterCols;
+                 ++filterColIdx)
+            {
+                const auto* matrixRow =
+                    matrix +
+                    layout.MatrixRow(channelIdx, filterRowIdx, filterColIdx) *
+                    layout.OutputSize();
+                const auto inputColOffset =
+                    filterColIdx * layout.DilationCol - layout.ColPadding;
+                int firstCol, lastCol;
+                layout.ColumnRange(inputColOffset, firstCol, lastCol);
+                const auto count =
+                    static_cast<unsigned int>(lastCol - firstCol);
+
+                for (int outputRowIdx = 0; outputRowIdx < layout.OutputRows;
+                     ++outputRowIdx)
+                {
+                    const auto inputRowIdx =
+                        outputRowIdx * layout.StrideRow +
+                        filterRowIdx * layout.DilationRow - layout.RowPadding;
+                    if (inputRowIdx < 0 || inputRowIdx >= layout.InputRows)
+                        continue;
+
+                    const auto* src =
+                        matrixRow +
+                        static_cast<std::size_t>(outputRowIdx) *
+                        layout.OutputCols + firstCol;
+                    auto* dst = inputPlane +
+                                static_cast<std::size_t>(inputRowIdx) *
+                                layout.InputCols + inputColOffset +
+                                firstCol * layout.StrideCol;
+                    if (layout.StrideCol == 1)
+                    {
+                        add(dst, dst, src, count);
+                        continue;
+                    }
+                    for (unsigned int i = 0; i < count; ++i)
+                        dst[static_cast<std::size_t>(i) * layout.StrideCol] +=
+                            src[i];
+                }
+            }
+    });
 }
 
 void Conv2D(TensorData& y, const TensorData& x, const TensorData& filter,
@@ -247,7 +346,7 @@ void Conv2D(TensorData& y, const TensorData& x, const TensorData& filter,
     rFilter.Reshape(rFilterShape);
     rY.Reshape(rYShape);
 
-    Gemm(rY, rFilter, rX);
+    Gemm(rY, rFilter, rX, false, false, 1.0f, 0.0f);
 
     rFilter.Reshape(filterShape);
     rY.Reshape(yShape);
@@ -283,18 +382,14 @@ void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
     const Shape drYShape({ N, dyChannels, dyRows * dyCols });
 
     TensorData rX(rXShape, Type::Dense, device);
-    TensorData rXT(rXShape.GetTranspose(), Type::Dense, device);
     TensorData drX(rXShape, Type::Dense, device);
     TensorData rFilter = filter;
-    TensorData rFilterT(rFilterShape.GetTranspose(), Type::Dense, device);
     TensorData drFilter = dFilter;
     TensorData drY = dy;
 
     rX.SetMode(DeviceType::Host);
-    rXT.SetMode(DeviceType::Host);
     drX.SetMode(DeviceType::Host);
     rFilter.SetMode(DeviceType::Host);
-    rFilterT.SetMode(DeviceType::Host);
     drFilter.SetMode(DeviceType::Host);
     drY.SetMode(DeviceType::Host);
 
@@ -304,10 +399,8 @@ void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
     drFilter.Reshape(rFilterShape);
     drY.Reshape(drYShape);
 
-    Transpose(rFilterT, rFilter);
-    Gemm(drX, rFilterT, drY);
-    Transpose(rXT, rX);
-    Gemm(drFilter, drY, rXT);
+    Gemm(drX, rFilter, drY, true, false, 1.0f, 0.0f);
+    Gemm(drFilter, drY, rX, false, true, 1.0f, 0.0f);
 
     rFilter.Reshape(dFilterShape);
     drFilter.Reshape(dFilterShape);
@@ -0,0 +1,186 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/GemmTuner.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+std::atomic<bool> autotune(false);
+
+struct TuningStore
+{
+    std::mutex Mutex;
+    std::unordered_map<GemmConfig, GemmTuning, GemmConfigHash> Tunings;
+    bool FileLoaded = false;
+};
+
+TuningStore& Store()
+{
+    static TuningStore store;
+    return store;
+}
+
+//! Returns path given by SAPPHIRE_GEMM_TUNING_FILE, or empty string
+std::string TuningFilePath()
+{
+    const char* path = std::getenv("SAPPHIRE_GEMM_TUNING_FILE");
+    return path ? std::string(path) : std::string();
+}
+
+std::string ToLine(const GemmConfig& config, const GemmTuning& tuning)
+{
+    std::ostringstream line;
+    line << InstructionSetToString(config.Isa) << " " << config.M << " "
+         << config.N << " " << config.K << " " << config.BatchSize << " "
+         << config.TransA << " " << config.TransB << " " << config.NumThreads
+         << " " << tuning.MC << " " << tuning.KC << " " << tuning.NC << " "
+         << tuning.SplitTiles;
+    return line.str();
+}
+
+bool ParseLine(const std::string& line, GemmConfig& config,
+               GemmTuning& tuning)
+{
+    std::istringstream stream(line);
+    std::string isa;
+    if (!(stream >> isa >> config.M >> config.N >> config.K >>
+          config.BatchSize >> config.TransA >> config.TransB >>
+          config.NumThreads >> tuning.MC >> tuning.KC >> tuning.NC >>
+          tuning.SplitTiles))
+        return false;
+
+    for (const auto candidate : { InstructionSet::Sse, InstructionSet::Avx2,
+                                  InstructionSet::Avx512 })
+        if (InstructionSetToString(candidate) == isa)
+        {
+            config.Isa = candidate;
+            return tuning.MC > 0 && tuning.KC > 0 && tuning.NC > 0;
+        }
+    return false;
+}
+
+//! Should be called with the mutex of the store locked
+//! \return : false if file cannot be opened
+bool LoadFile(TuningStore& store, const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+        return false;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        GemmConfig config{};
+        GemmTuning tuning{};
+        if (ParseLine(line, config, tuning))
+            store.Tunings[config] = tuning;
+    }
+    return true;
+}
+
+//! Should be called with the mutex of the store locked
+void LoadEnvironmentFile(TuningStore& store)
+{
+    if (store.FileLoaded)
+        return;
+    store.FileLoaded = true;
+
+    const auto path = TuningFilePath();
+    if (!path.empty())
+        LoadFile(store, path);
+}
+} // namespace
+
+bool GemmConfig::operator==(const GemmConfig& config) const
+{
+    return std::tie(Isa, M, N, K, BatchSize, TransA, TransB, NumThreads) ==
+           std::tie(config.Isa, config.M, config.N, config.K,
+                    config.BatchSize, config.TransA, config.TransB,
+                    config.NumThreads);
+}
+
+bool GemmConfig::operator!=(const GemmConfig& config) const
+{
+    return !(*this == config);
+}
+
+void SetGemmAutotune(bool enable)
+{
+    autotune.store(enable, std::memory_order_relaxed);
+}
+
+bool GetGemmAutotune()
+{
+    return autotune.load(std::memory_order_relaxed);
+}
+
+bool FindGemmTuning(const GemmConfig& config, GemmTuning& tuning)
+{
+    auto& store = Store();
+    std::lock_guard<std::mutex> lock(store.Mutex);
+    LoadEnvironmentFile(store);
+
+    const auto itr = store.Tunings.find(config);
+    if (itr == store.Tunings.end())
+        return false;
+    tuning = itr->second;
+    return true;
+}
+
+void AddGemmTuning(const GemmConfig& config, const GemmTuning& tuning)
+{
+    auto& store = Store();
+    std::lock_guard<std::mutex> lock(store.Mutex);
+    LoadEnvironmentFile(store);
+    store.Tunings[config] = tuning;
+
+    //! Later entries replace earlier ones when the file is loaded
+    const auto path = TuningFilePath();
+    if (!path.empty())
+    {
+        std::ofstream file(path, std::ios::app);
+        if (file.is_open())
+            file << ToLine(config, tuning) << "\n";
+    }
+}
+
+void ClearGemmTunings()
+{
+    auto& store = Store();
+    std::lock_guard<std::mutex> lock(store.Mutex);
+    store.Tunings.clear();
+}
+
+bool LoadGemmTuningFile(const std::string& path)
+{
+    auto& store = Store();
+    std::lock_guard<std::mutex> lock(store.Mutex);
+    return LoadFile(store, path);
+}
+
+void SaveGemmTuningFile(const std::string& path)
+{
+    auto& store = Store();
+    std::lock_guard<std::mutex> lock(store.Mutex);
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+        throw std::runtime_error(
+            "Compute::Dense::Naive::SaveGemmTuningFile - Cannot open " + path);
+    for (const auto& [config, tuning] : store.Tunings)
+        file << ToLine(config, tuning) << "\n";
+}
+} // namespace Sapphire::Compute::Dense::Naive
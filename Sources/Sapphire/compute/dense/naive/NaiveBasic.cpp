@@ -5,57 +5,307 @@
 // property of any third parties.
 
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace Sapphire::Compute::Dense::Naive
 {
-void Add(unsigned int totalSize, float* output, const float* inputA,
-         const float* inputB, unsigned int inputStride, bool broadcastInputA,
-         bool broadcastInputB)
+namespace
+{
+//! Number of elements processed at once by a thread
+constexpr unsigned int PieceSize = 4096;
+
+//! Arrays smaller than this are processed on single thread, since they are
+//! bound by the cost of forking threads rather than memory bandwidth
+constexpr unsigned int ParallelThreshold = 1u << 16;
+
+//! Broadcast rows shorter than this are repeated into a tile of at most
+//! TileSize elements, so kernels run on long contiguous spans instead of
+//! being called once per row
+constexpr unsigned int TileRowThreshold = 64;
+constexpr unsigned int TileSize = 1024;
+
+//! Matrices are transposed in square tiles of this size, so that rows of
+//! both input and output tiles stay in L1 cache until all of their elements
+//! are used
+constexpr unsigned int TransposeTileSize = 64;
+
+//! Rows of softmax are processed in blocks of this size, which stay in
+//! cache between the passes over the block
+constexpr unsigned int SoftmaxBlockSize = 1024;
+
+//! Calls func(offset, count) for pieces of pieceSize elements, split over
+//! the threads
+template <typename Func>
+void ForEachPiece(unsigned int totalSize, unsigned int pieceSize, Func func)
 {
-    const unsigned int leftOverA = broadcastInputA ? inputStride : totalSize;
-    const unsigned int leftOverB = broadcastInputB ? inputStride : totalSize;
+    const long long numPieces =
+        (static_cast<long long>(totalSize) + pieceSize - 1) / pieceSize;
+
+    //! Small arrays do not enter OpenMP at all, since even a single threaded
+    //! parallel region costs more than the kernel for broadcast leaves of a
+    //! few elements
+    if (totalSize < ParallelThreshold || numPieces == 1)
+    {
+        for (std::size_t offset = 0; offset < totalSize; offset += pieceSize)
+            func(offset, static_cast<unsigned int>(
+                     std::min<std::size_t>(pieceSize, totalSize - offset)));
+        return;
+    }
 
-    for (unsigned int i = 0; i < totalSize; i++)
+    const auto threads = Util::ResolveNumThreads(0);
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+    for (long long pieceIdx = 0; pieceIdx < numPieces; ++pieceIdx)
     {
-        output[i] = inputA[i % leftOverA] + inputB[i % leftOverB];
+        const auto offset = static_cast<std::size_t>(pieceIdx) * pieceSize;
+        func(offset, static_cast<unsigned int>(
+                 std::min<std::size_t>(pieceSize, totalSize - offset)));
     }
 }
 
-void Sub(unsigned int totalSize, float* output, const float* inputA,
-         const float* inputB, unsigned int inputStride, bool broadcastInputA,
-         bool broadcastInputB)
+template <typename Kernel, typename... Params>
+void Unary(unsigned int totalSize, float* output, const float* input,
+           Kernel kernel, Params ... params)
+{
+    ForEachPiece(totalSize, PieceSize,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     kernel(output + offset, input + offset, params...,
+                            count);
+                 });
+}
+
+template <typename Kernel, typename... Params>
+void Backward(unsigned int totalSize, float* dx, const float* dy,
+              const float* x, Kernel kernel, Params ... params)
 {
-    const unsigned int leftOverA = broadcastInputA ? inputStride : totalSize;
-    const unsigned int leftOverB = broadcastInputB ? inputStride : totalSize;
+    ForEachPiece(totalSize, PieceSize,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     kernel(dx + offset, dy + offset, x + offset, params...,
+                            count);
+                 });
+}
+
+//! Repeats row of stride elements into tile as many times as it fits
+//! Returns number of elements filled, which is a multiple of stride
+unsigned int FillTile(float* tile, const float* row, unsigned int stride)
+{
+    const auto tileSize = TileSize / stride * stride;
+    for (unsigned int i = 0; i < tileSize; i += stride)
+        std::memcpy(tile + i, row, stride * sizeof(float));
+    return tileSize;
+}
+
+void CheckStride(unsigned int inputStride, bool broadcast, const char* caller)
+{
+    if (broadcast && inputStride == 0)
+        throw std::invalid_argument(
+            std::string("Compute::Dense::Naive::") + caller +
+            " - inputStride should be positive when broadcasting");
+}
 
-    for (unsigned int i = 0; i < totalSize; i++)
+//! Computes output[i] = inputA[i % strideA] (op) inputB[i % strideB], where
+//! strideA is inputStride if inputA is broadcast and totalSize otherwise
+//! Instead of computing indices of each element, each case calls kernels on
+//! contiguous spans
+//! \param scalarB : computes out[i] = a[i] (op) scalar
+//! \param scalarA : computes out[i] = scalar (op) b[i]
+void BroadcastBinary(unsigned int totalSize, float* output,
+                     const float* inputA, const float* inputB,
+                     unsigned int inputStride, bool broadcastInputA,
+                     bool broadcastInputB, BinaryKernelFunc kernel,
+                     ScalarKernelFunc scalarB, ScalarKernelFunc scalarA)
+{
+    if (!broadcastInputA && !broadcastInputB)
+    {
+        ForEachPiece(totalSize, PieceSize,
+                     [=](std::size_t offset, unsigned int count)
+                     {
+                         kernel(output + offset, inputA + offset,
+                                inputB + offset, count);
+                     });
+        return;
+    }
+
+    //! Every row of the output is the same if both inputs are broadcast
+    if (broadcastInputA && broadcastInputB)
     {
-        output[i] = inputA[i % leftOverA] - inputB[i % leftOverB];
+        const auto rowSize = std::min(inputStride, totalSize);
+        kernel(output, inputA, inputB, rowSize);
+        for (std::size_t offset = rowSize; offset < totalSize;
+             offset += rowSize)
+            std::memcpy(output + offset, output,
+                        std::min<std::size_t>(rowSize, totalSize - offset) *
+                        sizeof(float));
+        return;
     }
+
+    const float* row = broadcastInputA ? inputA : inputB;
+    if (inputStride == 1)
+    {
+        const auto scalar = row[0];
+        const auto* input = broadcastInputA ? inputB : inputA;
+        const auto scalarKernel = broadcastInputA ? scalarA : scalarB;
+        ForEachPiece(totalSize, PieceSize,
+                     [=](std::size_t offset, unsigned int count)
+                     {
+                         scalarKernel(output + offset, input + offset, scalar,
+                                      count);
+                     });
+        return;
+    }
+
+    //! Pieces start at the beginning of a row, so tile and broadcast row are
+    //! used from their first element
+    float tile[TileSize];
+    auto spanSize = inputStride;
+    if (inputStride < TileRowThreshold)
+    {
+        spanSize = FillTile(tile, row, inputStride);
+        row = tile;
+    }
+    const auto pieceSize = std::max(PieceSize / spanSize, 1u) * spanSize;
+
+    ForEachPiece(totalSize, pieceSize,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     for (unsigned int i = 0; i < count; i += spanSize)
+                     {
+                         const auto pos = offset + i;
+                         kernel(output + pos,
+                                broadcastInputA ? row : inputA + pos,
+                                broadcastInputB ? row : inputB + pos,
+                                std::min(spanSize, count - i));
+                     }
+                 });
+}
+
+//! Accumulates grad[i % inputStride] += dy[i] * other[i % otherStride] for
+//! gradient of broadcast input, where otherStride is inputStride if other
+//! input is broadcast as well and totalSize otherwise
+//! Runs on single thread, since every row is accumulated to the same place
+void BroadcastDotBackward(unsigned int totalSize, float* grad,
+                          const float* dy, const float* other,
+                          unsigned int inputStride, bool broadcastOther)
+{
+    const auto mulAdd = GetHostKernels().MulAdd;
+
+    if (inputStride >= TileRowThreshold)
+    {
+        for (std::size_t pos = 0; pos < totalSize; pos += inputStride)
+            mulAdd(grad, dy + pos, broadcastOther ? other : other + pos,
+                   static_cast<unsigned int>(std::min<std::size_t>(
+                       inputStride, totalSize - pos)));
+        return;
+    }
+
+    //! Short rows are accumulated into a tile of repeated rows first, and
+    //! the tile is folded into grad at the end
+    float otherTile[TileSize];
+    float sum[TileSize] = {};
+    const auto tileSize = broadcastOther
+                              ? FillTile(otherTile, other, inputStride)
+                              : TileSize / inputStride * inputStride;
+    for (std::size_t pos = 0; pos < totalSize; pos += tileSize)
+        mulAdd(sum, dy + pos, broadcastOther ? otherTile : other + pos,
+               static_cast<unsigned int>(
+                   std::min<std::size_t>(tileSize, totalSize - pos)));
+    for (unsigned int i = 0; i < tileSize; ++i)
+        grad[i % inputStride] += sum[i];
+}
+} // namespace
+
+void Add(unsigned int totalSize, float* output, const float* inputA,
+         const float* inputB, unsigned int inputStride, bool broadcastInputA,
+         bool broadcastInputB)
+{
+    CheckStride(inputStride, broadcastInputA || broadcastInputB, "Add");
+    const auto& kernels = GetHostKernels();
+    BroadcastBinary(totalSize, output, inputA, inputB, inputStride,
+                    broadcastInputA, broadcastInputB, kernels.Add,
+                    kernels.AddScalar, kernels.AddScalar);
+}
+
+void Sub(unsigned int totalSize, float* output, const float* inputA,
+         const float* inputB, unsigned int inputStride, bool broadcastInputA,
+         bool broadcastInputB)
+{
+    CheckStride(inputStride, broadcastInputA || broadcastInputB, "Sub");
+    const auto& kernels = GetHostKernels();
+    BroadcastBinary(totalSize, output, inputA, inputB, inputStride,
+                    broadcastInputA, broadcastInputB, kernels.Sub,
+                    kernels.SubScalar, kernels.ScalarSub);
 }
 
 void Dot(unsigned int totalSize, float* output, const float* inputA,
          const float* inputB, unsigned int inputStride, bool broadcastInputA,
          bool broadcastInputB)
 {
-    const unsigned int leftOverA = broadcastInputA ? inputStride : totalSize;
-    const unsigned int leftOverB = broadcastInputB ? inputStride : totalSize;
+    CheckStride(inputStride, broadcastInputA || broadcastInputB, "Dot");
+    const auto& kernels = GetHostKernels();
+    BroadcastBinary(totalSize, output, inputA, inputB, inputStride,
+                    broadcastInputA, broadcastInputB, kernels.Dot,
+                    kernels.Scale, kernels.Scale);
+}
 
-    for (unsigned int i = 0; i < totalSize; i++)
+void DotBackward(unsigned int totalSize, float* da, float* db,
+                 const float* dy, const float* a, const float* b,
+                 unsigned int inputStride, bool broadcastInputA,
+                 bool broadcastInputB)
+{
+    CheckStride(inputStride, broadcastInputA || broadcastInputB,
+                "DotBackward");
+    const auto mulAdd = GetHostKernels().MulAdd;
+
+    //! Gradient of input that is not broadcast is computed as forward
+    //! operation of dy and the other input, with scalars repeated into tiles
+    float tile[TileSize];
+    const auto accumulate = [&](float* grad, const float* other,
+                                bool broadcastOther)
     {
-        output[i] = inputA[i % leftOverA] * inputB[i % leftOverB];
-    }
+        if (broadcastOther && inputStride == 1)
+        {
+            std::fill(tile, tile + TileSize, other[0]);
+            const float* scalarTile = tile;
+            ForEachPiece(totalSize, TileSize,
+                         [=](std::size_t offset, unsigned int count)
+                         {
+                             mulAdd(grad + offset, dy + offset, scalarTile,
+                                    count);
+                         });
+            return;
+        }
+        BroadcastBinary(totalSize, grad, dy, other, inputStride, false,
+                        broadcastOther, mulAdd, nullptr, nullptr);
+    };
+
+    if (broadcastInputA)
+        BroadcastDotBackward(totalSize, da, dy, b, inputStride,
+                             broadcastInputB);
+    else
+        accumulate(da, b, broadcastInputB);
+
+    if (broadcastInputB)
+        BroadcastDotBackward(totalSize, db, dy, a, inputStride,
+                             broadcastInputA);
+    else
+        accumulate(db, a, broadcastInputA);
 }
 
 void Scale(float* output, const float* input, const float scaleFactor,
            unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; i++)
-    {
-        output[i] = input[i] * scaleFactor;
-    }
+    Unary(totalSize, output, input, GetHostKernels().Scale, scaleFactor);
 }
 
 void Transpose(float* output, const float* input, unsigned int inputRows,
@@ -63,213 +313,530 @@ void Transpose(float* output, const float* input, unsigned int inputRows,
                unsigned int batchSize,
                bool broadcast)
 {
-    const auto leftOver = broadcast
-                              ? inputRows * inputCols
-                              : batchSize * inputRows * inputCols;
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
-        for (unsigned int i = 0; i < inputRows; i++)
-            for (unsigned int j = 0; j < inputCols; j++)
-            {
-                float* outputOffset = output +
-                                      static_cast<std::size_t>(batchIdx) *
-                                      inputCols * inputRows;
-                const float* inputOffset =
-                    input + static_cast<std::size_t>(batchIdx) * inputRows *
-                    inputCols;
-                outputOffset[j * inputRows + i] =
-                    inputOffset[(i * inputCols + j) % leftOver];
-            }
+    const auto matrixSize = static_cast<std::size_t>(inputRows) * inputCols;
+    if (matrixSize == 0 || batchSize == 0)
+        return;
+
+    //! Broadcast input is transposed only once, and copied to the other
+    //! batches
+    const auto transpose = GetHostKernels().Transpose;
+    const auto numMatrices = broadcast ? 1u : batchSize;
+    const auto rowTiles = (inputRows + TransposeTileSize - 1) /
+                          TransposeTileSize;
+    const auto colTiles = (inputCols + TransposeTileSize - 1) /
+                          TransposeTileSize;
+    const auto tilesPerMatrix = static_cast<long long>(rowTiles) * colTiles;
+    const auto numTiles = tilesPerMatrix * numMatrices;
+
+    const auto threads = Util::ResolveNumThreads(0);
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1 && numTiles > 1 && \
+        matrixSize * numMatrices >= ParallelThreshold)
+    for (long long tileIdx = 0; tileIdx < numTiles; ++tileIdx)
+    {
+        const auto matrixIdx = static_cast<std::size_t>(tileIdx /
+                                                        tilesPerMatrix);
+        const auto tile = static_cast<unsigned int>(tileIdx % tilesPerMatrix);
+        const auto row = tile / colTiles * TransposeTileSize;
+        const auto col = tile % colTiles * TransposeTileSize;
+        const auto offset = matrixIdx * matrixSize;
+        transpose(output + offset + static_cast<std::size_t>(col) * inputRows +
+                  row,
+                  input + offset + static_cast<std::size_t>(row) * inputCols +
+                  col,
+                  std::min(TransposeTileSize, inputRows - row),
+                  std::min(TransposeTileSize, inputCols - col), inputCols,
+                  inputRows);
+    }
+
+    if (!broadcast || batchSize == 1)
+        return;
+    ForEachPiece((batchSize - 1) * static_cast<unsigned int>(matrixSize),
+                 PieceSize,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     for (std::size_t done = 0; done < count;)
+                     {
+                         const auto source = (offset + done) % matrixSize;
+                         const auto run = std::min<std::size_t>(
+                             matrixSize - source, count - done);
+                         std::memcpy(output + matrixSize + offset + done,
+                                     output + source, run * sizeof(float));
+                         done += run;
+                     }
+                 });
 }
 
 void Pow(float* output, const float* input, const float exponent,
          unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
+    //! Exponents with exact elementwise counterparts use vectorized kernels
+    const auto& kernels = GetHostKernels();
+    if (exponent == 2.0f)
     {
-        output[i] = std::pow(input[i], exponent);
+        const auto dot = kernels.Dot;
+        ForEachPiece(totalSize, PieceSize,
+                     [=](std::size_t offset, unsigned int count)
+                     {
+                         dot(output + offset, input + offset, input + offset,
+                             count);
+                     });
+        return;
     }
+    if (exponent == -1.0f)
+    {
+        Unary(totalSize, output, input, kernels.Inverse);
+        return;
+    }
+    if (exponent == 1.0f)
+    {
+        if (output != input)
+            std::memcpy(output, input,
+                        static_cast<std::size_t>(totalSize) * sizeof(float));
+        return;
+    }
+
+    if (GetMathPrecision() == MathPrecision::Fast)
+    {
+        const auto& math = GetMathKernels(kernels);
+        const auto scale = kernels.Scale;
+        ForEachPiece(totalSize, PieceSize,
+                     [=, &math](std::size_t offset, unsigned int count)
+                     {
+                         //! Input may alias output, so power is computed
+                         //! into buffer first
+                         float buffer[PieceSize];
+                         math.Log(buffer, input + offset, count);
+                         scale(buffer, buffer, exponent, count);
+                         math.Exp(buffer, buffer, count);
+
+                         //! exp(exponent * log(x)) is valid only for positive
+                         //! finite x
+                         for (unsigned int i = 0; i < count; ++i)
+                         {
+                             const auto x = input[offset + i];
+                             output[offset + i] =
+                                 x > 0.0f && std::isfinite(x)
+                                     ? buffer[i]
+                                     : std::pow(x, exponent);
+                         }
+                     });
+        return;
+    }
+
+    ForEachPiece(totalSize, PieceSize,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     for (std::size_t i = offset; i < offset + count; ++i)
+                         output[i] = std::pow(input[i], exponent);
+                 });
+}
+
+void PowBackward(float* dx, const float* dy, const float* x,
+                 const float exponent, unsigned int totalSize)
+{
+    ForEachPiece(totalSize, PieceSize,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     for (std::size_t i = offset; i < offset + count; ++i)
+                         dx[i] += dy[i] * exponent *
+                             std::pow(x[i], exponent - 1.0f);
+                 });
 }
 
 void Cos(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::cos(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Cos);
 }
 
 void Sin(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::sin(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Sin);
 }
 
 void Tan(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::tan(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Tan);
 }
 
 void Cosh(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::cosh(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Cosh);
 }
 
 void Sinh(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::sinh(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Sinh);
 }
 
 void Tanh(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::tanh(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Tanh);
 }
 
 void log(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::log(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Log);
 }
 
 void log10(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = std::log10(input[i]);
-    }
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Log10);
+}
+
+void Exp(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).Exp);
+}
+
+void Sigmoid(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input,
+          GetMathKernels(GetHostKernels()).Sigmoid);
+}
+
+void ArcCos(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).ArcCos);
+}
+
+void ArcSin(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).ArcSin);
+}
+
+void ArcTan(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).ArcTan);
+}
+
+void ArcCosh(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).ArcCosh);
+}
+
+void ArcSinh(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).ArcSinh);
+}
+
+void ArcTanh(float* output, const float* input, unsigned int totalSize)
+{
+    Unary(totalSize, output, input, GetMathKernels(GetHostKernels()).ArcTanh);
+}
+
+void CosBackward(float* dx, const float* dy, const float* x,
+                 unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).CosBackward);
+}
+
+void SinBackward(float* dx, const float* dy, const float* x,
+                 unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).SinBackward);
+}
+
+void TanBackward(float* dx, const float* dy, const float* x,
+                 unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).TanBackward);
+}
+
+void CoshBackward(float* dx, const float* dy, const float* x,
+                  unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).CoshBackward);
+}
+
+void SinhBackward(float* dx, const float* dy, const float* x,
+                  unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).SinhBackward);
+}
+
+void TanhBackward(float* dx, const float* dy, const float* x,
+                  unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).TanhBackward);
+}
+
+void ArcCosBackward(float* dx, const float* dy, const float* x,
+                    unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).ArcCosBackward);
+}
+
+void ArcSinBackward(float* dx, const float* dy, const float* x,
+                    unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).ArcSinBackward);
+}
+
+void ArcTanBackward(float* dx, const float* dy, const float* x,
+                    unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).ArcTanBackward);
+}
+
+void ArcCoshBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).ArcCoshBackward);
+}
+
+void ArcSinhBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).ArcSinhBackward);
+}
+
+void ArcTanhBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize)
+{
+    Backward(totalSize, dx, dy, x,
+             GetMathKernels(GetHostKernels()).ArcTanhBackward);
 }
 
 void ReLU(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = input[i] > 0 ? input[i] : 0;
-    }
+    Unary(totalSize, output, input, GetHostKernels().ReLU);
 }
 
 void ReLUBackward(float* dx, const float* dy, const float* x,
                   unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        dx[i] = x[i] > 0.0f ? dy[i] : 0.0f;
-    }
+    Backward(totalSize, dx, dy, x, GetHostKernels().ReLUBackward);
 }
 
 void LeakyReLU(float* output, const float* input, float a,
                unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = input[i] > 0 ? input[i] : a * input[i];
-    }
+    Unary(totalSize, output, input, GetHostKernels().LeakyReLU, a);
 }
 
-void LeakyReLUBackward(float* output, const float* input, float a,
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
                        unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = input[i] > 0 ? 1 : a;
-    }
+    Backward(totalSize, dx, dy, x, GetHostKernels().LeakyReLUBackward, a);
 }
 
 void Inverse(float* output, const float* input, unsigned int totalSize)
 {
-    for (unsigned int i = 0; i < totalSize; ++i)
-    {
-        output[i] = 1.0f / input[i];
-    }
+    Unary(totalSize, output, input, GetHostKernels().Inverse);
 }
 
-void Mean(float* y, const float* x,
-          unsigned ySize, unsigned int unitSize, unsigned stride)
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int totalSize)
 {
-    for (unsigned int unitId = 0; unitId < ySize; unitId++)
-    {
-        const auto outerId = unitId / stride;
-        const auto innerId = unitId % stride;
-
-        for (unsigned int i = 0; i < unitSize; i++)
-        {
-            y[unitId] += x[unitSize * stride * outerId + i * stride + innerId];
-        }
-        y[unitId] /= static_cast<float>(unitSize);
-    }
-}
-
-void MeanBackward(float* dx, const float* dy,
-                  unsigned int ySize, unsigned int unitSize,
-                  unsigned int stride)
-{
-    for (unsigned int unitId = 0; unitId < ySize; unitId++)
-    {
-        const auto outerId = unitId / stride;
-        const auto innerId = unitId % stride;
-
-        for (unsigned int i = 0; i < unitSize; i++)
-        {
-            dx[unitSize * stride * outerId + i * stride + innerId] +=
-                dy[unitId] / static_cast<float>(unitSize);
-        }
-    }
+    Backward(totalSize, dx, dy, x, GetHostKernels().InverseBackward);
 }
 
+//! Each block is exponentiated relative to the running maximum while it is
+//! in cache, and the sum is rescaled whenever the maximum grows, so x is
+//! read once. Then every block is normalized with the factor for its
+//! maximum
 void Softmax(float* output, const float* input, unsigned int totalSize,
              unsigned int unitSize)
 {
-    const auto batchSize = totalSize / unitSize;
+    const auto& kernels = GetHostKernels();
+    const auto& reduce = *kernels.Reduce;
+    const auto exp = GetMathKernels(kernels).Exp;
+    const auto subScalar = kernels.SubScalar;
+    const auto scale = kernels.Scale;
+    const auto numBlocks = (unitSize + SoftmaxBlockSize - 1) / SoftmaxBlockSize;
+
+    //! Pieces hold whole rows
+    const auto rowsPerPiece = std::max(1u, PieceSize / unitSize);
+    ForEachPiece(
+        totalSize, rowsPerPiece * unitSize,
+        [=](std::size_t offset, unsigned int count)
+        {
+            std::vector<float> blockMax(numBlocks);
+            for (std::size_t rowIdx = offset; rowIdx < offset + count;
+                 rowIdx += unitSize)
+            {
+                const float* x = input + rowIdx;
+                float* y = output + rowIdx;
 
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
-    {
-        float sum = 0;
-        for (unsigned int i = 0; i < unitSize; ++i)
-            sum += std::exp(input[unitSize * batchIdx + i]);
+                auto max = -std::numeric_limits<float>::infinity();
+                double sum = 0.0;
+                for (unsigned int blockIdx = 0; blockIdx < numBlocks;
+                     ++blockIdx)
+                {
+                    const auto begin = blockIdx * SoftmaxBlockSize;
+                    const auto size =
+                        std::min(SoftmaxBlockSize, unitSize - begin);
+
+                    //! Subtracting maximum keeps exp from overflowing
+                    const auto newMax =
+                        std::max(max, reduce.RowMax(x + begin, size));
+                    if (newMax > max)
+                        sum *= std::exp(static_cast<double>(max) - newMax);
+                    max = newMax;
+                    blockMax[blockIdx] = max;
+
+                    //! Elements of -inf prefix (e.g. masked logits) are
+                    //! zero, and x - max would be NaN for them. Row of only
+                    //! -inf is still NaN after normalization
+                    if (max == -std::numeric_limits<float>::infinity())
+                    {
+                        std::fill(y + begin, y + begin + size, 0.0f);
+                        continue;
+                    }
+
+                    subScalar(y + begin, x + begin, max, size);
+                    exp(y + begin, y + begin, size);
+                    sum += reduce.RowSum(y + begin, size);
+                }
 
-        for (unsigned int i = 0; i < unitSize; ++i)
-            output[unitSize * batchIdx + i] =
-                std::exp(input[unitSize * batchIdx + i]) / sum;
-    }
+                for (unsigned int blockIdx = 0; blockIdx < numBlocks;
+                     ++blockIdx)
+                {
+                    const auto begin = blockIdx * SoftmaxBlockSize;
+                    const auto factor = std::exp(
+                        static_cast<double>(blockMax[blockIdx]) - max) / sum;
+                    scale(y + begin, y + begin, static_cast<float>(factor),
+                          std::min(SoftmaxBlockSize, unitSize - begin));
+                }
+            }
+        });
 }
 
-void SoftmaxBackward(float* dx, const float* dy, const float* x,
+//! Jacobian of softmax is diag(y) - y * y^T, so its product with dy is
+//! y * (dy - dot(dy, y)) for each row
+void SoftmaxBackward(float* dx, const float* dy, const float* y,
                      unsigned int totalSize, unsigned int unitSize)
 {
-    const auto batchSize = totalSize / unitSize;
+    const auto& kernels = GetHostKernels();
+    const auto rowDot = kernels.Reduce->RowDot;
+    const auto subScalar = kernels.SubScalar;
+    const auto mulAdd = kernels.MulAdd;
+
+    const auto rowsPerPiece = std::max(1u, PieceSize / unitSize);
+    ForEachPiece(
+        totalSize, rowsPerPiece * unitSize,
+        [=](std::size_t offset, unsigned int count)
+        {
+            float buffer[SoftmaxBlockSize];
+            for (std::size_t rowIdx = offset; rowIdx < offset + count;
+                 rowIdx += unitSize)
+            {
+                const auto dot = static_cast<float>(
+                    rowDot(dy + rowIdx, y + rowIdx, unitSize));
+                for (unsigned int begin = 0; begin < unitSize;
+                     begin += SoftmaxBlockSize)
+                {
+                    const auto size =
+                        std::min(SoftmaxBlockSize, unitSize - begin);
+                    subScalar(buffer, dy + rowIdx + begin, dot, size);
+                    mulAdd(dx + rowIdx + begin, y + rowIdx + begin, buffer,
+                           size);
+                }
+            }
+        });
+}
 
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
-    {
-        const unsigned int offset = unitSize * batchIdx;
-        float sum = 0;
-        for (unsigned int unitIdx = 0; unitIdx < unitSize; ++unitIdx)
-            for (unsigned int i = 0; i < unitSize; ++i)
+double CrossEntropy(float* logSumExp, const float* x,
+                    const std::int32_t* label, unsigned int totalSize,
+                    unsigned int unitSize)
+{
+    const auto& kernels = GetHostKernels();
+    const auto& reduce = *kernels.Reduce;
+    const auto exp = GetMathKernels(kernels).Exp;
+    const auto subScalar = kernels.SubScalar;
+
+    //! Losses of the rows are summed after the parallel loop, so the result
+    //! does not depend on number of threads
+    std::vector<double> losses(totalSize / unitSize);
+    const auto rowsPerPiece = std::max(1u, PieceSize / unitSize);
+    ForEachPiece(
+        totalSize, rowsPerPiece * unitSize,
+        [=, &losses](std::size_t offset, unsigned int count)
+        {
+            float buffer[SoftmaxBlockSize];
+            for (auto rowIdx = offset / unitSize;
+                 rowIdx < (offset + count) / unitSize; ++rowIdx)
             {
-                if (i == unitIdx)
+                const float* row = x + rowIdx * unitSize;
+
+                auto max = -std::numeric_limits<float>::infinity();
+                double sum = 0.0;
+                for (unsigned int begin = 0; begin < unitSize;
+                     begin += SoftmaxBlockSize)
                 {
-                    dx[offset + i] += dy[offset + i] *
-                        (x[offset + i] * (1 - x[offset + i]));
+                    const auto size =
+                        std::min(SoftmaxBlockSize, unitSize - begin);
+                    const auto newMax =
+                        std::max(max, reduce.RowMax(row + begin, size));
+                    if (newMax > max)
+                        sum *= std::exp(static_cast<double>(max) - newMax);
+                    max = newMax;
+                    //! -inf prefix adds nothing, as in Softmax
+                    if (max == -std::numeric_limits<float>::infinity())
+                        continue;
+
+                    subScalar(buffer, row + begin, max, size);
+                    exp(buffer, buffer, size);
+                    sum += reduce.RowSum(buffer, size);
                 }
-                else
+
+                const auto lse = static_cast<double>(max) + std::log(sum);
+                logSumExp[rowIdx] = static_cast<float>(lse);
+                losses[rowIdx] = lse - row[label[rowIdx]];
+            }
+        });
+
+    double total = 0.0;
+    for (const auto loss : losses)
+        total += loss;
+    return total;
+}
+
+void CrossEntropyBackward(float* dx, const float* x, const float* logSumExp,
+                          const std::int32_t* label, float scale,
+                          unsigned int totalSize, unsigned int unitSize)
+{
+    const auto& kernels = GetHostKernels();
+    const auto exp = GetMathKernels(kernels).Exp;
+    const auto subScalar = kernels.SubScalar;
+    const auto scaleKernel = kernels.Scale;
+    const auto add = kernels.Add;
+
+    const auto rowsPerPiece = std::max(1u, PieceSize / unitSize);
+    ForEachPiece(
+        totalSize, rowsPerPiece * unitSize,
+        [=](std::size_t offset, unsigned int count)
+        {
+            float buffer[SoftmaxBlockSize];
+            for (auto rowIdx = offset / unitSize;
+                 rowIdx < (offset + count) / unitSize; ++rowIdx)
+            {
+                const float* row = x + rowIdx * unitSize;
+                float* dxRow = dx + rowIdx * unitSize;
+                for (unsigned int begin = 0; begin < unitSize;
+                     begin += SoftmaxBlockSize)
                 {
-                    sum += dy[offset + i] *
-                        (-x[offset + unitIdx] * x[offset + i]);
+                    const auto size =
+                        std::min(SoftmaxBlockSize, unitSize - begin);
+                    subScalar(buffer, row + begin, logSumExp[rowIdx], size);
+                    exp(buffer, buffer, size);
+                    scaleKernel(buffer, buffer, scale, size);
+                    add(dxRow + begin, dxRow + begin, buffer, size);
                 }
+                dxRow[label[rowIdx]] -= scale;
             }
-    }
+        });
 }
 } // namespace Sapphire::Compute::Naive::Dense
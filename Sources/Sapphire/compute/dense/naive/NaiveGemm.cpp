@@ -4,36 +4,652 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Sapphire/compute/dense/naive/GemmTuner.hpp>
 #include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/compute/dense/naive/PackedOperandCache.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
+#include <limits>
+#include <vector>
 
 namespace Sapphire::Compute::Dense::Naive
 {
-void Gemm(unsigned int totalSize, float* out, const float* A,
-          const float* B, unsigned int M, unsigned int N,
-          unsigned int K)
+namespace
+{
+//! Gemm smaller than this number of floating point operations is computed on
+//! single thread, since forking threads costs more than it saves
+constexpr double GemmParallelThreshold = 2.0 * 64 * 64 * 64;
+
+//! Candidate block sizes timed by the autotuner
+//! MC and NC are rounded up to multiples of the register tile
+constexpr unsigned int GemmTuningMC[] = { 48, 96, 144, 192, 288 };
+constexpr unsigned int GemmTuningKC[] = { 128, 192, 256, 384, 512 };
+constexpr unsigned int GemmTuningNC[] = { 512, 1024, 2048, 4096 };
+
+//! Each candidate is timed by the fastest of this number of runs
+constexpr int GemmTuningRuns = 2;
+
+//! Returns 64 byte aligned buffer with at least given number of elements
+//! Buffer is reused between the calls on the same thread
+float* GetPackBuffer(std::vector<float>& buffer, std::size_t size)
+{
+    constexpr std::size_t alignment = 64 / sizeof(float);
+    if (buffer.size() < size + alignment)
+        buffer.resize(size + alignment);
+
+    const auto address = reinterpret_cast<std::uintptr_t>(buffer.data());
+    const auto offset = (64 - address % 64) % 64 / sizeof(float);
+    return buffer.data() + offset;
+}
+
+//! Element strides of (M x K) or (K x N) operand, stored either as it is or
+//! transposed
+struct OperandStride
 {
-    const auto strideA = M * K;
-    const auto strideB = K * N;
-    const auto strideOut = M * N;
+    unsigned int Row;
+    unsigned int Col;
+};
 
-    for (long chunkIdx = 0; chunkIdx < static_cast<long>(
-                                totalSize / strideOut); ++chunkIdx)
-        for (size_t mIdx = 0; mIdx < M; ++mIdx)
-            for (size_t nIdx = 0; nIdx < N; ++nIdx)
+OperandStride GetStride(unsigned int rows, unsigned int cols, bool transpose)
+{
+    if (transpose)
+        return { 1, rows };
+    return { cols, 1 };
+}
+
+//! Packs block of fp32 B
+void PackOperandB(float* packedB, const float* B, OperandStride stride,
+                  unsigned int kc, unsigned int nc, unsigned int nr,
+                  HalfToFloatKernelFunc)
+{
+    PackB(packedB, B, stride.Row, stride.Col, kc, nc, nr);
+}
+
+//! Packs block of 16-bit B, converting it to fp32 with toFloat
+void PackOperandB(float* packedB, const std::uint16_t* B, OperandStride stride,
+                  unsigned int kc, unsigned int nc, unsigned int nr,
+                  HalfToFloatKernelFunc toFloat)
+{
+    PackHalfB(packedB, B, stride.Row, stride.Col, kc, nc, nr, toFloat);
+}
+
+//! Computes out = alpha * op(A) x op(B) + beta * out for single
+//! (M x K) x (K x N) matrix
+//! B is either fp32 or 16-bit floats converted by toFloat while it is packed
+//! \param strideA, strideB : element strides of op(A) and op(B)
+//! \param ldc : row stride of out
+//! \param epilogue : applied with the last block of K if not nullptr. Its bias
+//! points to the bias of the first column of out
+//! \param prepackedB : whole B packed beforehand if not nullptr. B is not
+//! packed again in that case, and first column of out is column colOffset of
+//! prepackedB
+template <typename T>
+void GemmBlocked(const GemmKernelInfo& kernel, float* out, const float* A,
+                 const T* B, unsigned int M, unsigned int N, unsigned int K,
+                 OperandStride strideA, OperandStride strideB,
+                 unsigned int ldc, float alpha, float beta,
+                 const GemmEpilogue* epilogue,
+                 const PackedOperand* prepackedB, unsigned int colOffset,
+                 HalfToFloatKernelFunc toFloat = nullptr)
+{
+    thread_local std::vector<float> packBufferA;
+    thread_local std::vector<float> packBufferB;
+
+    auto* packedA = GetPackBuffer(
+        packBufferA, static_cast<std::size_t>(kernel.MC) * kernel.KC);
+    auto* packedB = GetPackBuffer(
+        packBufferB, static_cast<std::size_t>(kernel.KC) * kernel.NC);
+
+    unsigned int nc = 0;
+    for (unsigned int jc = 0; jc < N; jc += nc)
+    {
+        //! Blocks of N are aligned to the panels of prepacked B
+        nc = std::min(kernel.NC - (colOffset + jc) % kernel.NC, N - jc);
+        for (unsigned int pc = 0; pc < K; pc += kernel.KC)
+        {
+            const auto kc = std::min(kernel.KC, K - pc);
+            //! beta is applied only once, by the first block of K
+            const auto blockBeta = pc == 0 ? beta : 1.0f;
+            const bool lastBlock = pc + kc == K;
+            const float* panelB = packedB;
+            if (prepackedB)
+                panelB = prepackedB->Sliver(kernel, pc, colOffset + jc);
+            else
+                PackOperandB(packedB,
+                             B + static_cast<std::size_t>(pc) * strideB.Row +
+                             static_cast<std::size_t>(jc) * strideB.Col,
+                             strideB, kc, nc, kernel.NR, toFloat);
+
+            for (unsigned int ic = 0; ic < M; ic += kernel.MC)
             {
-                auto* batchPtrA =
-                    A + static_cast<std::size_t>(strideA) * chunkIdx;
-                auto* batchPtrB =
-                    B + static_cast<std::size_t>(strideB) * chunkIdx;
-                auto* batchPtrOut =
-                    out + static_cast<std::size_t>(strideOut) * chunkIdx;
-
-                float sum = 0.0f;
-                for (size_t kIdx = 0; kIdx < K; ++kIdx)
-                    sum += batchPtrA[K * mIdx + kIdx] *
-                        batchPtrB[N * kIdx + nIdx];
-                batchPtrOut[N * mIdx + nIdx] += sum;
+                const auto mc = std::min(kernel.MC, M - ic);
+                PackA(packedA,
+                      A + static_cast<std::size_t>(ic) * strideA.Row +
+                      static_cast<std::size_t>(pc) * strideA.Col,
+                      strideA.Row, strideA.Col, mc, kc, kernel.MR);
+
+                for (unsigned int jr = 0; jr < nc; jr += kernel.NR)
+                {
+                    const auto nr = std::min(kernel.NR, nc - jr);
+                    GemmEpilogue tileEpilogue;
+                    if (epilogue)
+                    {
+                        tileEpilogue = *epilogue;
+                        if (epilogue->Bias)
+                            tileEpilogue.Bias = epilogue->Bias + jc + jr;
+                    }
+                    for (unsigned int ir = 0; ir < mc; ir += kernel.MR)
+                    {
+                        const auto mr = std::min(kernel.MR, mc - ir);
+                        float* tile = out +
+                                      static_cast<std::size_t>(ic + ir) * ldc +
+                                      jc + jr;
+                        GemmMicroKernel(kernel, kc, packedA + ir * kc,
+                                        panelB + jr * kc, tile, ldc, mr, nr,
+                                        alpha, blockBeta,
+                                        epilogue && lastBlock
+                                            ? &tileEpilogue
+                                            : nullptr);
+                    }
+                }
             }
+        }
+    }
+}
+
+//! Splits (M x N) output into at least numTiles tiles if possible
+//! Tiles are multiples of register tile, and larger dimension is split first
+void PartitionTiles(const GemmKernelInfo& kernel, unsigned int M,
+                    unsigned int N, unsigned int numTiles,
+                    unsigned int& tileRows, unsigned int& tileCols)
+{
+    const auto blocksM = (M + kernel.MR - 1) / kernel.MR;
+    const auto blocksN = (N + kernel.NR - 1) / kernel.NR;
+
+    unsigned int partsM = 1, partsN = 1;
+    while (partsM * partsN < numTiles)
+    {
+        const bool canSplitM = partsM < blocksM;
+        const bool canSplitN = partsN < blocksN;
+        if (!canSplitM && !canSplitN)
+            break;
+
+        const auto rowsPerPart = M / partsM;
+        const auto colsPerPart = N / partsN;
+        if (canSplitM && (!canSplitN || rowsPerPart >= colsPerPart))
+            partsM += 1;
+        else
+            partsN += 1;
+    }
+
+    tileRows = (blocksM + partsM - 1) / partsM * kernel.MR;
+    tileCols = (blocksN + partsN - 1) / partsN * kernel.NR;
+}
+
+//! Applies epilogue to every row of N elements in out
+void ApplyEpilogue(unsigned int totalSize, float* out, unsigned int N,
+                   const GemmEpilogue& epilogue)
+{
+    for (unsigned int i = 0; i < totalSize; ++i)
+    {
+        auto value = out[i];
+        if (epilogue.Bias)
+            value += epilogue.Bias[i % N];
+        if (epilogue.Activation && value < 0.0f)
+            value *= epilogue.NegativeSlope;
+        out[i] = value;
+    }
+}
+
+//! Computes every chunk with blocked gemm
+//! \param splitTiles : if true, each chunk is split into 2-D tiles of the
+//! output so every thread computes independent block of out. Whole chunks are
+//! distributed over the threads otherwise
+template <typename T>
+void GemmParallel(const GemmKernelInfo& kernel, bool splitTiles, int threads,
+                  long long numChunks, float* out, const float* A, const T* B,
+                  unsigned int M, unsigned int N, unsigned int K, bool transA,
+                  bool transB, float alpha, float beta,
+                  const GemmEpilogue* epilogue,
+                  const PackedOperand* prepackedB,
+                  HalfToFloatKernelFunc toFloat = nullptr)
+{
+    const auto strideA = static_cast<std::size_t>(M) * K;
+    const auto strideB = static_cast<std::size_t>(K) * N;
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+    const auto opStrideA = GetStride(M, K, transA);
+    const auto opStrideB = GetStride(K, N, transB);
+
+    if (threads == 1 || !splitTiles)
+    {
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+        for (long long chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+        {
+            GemmBlocked(kernel, out + strideOut * chunkIdx,
+                        A + strideA * chunkIdx, B + strideB * chunkIdx, M, N, K,
+                        opStrideA, opStrideB, N, alpha, beta, epilogue,
+                        prepackedB, 0, toFloat);
+        }
+        return;
+    }
+
+    const auto tilesPerChunk =
+        static_cast<unsigned int>((threads + numChunks - 1) / numChunks);
+    unsigned int tileRows = M, tileCols = N;
+    PartitionTiles(kernel, M, N, tilesPerChunk, tileRows, tileCols);
+
+    const long long tilesM = (M + tileRows - 1) / tileRows;
+    const long long tilesN = (N + tileCols - 1) / tileCols;
+    const long long numTasks = numChunks * tilesM * tilesN;
+
+#pragma omp parallel for schedule(static) num_threads(threads)
+    for (long long taskIdx = 0; taskIdx < numTasks; ++taskIdx)
+    {
+        const auto chunkIdx = taskIdx / (tilesM * tilesN);
+        const auto rowIdx =
+            static_cast<unsigned int>(taskIdx / tilesN % tilesM) * tileRows;
+        const auto colIdx =
+            static_cast<unsigned int>(taskIdx % tilesN) * tileCols;
+
+        GemmEpilogue tileEpilogue;
+        if (epilogue)
+        {
+            tileEpilogue = *epilogue;
+            if (epilogue->Bias)
+                tileEpilogue.Bias = epilogue->Bias + colIdx;
+        }
+
+        GemmBlocked(kernel,
+                    out + strideOut * chunkIdx +
+                    static_cast<std::size_t>(rowIdx) * N + colIdx,
+                    A + strideA * chunkIdx +
+                    static_cast<std::size_t>(rowIdx) * opStrideA.Row,
+                    B + strideB * chunkIdx +
+                    static_cast<std::size_t>(colIdx) * opStrideB.Col,
+                    std::min(tileRows, M - rowIdx),
+                    std::min(tileCols, N - colIdx), K, opStrideA, opStrideB,
+                    N, alpha, beta, epilogue ? &tileEpilogue : nullptr,
+                    prepackedB, colIdx, toFloat);
+    }
+}
+
+unsigned int RoundUp(unsigned int value, unsigned int multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+GemmKernelInfo ApplyTuning(GemmKernelInfo kernel, const GemmTuning& tuning)
+{
+    kernel.MC = tuning.MC;
+    kernel.KC = tuning.KC;
+    kernel.NC = tuning.NC;
+    return kernel;
+}
+
+//! Tuning loaded from the file may be written for different kernel
+bool IsValidTuning(const GemmKernelInfo& kernel, const GemmTuning& tuning)
+{
+    return tuning.MC > 0 && tuning.KC > 0 && tuning.NC > 0 &&
+           tuning.MC % kernel.MR == 0 && tuning.NC % kernel.NR == 0;
+}
+
+//! Times candidate tunings on scratch output and returns the fastest one
+//! Each block size is searched separately, starting from the given tuning,
+//! and thread split is searched last
+GemmTuning Autotune(const GemmKernelInfo& kernel, const GemmTuning& initial,
+                    int threads, long long numChunks, const float* A,
+                    const float* B, unsigned int M, unsigned int N,
+                    unsigned int K, bool transA, bool transB)
+{
+    std::vector<float> scratch(static_cast<std::size_t>(M) * N * numChunks);
+    const auto measure = [&](const GemmTuning& tuning)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int run = 0; run < GemmTuningRuns; ++run)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            GemmParallel(ApplyTuning(kernel, tuning), tuning.SplitTiles,
+                         threads, numChunks, scratch.data(), A, B, M, N, K,
+                         transA, transB, 1.0f, 0.0f, nullptr, nullptr);
+            const auto end = std::chrono::steady_clock::now();
+            best = std::min(
+                best, std::chrono::duration<double>(end - begin).count());
+        }
+        return best;
+    };
+
+    auto best = initial;
+    auto bestTime = measure(best);
+    const auto tryCandidate = [&](const GemmTuning& candidate)
+    {
+        if (candidate.MC == best.MC && candidate.KC == best.KC &&
+            candidate.NC == best.NC && candidate.SplitTiles == best.SplitTiles)
+            return;
+        const auto time = measure(candidate);
+        if (time < bestTime)
+        {
+            best = candidate;
+            bestTime = time;
+        }
+    };
+
+    for (const auto kc : GemmTuningKC)
+    {
+        auto candidate = best;
+        candidate.KC = kc;
+        tryCandidate(candidate);
+    }
+    for (const auto mc : GemmTuningMC)
+    {
+        auto candidate = best;
+        candidate.MC = RoundUp(mc, kernel.MR);
+        tryCandidate(candidate);
+    }
+    for (const auto nc : GemmTuningNC)
+    {
+        auto candidate = best;
+        candidate.NC = RoundUp(nc, kernel.NR);
+        tryCandidate(candidate);
+    }
+    if (threads > 1)
+    {
+        auto candidate = best;
+        candidate.SplitTiles = !best.SplitTiles;
+        tryCandidate(candidate);
+    }
+    return best;
+}
+
+void GemmImpl(unsigned int totalSize, float* out, const float* A,
+              const float* B, unsigned int M, unsigned int N, unsigned int K,
+              bool transA, bool transB, float alpha, float beta,
+              const GemmEpilogue* epilogue, int numThreads, bool cacheB)
+{
+    const auto strideA = static_cast<std::size_t>(M) * K;
+    const auto strideB = static_cast<std::size_t>(K) * N;
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+
+    if (strideOut == 0)
+        return;
+
+    if (K == 0 || alpha == 0.0f)
+    {
+        for (unsigned int i = 0; i < totalSize; ++i)
+            out[i] = beta == 0.0f ? 0.0f : beta * out[i];
+        if (epilogue)
+            ApplyEpilogue(totalSize, out, N, *epilogue);
+        return;
+    }
+
+    const auto& kernels = GetHostKernels();
+    const auto numChunks = static_cast<long long>(totalSize / strideOut);
+    const double flops = 2.0 * static_cast<double>(strideOut) * K *
+                         static_cast<double>(numChunks);
+
+    const auto threads = flops < GemmParallelThreshold
+                             ? 1
+                             : Util::ResolveNumThreads(numThreads);
+
+    //! Batch of tiny matrices skips packing with kernel specialized for their
+    //! sizes, and each thread computes contiguous range of the batch
+    const auto smallGemm =
+        epilogue ? nullptr
+                 : FindSmallGemmKernel(*kernels.SmallGemm, M, N, K);
+    if (smallGemm)
+    {
+        const auto chunksPerThread = (numChunks + threads - 1) / threads;
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+        for (long long threadIdx = 0; threadIdx < threads; ++threadIdx)
+        {
+            const auto first = threadIdx * chunksPerThread;
+            const auto count = std::min(chunksPerThread, numChunks - first);
+            if (count > 0)
+                smallGemm(static_cast<unsigned int>(count),
+                          out + strideOut * first, A + strideA * first,
+                          B + strideB * first, transA, transB, alpha, beta);
+        }
+        return;
+    }
+
+    //! Many small matrices are distributed over the threads as a whole, and
+    //! few large matrices are split into tiles by default
+    //! Block sizes and thread split are replaced by stored tuning of this
+    //! config, which is searched on the first call if autotuning is enabled
+    //! (see GemmTuner.hpp)
+    GemmKernelInfo kernel = kernels.Gemm;
+    GemmTuning tuning = { kernel.MC, kernel.KC, kernel.NC,
+                          threads > 1 && numChunks < threads };
+    if (flops >= GemmParallelThreshold)
+    {
+        const GemmConfig config = { kernels.Isa, M, N, K,
+                                    static_cast<unsigned int>(numChunks),
+                                    transA, transB, threads };
+        GemmTuning stored;
+        if (FindGemmTuning(config, stored))
+        {
+            if (IsValidTuning(kernel, stored))
+                tuning = stored;
+        }
+        else if (GetGemmAutotune())
+        {
+            tuning = Autotune(kernel, tuning, threads, numChunks, A, B, M, N,
+                              K, transA, transB);
+            AddGemmTuning(config, tuning);
+        }
+        kernel = ApplyTuning(kernel, tuning);
+    }
+
+    //! B that does not change between calls is packed only once
+    //! Only single B matrix is cached, and broadcast B is passed to every
+    //! call with the same pointer
+    std::shared_ptr<const PackedOperand> prepackedB;
+    if (cacheB && numChunks == 1)
+        prepackedB = GetPackedOperand(kernel, kernels.Isa, B, K, N, transB);
+
+    GemmParallel(kernel, tuning.SplitTiles, threads, numChunks, out, A, B, M,
+                 N, K, transA, transB, alpha, beta, epilogue,
+                 prepackedB.get());
+}
+
+void HalfGemmImpl(unsigned int totalSize, float* out, const float* A,
+                  const std::uint16_t* B, bool bfloat16, unsigned int M,
+                  unsigned int N, unsigned int K, bool transA, bool transB,
+                  float alpha, float beta, const GemmEpilogue* epilogue,
+                  int numThreads)
+{
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+    if (strideOut == 0)
+        return;
+
+    if (K == 0 || alpha == 0.0f)
+    {
+        for (unsigned int i = 0; i < totalSize; ++i)
+            out[i] = beta == 0.0f ? 0.0f : beta * out[i];
+        if (epilogue)
+            ApplyEpilogue(totalSize, out, N, *epilogue);
+        return;
+    }
+
+    const auto& kernels = GetHostKernels();
+    const auto& halfKernels = GetHalfKernels(kernels);
+    const auto toFloat =
+        bfloat16 ? halfKernels.Bf16ToFloat : halfKernels.Fp16ToFloat;
+
+    const auto numChunks = static_cast<long long>(totalSize / strideOut);
+    const double flops = 2.0 * static_cast<double>(strideOut) * K *
+                         static_cast<double>(numChunks);
+    const auto threads = flops < GemmParallelThreshold
+                             ? 1
+                             : Util::ResolveNumThreads(numThreads);
+
+    //! B is converted while it is packed, so it is read from memory once per
+    //! block at half the width of fp32, and micro kernel is the same as Gemm
+    GemmParallel(kernels.Gemm, threads > 1 && numChunks < threads, threads,
+                 numChunks, out, A, B, M, N, K, transA, transB, alpha, beta,
+                 epilogue, nullptr, toFloat);
+}
+
+void GemvImpl(unsigned int totalSize, float* out, const float* A,
+              const float* B, unsigned int M, unsigned int N, unsigned int K,
+              bool transA, bool transB, float alpha, float beta,
+              const GemmEpilogue* epilogue, int numThreads)
+{
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+    if (strideOut == 0)
+        return;
+
+    if (K == 0 || alpha == 0.0f)
+    {
+        for (unsigned int i = 0; i < totalSize; ++i)
+            out[i] = beta == 0.0f ? 0.0f : beta * out[i];
+        if (epilogue)
+            ApplyEpilogue(totalSize, out, N, *epilogue);
+        return;
+    }
+
+    //! (M x 1) output is computed as its transpose, (1 x K) x op(A)^T
+    //! Vector operand is contiguous whether it is transposed or not
+    const bool vectorIsA = M == 1;
+    const auto length = vectorIsA ? N : M;
+    const float* vectors = vectorIsA ? A : B;
+    const float* matrices = vectorIsA ? B : A;
+
+    //! Matrix operand is read as (K x length), which is stored transposed if
+    //! op(B) is transposed or op(A) is not
+    const bool transposed = vectorIsA ? transB : !transA;
+    const auto& kernels = GetHostKernels();
+    const auto kernel = transposed ? kernels.GemvTransposed : kernels.Gemv;
+    const auto ld = transposed ? K : length;
+    const auto strideMatrix = static_cast<std::size_t>(K) * length;
+
+    const auto numChunks = static_cast<long long>(totalSize / strideOut);
+    const double flops =
+        2.0 * static_cast<double>(strideMatrix) * static_cast<double>(numChunks);
+    const auto threads = flops < GemmParallelThreshold
+                             ? 1
+                             : Util::ResolveNumThreads(numThreads);
+
+    //! Outputs of each chunk are split into blocks if there are not enough
+    //! chunks, so every thread streams separate rows or columns of the matrix
+    constexpr unsigned int blockAlignment = 64;
+    auto blockSize = length;
+    if (numChunks < threads)
+    {
+        const auto blocksPerChunk =
+            static_cast<unsigned int>((threads + numChunks - 1) / numChunks);
+        blockSize = (length + blocksPerChunk - 1) / blocksPerChunk;
+        blockSize = (blockSize + blockAlignment - 1) / blockAlignment *
+                    blockAlignment;
+    }
+
+    const long long blocksPerChunk = (length + blockSize - 1) / blockSize;
+    const long long numTasks = numChunks * blocksPerChunk;
+
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+    for (long long taskIdx = 0; taskIdx < numTasks; ++taskIdx)
+    {
+        const auto chunkIdx = taskIdx / blocksPerChunk;
+        const auto begin =
+            static_cast<unsigned int>(taskIdx % blocksPerChunk) * blockSize;
+        const auto count = std::min(blockSize, length - begin);
+        const auto offset = transposed
+                                ? static_cast<std::size_t>(begin) * ld
+                                : static_cast<std::size_t>(begin);
+
+        auto* outBlock = out + strideOut * chunkIdx + begin;
+        kernel(K, count, vectors + static_cast<std::size_t>(K) * chunkIdx,
+               matrices + strideMatrix * chunkIdx + offset, ld, outBlock,
+               alpha, beta);
+
+        //! Epilogue is applied to the block while it is still in cache
+        //! Block is part of single row if vector is A, and is a column of
+        //! outputs sharing the first bias otherwise
+        if (epilogue)
+        {
+            auto blockEpilogue = *epilogue;
+            if (vectorIsA && epilogue->Bias)
+                blockEpilogue.Bias = epilogue->Bias + begin;
+            ApplyEpilogue(count, outBlock, vectorIsA ? count : 1,
+                          blockEpilogue);
+        }
+    }
+}
+} // namespace
+
+void Gemm(unsigned int totalSize, float* out, const float* A,
+          const float* B, unsigned int M, unsigned int N,
+          unsigned int K, bool transA, bool transB, float alpha, float beta,
+          int numThreads, bool cacheB)
+{
+    GemmImpl(totalSize, out, A, B, M, N, K, transA, transB, alpha, beta,
+             nullptr, numThreads, cacheB);
+}
+
+void GemmBiasActivation(unsigned int totalSize, float* out, const float* A,
+                        const float* B, const float* bias, unsigned int M,
+                        unsigned int N, unsigned int K, bool transA,
+                        bool transB, bool activation, float negativeSlope,
+                        int numThreads, bool cacheB)
+{
+    GemmEpilogue epilogue;
+    epilogue.Bias = bias;
+    epilogue.Activation = activation;
+    epilogue.NegativeSlope = negativeSlope;
+    GemmImpl(totalSize, out, A, B, M, N, K, transA, transB, 1.0f, 0.0f,
+             &epilogue, numThreads, cacheB);
+}
+
+void Gemv(unsigned int totalSize, float* out, const float* A,
+          const float* B, unsigned int M, unsigned int N, unsigned int K,
+          bool transA, bool transB, float alpha, float beta, int numThreads,
+          bool)
+{
+    GemvImpl(totalSize, out, A, B, M, N, K, transA, transB, alpha, beta,
+             nullptr, numThreads);
+}
+
+void GemvBiasActivation(unsigned int totalSize, float* out, const float* A,
+                        const float* B, const float* bias, unsigned int M,
+                        unsigned int N, unsigned int K, bool transA,
+                        bool transB, bool activation, float negativeSlope,
+                        int numThreads, bool)
+{
+    GemmEpilogue epilogue;
+    epilogue.Bias = bias;
+    epilogue.Activation = activation;
+    epilogue.NegativeSlope = negativeSlope;
+    GemvImpl(totalSize, out, A, B, M, N, K, transA, transB, 1.0f, 0.0f,
+             &epilogue, numThreads);
+}
+
+void HalfGemm(unsigned int totalSize, float* out, const float* A,
+              const std::uint16_t* B, bool bfloat16, unsigned int M,
+              unsigned int N, unsigned int K, bool transA, bool transB,
+              float alpha, float beta, int numThreads)
+{
+    HalfGemmImpl(totalSize, out, A, B, bfloat16, M, N, K, transA, transB,
+                 alpha, beta, nullptr, numThreads);
+}
+
+void HalfGemmBiasActivation(unsigned int totalSize, float* out,
+                            const float* A, const std::uint16_t* B,
+                            bool bfloat16, const float* bias, unsigned int M,
+                            unsigned int N, unsigned int K, bool transA,
+                            bool transB, bool activation, float negativeSlope,
+                            int numThreads)
+{
+    GemmEpilogue epilogue;
+    epilogue.Bias = bias;
+    epilogue.Activation = activation;
+    epilogue.NegativeSlope = negativeSlope;
+    HalfGemmImpl(totalSize, out, A, B, bfloat16, M, N, K, transA, transB,
+                 1.0f, 0.0f, &epilogue, numThreads);
 }
-} // namespace Sapphire::Compute::Naive::Dense
+} // namespace Sapphire::Compute::Dense::Naive
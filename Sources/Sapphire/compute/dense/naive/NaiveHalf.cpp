@@ -0,0 +1,142 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveHalf.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <algorithm>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+//! Number of elements converted to fp32 at once by elementwise operations
+//! Three pieces of fp32 fit in L1 cache
+constexpr unsigned int HalfPieceSize = 1024;
+
+//! Arrays smaller than this are processed on single thread, since they are
+//! bound by the cost of forking threads rather than memory bandwidth
+constexpr unsigned int HalfParallelThreshold = 1u << 16;
+
+int ResolveThreads(unsigned int totalSize, int numThreads)
+{
+    return totalSize < HalfParallelThreshold
+               ? 1
+               : Util::ResolveNumThreads(numThreads);
+}
+
+//! Calls func(offset, count) for pieces of HalfPieceSize elements, split over
+//! the threads
+template <typename Func>
+void ForEachPiece(unsigned int totalSize, int numThreads, Func func)
+{
+    const auto threads = ResolveThreads(totalSize, numThreads);
+    const long long numPieces =
+        (static_cast<long long>(totalSize) + HalfPieceSize - 1) /
+        HalfPieceSize;
+
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+    for (long long pieceIdx = 0; pieceIdx < numPieces; ++pieceIdx)
+    {
+        const auto offset = static_cast<unsigned int>(pieceIdx) * HalfPieceSize;
+        func(static_cast<std::size_t>(offset),
+             std::min(HalfPieceSize, totalSize - offset));
+    }
+}
+
+void HalfBinary(unsigned int totalSize, std::uint16_t* output,
+                const std::uint16_t* inputA, const std::uint16_t* inputB,
+                bool bfloat16, int numThreads, BinaryKernelFunc kernel)
+{
+    const auto& halfKernels = GetHalfKernels(GetHostKernels());
+    const auto toFloat =
+        bfloat16 ? halfKernels.Bf16ToFloat : halfKernels.Fp16ToFloat;
+    const auto fromFloat =
+        bfloat16 ? halfKernels.FloatToBf16 : halfKernels.FloatToFp16;
+
+    ForEachPiece(totalSize, numThreads,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     float a[HalfPieceSize];
+                     float b[HalfPieceSize];
+                     toFloat(a, inputA + offset, count);
+                     toFloat(b, inputB + offset, count);
+                     kernel(a, a, b, count);
+                     fromFloat(output + offset, a, count);
+                 });
+}
+} // namespace
+
+void HalfToFloat(unsigned int totalSize, float* output,
+                 const std::uint16_t* input, bool bfloat16, int numThreads)
+{
+    const auto& halfKernels = GetHalfKernels(GetHostKernels());
+    const auto toFloat =
+        bfloat16 ? halfKernels.Bf16ToFloat : halfKernels.Fp16ToFloat;
+    ForEachPiece(totalSize, numThreads,
+                 [=](std::size_t offset, unsigned int count)
+                 { toFloat(output + offset, input + offset, count); });
+}
+
+void FloatToHalf(unsigned int totalSize, std::uint16_t* output,
+                 const float* input, bool bfloat16, int numThreads)
+{
+    const auto& halfKernels = GetHalfKernels(GetHostKernels());
+    const auto fromFloat =
+        bfloat16 ? halfKernels.FloatToBf16 : halfKernels.FloatToFp16;
+    ForEachPiece(totalSize, numThreads,
+                 [=](std::size_t offset, unsigned int count)
+                 { fromFloat(output + offset, input + offset, count); });
+}
+
+void HalfAdd(unsigned int totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             bool bfloat16, int numThreads)
+{
+    HalfBinary(totalSize, output, inputA, inputB, bfloat16, numThreads,
+               GetHostKernels().Add);
+}
+
+void HalfSub(unsigned int totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             bool bfloat16, int numThreads)
+{
+    HalfBinary(totalSize, output, inputA, inputB, bfloat16, numThreads,
+               GetHostKernels().Sub);
+}
+
+void HalfDot(unsigned int totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             bool bfloat16, int numThreads)
+{
+    HalfBinary(totalSize, output, inputA, inputB, bfloat16, numThreads,
+               GetHostKernels().Dot);
+}
+
+void HalfScale(unsigned int totalSize, std::uint16_t* output,
+               const std::uint16_t* input, float scaleFactor, bool bfloat16,
+               int numThreads)
+{
+    const auto& kernels = GetHostKernels();
+    const auto& halfKernels = GetHalfKernels(kernels);
+    const auto toFloat =
+        bfloat16 ? halfKernels.Bf16ToFloat : halfKernels.Fp16ToFloat;
+    const auto fromFloat =
+        bfloat16 ? halfKernels.FloatToBf16 : halfKernels.FloatToFp16;
+    const auto scale = kernels.Scale;
+
+    ForEachPiece(totalSize, numThreads,
+                 [=](std::size_t offset, unsigned int count)
+                 {
+                     float piece[HalfPieceSize];
+                     toFloat(piece, input + offset, count);
+                     scale(piece, piece, scaleFactor, count);
+                     fromFloat(output + offset, piece, count);
+                 });
+}
+} // namespace Sapphire::Compute::Dense::Naive
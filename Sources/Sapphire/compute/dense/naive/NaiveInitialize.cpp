@@ -5,30 +5,114 @@
 // property of any third parties.
 
 #include <Sapphire/compute/dense/naive/NaiveInitialize.hpp>
-#include <random>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 
 namespace Sapphire::Compute::Dense::Naive
 {
-void Normal(float* data, float mean, float sd, const Shape& shape)
+namespace
 {
-    const auto totalSize = shape.Size();
-    std::random_device rd{};
-    std::mt19937 gen{ rd() };
-    std::normal_distribution dist(mean, sd);
+//! Number of elements generated at once by a thread
+//! Should be multiple of 4, so every piece starts at a group of the stream
+constexpr std::size_t PieceSize = 2048;
+
+//! Arrays smaller than this are generated on single thread
+constexpr std::size_t ParallelThreshold = 1u << 16;
 
-    for (int i = 0; i < totalSize; ++i)
-        data[i] = dist(gen);
+constexpr float TwoPi = 6.28318530717958647692f;
+
+//! Converts random bits to float in [0, 1) using upper 24 bits
+float ToUnitFloat(std::uint32_t bits)
+{
+    return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
 }
 
-void Uniform(float* data, float min, float max, const Shape& shape)
+//! Calls func(offset, count) for pieces of PieceSize elements, split over
+//! the threads
+template <typename Func>
+void ForEachPiece(std::size_t totalSize, Func func)
 {
-    const auto totalSize = shape.Size();
-    std::random_device rd{};
-    std::mt19937 gen{ rd() };
-    std::uniform_real_distribution dist(min, max);
+    const auto numPieces =
+        static_cast<long long>((totalSize + PieceSize - 1) / PieceSize);
+    const auto threads = Util::ResolveNumThreads(0);
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1 && totalSize >= ParallelThreshold)
+    for (long long pieceIdx = 0; pieceIdx < numPieces; ++pieceIdx)
+    {
+        const auto offset = static_cast<std::size_t>(pieceIdx) * PieceSize;
+        func(offset, static_cast<unsigned int>(
+                 std::min(PieceSize, totalSize - offset)));
+    }
+}
+} // namespace
 
-    for (int i = 0; i < totalSize; ++i)
-        data[i] = dist(gen);
+void Normal(float* data, float mean, float sd, const Shape& shape,
+            const Util::RandomStream& stream)
+{
+    const auto& kernels = GetHostKernels();
+    const auto& math = GetMathKernels(kernels);
+    const auto log = math.Log;
+    const auto sin = math.Sin;
+    const auto cos = math.Cos;
+
+    ForEachPiece(
+        static_cast<std::size_t>(shape.Size()),
+        [=](std::size_t offset, unsigned int count)
+        {
+            //! Each group of 4 numbers gives two pairs of (radius, angle),
+            //! and each pair gives two samples
+            constexpr auto pairs = static_cast<unsigned int>(PieceSize / 2);
+            //! Zero initialized, since compilers cannot tell that the loop
+            //! below writes every element passed to the math kernels
+            float radius[pairs] = {}, angle[pairs] = {}, sine[pairs] = {};
+            const auto numPairs = (count + 1) / 2;
+            for (unsigned int i = 0; i < numPairs; i += 2)
+            {
+                const auto bits = stream.Generate((offset + 2 * i) / 4);
+                //! Radius uses (0, 1] to keep logarithm finite
+                radius[i] = ToUnitFloat(bits[0]) + 1.0f / 16777216.0f;
+                angle[i] = ToUnitFloat(bits[1]) * TwoPi;
+                radius[i + 1] = ToUnitFloat(bits[2]) + 1.0f / 16777216.0f;
+                angle[i + 1] = ToUnitFloat(bits[3]) * TwoPi;
+            }
+
+            log(radius, radius, numPairs);
+            sin(sine, angle, numPairs);
+            cos(angle, angle, numPairs);
+            for (unsigned int i = 0; i < numPairs; ++i)
+                radius[i] = sd * std::sqrt(-2.0f * radius[i]);
+
+            float* out = data + offset;
+            for (unsigned int i = 0; i < count / 2; ++i)
+            {
+                out[2 * i] = mean + radius[i] * angle[i];
+                out[2 * i + 1] = mean + radius[i] * sine[i];
+            }
+            if (count % 2 == 1)
+                out[count - 1] = mean + radius[numPairs - 1] *
+                                 angle[numPairs - 1];
+        });
+}
+
+void Uniform(float* data, float min, float max, const Shape& shape,
+             const Util::RandomStream& stream)
+{
+    const auto range = max - min;
+    ForEachPiece(
+        static_cast<std::size_t>(shape.Size()),
+        [=](std::size_t offset, unsigned int count)
+        {
+            float* out = data + offset;
+            for (unsigned int i = 0; i < count; i += 4)
+            {
+                const auto bits = stream.Generate((offset + i) / 4);
+                for (unsigned int k = 0; k < 4 && i + k < count; ++k)
+                    out[i + k] = min + range * ToUnitFloat(bits[k]);
+            }
+        });
 }
 
 void Scalar(float* data, float value, const Shape& shape)
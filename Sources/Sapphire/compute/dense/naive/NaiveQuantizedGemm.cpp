@@ -0,0 +1,259 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveQuantizedGemm.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+//! Quantized gemm smaller than this number of operations is computed on
+//! single thread, since forking threads costs more than it saves
+constexpr double QuantizedGemmParallelThreshold = 2.0 * 64 * 64 * 64;
+
+unsigned int RoundUp(unsigned int value, unsigned int multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+int ResolveThreads(int numThreads, unsigned int M, unsigned int N,
+                   unsigned int K)
+{
+    const double ops = 2.0 * M * N * K;
+    return ops < QuantizedGemmParallelThreshold
+               ? 1
+               : Util::ResolveNumThreads(numThreads);
+}
+
+PackedInt8Operand Pack(const Int8GemmKernelInfo& kernel,
+                       const std::int8_t* B, unsigned int K, unsigned int N,
+                       bool transB, int threads)
+{
+    const unsigned int rowStride = transB ? 1 : N;
+    const unsigned int colStride = transB ? K : 1;
+    const auto kPadded = RoundUp(K, kernel.KGroup);
+    const auto panels = static_cast<long long>((N + kernel.NR - 1) / kernel.NR);
+    const auto panelSize = static_cast<std::size_t>(kPadded) * kernel.NR;
+
+    PackedInt8Operand packed;
+    packed.NR = kernel.NR;
+    packed.KGroup = kernel.KGroup;
+    packed.K = K;
+    packed.N = N;
+    packed.Data.resize(panelSize * panels);
+    packed.ColumnSums.resize(N);
+
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+    for (long long panelIdx = 0; panelIdx < panels; ++panelIdx)
+    {
+        const auto colIdx = static_cast<unsigned int>(panelIdx) * kernel.NR;
+        const auto cols = std::min(kernel.NR, N - colIdx);
+        PackInt8B(packed.Data.data() + panelSize * panelIdx,
+                  B + static_cast<std::size_t>(colIdx) * colStride, rowStride,
+                  colStride, K, cols, kernel.NR, kernel.KGroup);
+
+        for (unsigned int j = colIdx; j < colIdx + cols; ++j)
+        {
+            std::int32_t sum = 0;
+            for (unsigned int k = 0; k < K; ++k)
+                sum += B[static_cast<std::size_t>(k) * rowStride +
+                         static_cast<std::size_t>(j) * colStride];
+            packed.ColumnSums[j] = sum;
+        }
+    }
+    return packed;
+}
+
+//! Restores (K x N) matrix from operand packed for another kernel
+std::vector<std::int8_t> Unpack(const PackedInt8Operand& packed)
+{
+    const auto kPadded = RoundUp(packed.K, packed.KGroup);
+    std::vector<std::int8_t> B(static_cast<std::size_t>(packed.K) * packed.N);
+    for (unsigned int k = 0; k < packed.K; ++k)
+        for (unsigned int j = 0; j < packed.N; ++j)
+            B[static_cast<std::size_t>(k) * packed.N + j] =
+                packed.Data[static_cast<std::size_t>(j / packed.NR) *
+                            kPadded * packed.NR +
+                            static_cast<std::size_t>(k / packed.KGroup) *
+                            packed.KGroup * packed.NR +
+                            j % packed.NR * packed.KGroup +
+                            k % packed.KGroup];
+    return B;
+}
+
+void Store(float* out, float value, float, std::int32_t)
+{
+    *out = value;
+}
+
+void Store(std::uint8_t* out, float value, float inverseScaleOut,
+           std::int32_t zeroPointOut)
+{
+    const auto quantized = std::nearbyint(value * inverseScaleOut) +
+                           static_cast<float>(zeroPointOut);
+    *out = static_cast<std::uint8_t>(std::clamp(quantized, 0.0f, 255.0f));
+}
+
+template <typename T>
+void QuantizedGemmImpl(T* out, const std::uint8_t* A,
+                       const PackedInt8Operand& B, unsigned int M,
+                       bool transA, bool transOut, float scaleA,
+                       std::int32_t zeroPointA, const float* scaleB,
+                       const std::int32_t* zeroPointB, const float* bias,
+                       bool activation, float negativeSlope,
+                       float inverseScaleOut,
+                       std::int32_t zeroPointOut, int numThreads)
+{
+    const auto& kernel = GetInt8GemmKernel(GetHostKernels());
+    const unsigned int N = B.N, K = B.K;
+    if (M == 0 || N == 0)
+        return;
+    const int threads = ResolveThreads(numThreads, M, N, K);
+
+    //! Operand packed for another instruction set (e.g. before
+    //! SetInstructionSet was called) is packed again for this call
+    PackedInt8Operand repacked;
+    const PackedInt8Operand* packedB = &B;
+    if (!IsPackedForCurrentKernel(B))
+    {
+        const auto unpacked = Unpack(B);
+        repacked = Pack(kernel, unpacked.data(), K, N, false, threads);
+        packedB = &repacked;
+    }
+
+    const unsigned int rowStride = transA ? 1 : K;
+    const unsigned int colStride = transA ? M : 1;
+    const std::size_t outRowStride = transOut ? 1 : N;
+    const std::size_t outColStride = transOut ? M : 1;
+    const auto kPadded = RoundUp(K, kernel.KGroup);
+    const auto groups = kPadded / kernel.KGroup;
+    const auto rowBlocks = static_cast<long long>((M + kernel.MR - 1) /
+                                                  kernel.MR);
+    const auto panels = static_cast<long long>((N + kernel.NR - 1) /
+                                               kernel.NR);
+    const auto sliverBytes = static_cast<std::size_t>(kernel.MR) * kPadded *
+                             (kernel.WideA ? 2 : 1);
+
+    //! A is packed once, and each sliver is shared by every panel of B
+    std::vector<std::int16_t> packedA((sliverBytes * rowBlocks + 1) / 2);
+    auto* packedABytes = reinterpret_cast<std::uint8_t*>(packedA.data());
+    std::vector<std::int32_t> rowSums(M);
+
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+    for (long long blockIdx = 0; blockIdx < rowBlocks; ++blockIdx)
+    {
+        const auto rowIdx = static_cast<unsigned int>(blockIdx) * kernel.MR;
+        const auto rows = std::min(kernel.MR, M - rowIdx);
+        PackInt8A(packedABytes + sliverBytes * blockIdx,
+                  A + static_cast<std::size_t>(rowIdx) * rowStride, rowStride,
+                  colStride, rows, K, kernel.MR, kernel.KGroup, kernel.WideA);
+
+        for (unsigned int i = rowIdx; i < rowIdx + rows; ++i)
+        {
+            std::int32_t sum = 0;
+            for (unsigned int k = 0; k < K; ++k)
+                sum += A[static_cast<std::size_t>(i) * rowStride +
+                         static_cast<std::size_t>(k) * colStride];
+            rowSums[i] = sum;
+        }
+    }
+
+    //! Consecutive tiles share the same panel of B
+    const auto numTiles = rowBlocks * panels;
+    const auto panelSize = static_cast<std::size_t>(kPadded) * kernel.NR;
+
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1)
+    for (long long tileIdx = 0; tileIdx < numTiles; ++tileIdx)
+    {
+        const auto blockIdx = tileIdx % rowBlocks;
+        const auto panelIdx = tileIdx / rowBlocks;
+        const auto rowIdx = static_cast<unsigned int>(blockIdx) * kernel.MR;
+        const auto colIdx = static_cast<unsigned int>(panelIdx) * kernel.NR;
+        const auto rows = std::min(kernel.MR, M - rowIdx);
+        const auto cols = std::min(kernel.NR, N - colIdx);
+
+        std::int32_t tile[Int8GemmMaxTileSize];
+        kernel.MicroKernel(groups, packedABytes + sliverBytes * blockIdx,
+                           packedB->Data.data() + panelSize * panelIdx, tile);
+
+        //! sum((a - za) * (b - zb)) = sum(a * b) - zb * sum(a) - za * sum(b)
+        //! + K * za * zb
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            const auto rowSum = static_cast<long long>(rowSums[rowIdx + i]);
+            T* outRow = out + (rowIdx + i) * outRowStride +
+                        colIdx * outColStride;
+            for (unsigned int j = 0; j < cols; ++j)
+            {
+                const auto col = colIdx + j;
+                const auto zeroPoint = static_cast<long long>(zeroPointB[col]);
+                const auto sum =
+                    static_cast<long long>(tile[i * kernel.NR + j]) -
+                    zeroPoint * rowSum -
+                    static_cast<long long>(zeroPointA) *
+                    packedB->ColumnSums[col] +
+                    static_cast<long long>(K) * zeroPointA * zeroPoint;
+
+                auto value = scaleA * scaleB[col] * static_cast<float>(sum);
+                if (bias)
+                    value += bias[col];
+                if (activation && value < 0.0f)
+                    value *= negativeSlope;
+                Store(outRow + j * outColStride, value, inverseScaleOut,
+                      zeroPointOut);
+            }
+        }
+    }
+}
+} // namespace
+
+PackedInt8Operand PackInt8Operand(const std::int8_t* B, unsigned int K,
+                                  unsigned int N, bool transB, int numThreads)
+{
+    return Pack(GetInt8GemmKernel(GetHostKernels()), B, K, N, transB,
+                ResolveThreads(numThreads, 1, N, K));
+}
+
+bool IsPackedForCurrentKernel(const PackedInt8Operand& packed)
+{
+    const auto& kernel = GetInt8GemmKernel(GetHostKernels());
+    return packed.NR == kernel.NR && packed.KGroup == kernel.KGroup;
+}
+
+void QuantizedGemm(float* out, const std::uint8_t* A,
+                   const PackedInt8Operand& B, unsigned int M, bool transA,
+                   bool transOut, float scaleA, std::int32_t zeroPointA,
+                   const float* scaleB, const std::int32_t* zeroPointB,
+                   const float* bias, bool activation, float negativeSlope,
+                   int numThreads)
+{
+    QuantizedGemmImpl(out, A, B, M, transA, transOut, scaleA, zeroPointA,
+                      scaleB, zeroPointB, bias, activation, negativeSlope,
+                      1.0f, 0, numThreads);
+}
+
+void QuantizedGemmRequantize(std::uint8_t* out, const std::uint8_t* A,
+                             const PackedInt8Operand& B, unsigned int M,
+                             bool transA, bool transOut, float scaleA,
+                             std::int32_t zeroPointA, const float* scaleB,
+                             const std::int32_t* zeroPointB,
+                             const float* bias, bool activation,
+                             float negativeSlope, float scaleOut,
+                             std::int32_t zeroPointOut, int numThreads)
+{
+    QuantizedGemmImpl(out, A, B, M, transA, transOut, scaleA, zeroPointA,
+                      scaleB, zeroPointB, bias, activation, negativeSlope,
+                      1.0f / scaleOut, zeroPointOut, numThreads);
+}
+} // namespace Sapphire::Compute::Dense::Naive
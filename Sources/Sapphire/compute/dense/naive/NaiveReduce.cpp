@@ -0,0 +1,575 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveReduce.hpp>
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/util/Parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+//! Reductions of fewer elements than this are computed on single thread
+constexpr std::size_t ParallelThreshold = 1u << 16;
+
+//! If outputs give fewer tasks than this, reduced elements of each output
+//! are also split into parts of at least SplitSize elements
+constexpr std::size_t MinParallelTasks = 64;
+constexpr std::size_t SplitSize = 1u << 15;
+constexpr std::size_t MaxSplits = 64;
+
+//! Number of columns accumulated at once by a task in case (b)
+constexpr std::size_t ColumnBlockSize = 512;
+
+//! Row indices of ColumnArgMax are kept as floats
+constexpr std::size_t MaxArgMaxRows = 1u << 24;
+
+constexpr std::size_t Unlimited = std::numeric_limits<std::size_t>::max();
+
+constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+using Accumulators = float (*)[ColumnBlockSize];
+
+std::size_t Product(const std::vector<std::size_t>& extents)
+{
+    std::size_t product = 1;
+    for (const auto extent : extents)
+        product *= extent;
+    return product;
+}
+
+//! Offset in x of index-th element of given dimensions
+std::size_t Offset(const std::vector<std::size_t>& extents,
+                   const std::vector<std::size_t>& strides, std::size_t index)
+{
+    std::size_t offset = 0;
+    for (auto dim = extents.size(); dim-- > 0;)
+    {
+        offset += index % extents[dim] * strides[dim];
+        index /= extents[dim];
+    }
+    return offset;
+}
+
+template <typename Func>
+void ParallelFor(std::size_t count, std::size_t totalSize, Func func)
+{
+    const auto threads = Util::ResolveNumThreads(0);
+#pragma omp parallel for schedule(static) num_threads(threads) \
+    if (threads > 1 && totalSize >= ParallelThreshold)
+    for (long long i = 0; i < static_cast<long long>(count); ++i)
+        func(static_cast<std::size_t>(i));
+}
+
+//! Number of parts reduced elements of each task are split into
+std::size_t SplitCount(std::size_t tasks, std::size_t elementsPerTask)
+{
+    if (tasks >= MinParallelTasks)
+        return 1;
+    return std::clamp<std::size_t>(elementsPerTask / SplitSize, 1,
+                                   MaxSplits);
+}
+
+//! Op should provide
+//! Partial type holding reduction of a part of reduced elements,
+//! Arrays (number of accumulators per column) and MaxRows (number of rows a
+//! column accumulator can reduce), and functions
+//! Init(output, begin) and Row(partial, output, row, size, index) for
+//! case (a), where index is position of row[0] in reduced elements,
+//! ColumnInit(acc, output, size), ColumnRow(acc, output, row, size, rowIdx)
+//! and Extract(acc, column, begin) for case (b), where output is the first
+//! output of the columns and rowIdx is relative to begin,
+//! Combine(partial, next) and Store(output, partial)
+//! Partials are combined in order of reduced elements
+template <typename Op>
+void CombineAndStore(const Op& op,
+                     const std::vector<typename Op::Partial>& partials,
+                     std::size_t outputs, std::size_t splits)
+{
+    for (std::size_t output = 0; output < outputs; ++output)
+    {
+        auto partial = partials[output * splits];
+        for (std::size_t split = 1; split < splits; ++split)
+            op.Combine(partial, partials[output * splits + split]);
+        op.Store(output, partial);
+    }
+}
+
+//! Case (a) : each task reduces a range of reduced elements of an output,
+//! in rows of InnerExtent contiguous elements
+template <typename Op>
+void ReduceRows(const float* x, const ReduceLayout& layout, const Op& op)
+{
+    const auto outputs = layout.OutputSize;
+    const auto reduceSize = layout.ReduceSize;
+    const auto rowSize = layout.InnerExtent;
+    const auto splits = SplitCount(outputs, reduceSize);
+
+    std::vector<typename Op::Partial> partials(
+        splits > 1 ? outputs * splits : 0);
+    ParallelFor(outputs * splits, outputs * reduceSize,
+                [&](std::size_t task)
+                {
+                    const auto output = task / splits;
+                    const auto split = task % splits;
+                    const auto begin = reduceSize * split / splits;
+                    const auto end = reduceSize * (split + 1) / splits;
+                    const auto* base = x + Offset(layout.KeptExtents,
+                                                  layout.KeptStrides, output);
+
+                    auto partial = op.Init(output, begin);
+                    for (auto index = begin; index < end;)
+                    {
+                        const auto column = index % rowSize;
+                        const auto size = std::min(rowSize - column,
+                                                   end - index);
+                        const auto* row =
+                            base + Offset(layout.ReducedExtents,
+                                          layout.ReducedStrides,
+                                          index / rowSize) + column;
+                        op.Row(partial, output, row,
+                               static_cast<unsigned int>(size), index);
+                        index += size;
+                    }
+
+                    if (splits == 1)
+                        op.Store(output, partial);
+                    else
+                        partials[task] = partial;
+                });
+
+    if (splits > 1)
+        CombineAndStore(op, partials, outputs, splits);
+}
+
+//! Case (b) : each task accumulates a range of reduced rows into a block of
+//! at most ColumnBlockSize columns
+template <typename Op>
+void ReduceColumns(const float* x, const ReduceLayout& layout, const Op& op)
+{
+    const auto outputs = layout.OutputSize;
+    const auto columns = layout.InnerExtent;
+    const auto groups = outputs / columns;
+    const auto blocks = (columns + ColumnBlockSize - 1) / ColumnBlockSize;
+    const auto rows = layout.ReduceSize;
+    const auto splits = std::max(
+        SplitCount(groups * blocks,
+                   rows * std::min(columns, ColumnBlockSize)),
+        rows / Op::MaxRows + (rows % Op::MaxRows != 0));
+
+    std::vector<typename Op::Partial> partials(
+        splits > 1 ? outputs * splits : 0);
+    ParallelFor(groups * blocks * splits, outputs * rows,
+                [&](std::size_t task)
+                {
+                    const auto split = task % splits;
+                    const auto block = task / splits % blocks;
+                    const auto group = task / splits / blocks;
+                    const auto column = block * ColumnBlockSize;
+                    const auto size = static_cast<unsigned int>(
+                        std::min(ColumnBlockSize, columns - column));
+                    const auto begin = rows * split / splits;
+                    const auto end = rows * (split + 1) / splits;
+                    const auto* base = x + Offset(layout.KeptExtents,
+                                                  layout.KeptStrides, group) +
+                                       column;
+                    const auto first = group * columns + column;
+
+                    float acc[Op::Arrays][ColumnBlockSize];
+                    op.ColumnInit(acc, first, size);
+                    for (auto index = begin; index < end; ++index)
+                        op.ColumnRow(acc, first,
+                                     base + Offset(layout.ReducedExtents,
+                                                   layout.ReducedStrides,
+                                                   index),
+                                     size, index - begin);
+
+                    for (unsigned int i = 0; i < size; ++i)
+                    {
+                        const auto partial = op.Extract(acc, i, begin);
+                        if (splits == 1)
+                            op.Store(first + i, partial);
+                        else
+                            partials[(first + i) * splits + split] = partial;
+                    }
+                });
+
+    if (splits > 1)
+        CombineAndStore(op, partials, outputs, splits);
+}
+
+template <typename Op>
+void Reduce(const float* x, const ReduceLayout& layout, const Op& op)
+{
+    if (layout.OutputSize == 0)
+        return;
+    if (layout.InnerReduced)
+        ReduceRows(x, layout, op);
+    else
+        ReduceColumns(x, layout, op);
+}
+
+struct SumOp
+{
+    using Partial = double;
+    static constexpr std::size_t Arrays = 2;
+    static constexpr std::size_t MaxRows = Unlimited;
+
+    const ReduceKernels& Kernels;
+    float* Y;
+    double Divisor;
+
+    Partial Init(std::size_t, std::size_t) const
+    {
+        return 0.0;
+    }
+
+    void Row(Partial& partial, std::size_t, const float* row,
+             unsigned int size, std::size_t) const
+    {
+        partial += Kernels.RowSum(row, size);
+    }
+
+    void ColumnInit(Accumulators acc, std::size_t, unsigned int size) const
+    {
+        std::fill(acc[0], acc[0] + size, 0.0f);
+        std::fill(acc[1], acc[1] + size, 0.0f);
+    }
+
+    void ColumnRow(Accumulators acc, std::size_t, const float* row,
+                   unsigned int size, std::size_t) const
+    {
+        Kernels.ColumnSum(acc[0], acc[1], row, size);
+    }
+
+    Partial Extract(Accumulators acc, unsigned int column, std::size_t) const
+    {
+        return static_cast<double>(acc[0][column]) - acc[1][column];
+    }
+
+    void Combine(Partial& partial, Partial next) const
+    {
+        partial += next;
+    }
+
+    void Store(std::size_t output, Partial partial) const
+    {
+        Y[output] = static_cast<float>(partial / Divisor);
+    }
+};
+
+//! Sums (x - center)^2 with center of each output
+struct DeviationOp : SumOp
+{
+    const float* Center;
+
+    void Row(Partial& partial, std::size_t output, const float* row,
+             unsigned int size, std::size_t) const
+    {
+        partial += Kernels.RowDeviation(row, Center[output], size);
+    }
+
+    void ColumnRow(Accumulators acc, std::size_t output, const float* row,
+                   unsigned int size, std::size_t) const
+    {
+        Kernels.ColumnDeviation(acc[0], acc[1], row, Center + output, size);
+    }
+};
+
+template <bool IsMax>
+struct ExtremumOp
+{
+    using Partial = float;
+    static constexpr std::size_t Arrays = 1;
+    static constexpr std::size_t MaxRows = Unlimited;
+    static constexpr float Initial = IsMax ? -Infinity : Infinity;
+
+    const ReduceKernels& Kernels;
+    float* Y;
+
+    static float Extremum(float a, float b)
+    {
+        if (std::isnan(a) || std::isnan(b))
+            return std::isnan(a) ? a : b;
+        return IsMax ? std::max(a, b) : std::min(a, b);
+    }
+
+    Partial Init(std::size_t, std::size_t) const
+    {
+        return Initial;
+    }
+
+    void Row(Partial& partial, std::size_t, const float* row,
+             unsigned int size, std::size_t) const
+    {
+        partial = Extremum(partial, IsMax ? Kernels.RowMax(row, size)
+                                          : Kernels.RowMin(row, size));
+    }
+
+    void ColumnInit(Accumulators acc, std::size_t, unsigned int size) const
+    {
+        std::fill(acc[0], acc[0] + size, Initial);
+    }
+
+    void ColumnRow(Accumulators acc, std::size_t, const float* row,
+                   unsigned int size, std::size_t) const
+    {
+        if (IsMax)
+            Kernels.ColumnMax(acc[0], row, size);
+        else
+            Kernels.ColumnMin(acc[0], row, size);
+    }
+
+    Partial Extract(Accumulators acc, unsigned int column, std::size_t) const
+    {
+        return acc[0][column];
+    }
+
+    void Combine(Partial& partial, Partial next) const
+    {
+        partial = Extremum(partial, next);
+    }
+
+    void Store(std::size_t output, Partial partial) const
+    {
+        Y[output] = partial;
+    }
+};
+
+struct ArgMaxOp
+{
+    struct Partial
+    {
+        float Value;
+        std::size_t Index;
+    };
+
+    static constexpr std::size_t Arrays = 2;
+    static constexpr std::size_t MaxRows = MaxArgMaxRows;
+
+    const ReduceKernels& Kernels;
+    std::int32_t* Y;
+
+    //! NaN is greater than any number, and equal values are not greater, so
+    //! earlier index is kept
+    static bool IsGreater(float a, float b)
+    {
+        return a > b || (std::isnan(a) && !std::isnan(b));
+    }
+
+    Partial Init(std::size_t, std::size_t begin) const
+    {
+        return { -Infinity, begin };
+    }
+
+    void Row(Partial& partial, std::size_t, const float* row,
+             unsigned int size, std::size_t index) const
+    {
+        const auto max = Kernels.RowMax(row, size);
+        if (!IsGreater(max, partial.Value))
+            return;
+
+        unsigned int i = 0;
+        if (std::isnan(max))
+            while (!std::isnan(row[i]))
+                ++i;
+        else
+            while (row[i] != max)
+                ++i;
+        partial = { max, index + i };
+    }
+
+    void ColumnInit(Accumulators acc, std::size_t, unsigned int size) const
+    {
+        std::fill(acc[0], acc[0] + size, -Infinity);
+        std::fill(acc[1], acc[1] + size, 0.0f);
+    }
+
+    void ColumnRow(Accumulators acc, std::size_t, const float* row,
+                   unsigned int size, std::size_t rowIdx) const
+    {
+        Kernels.ColumnArgMax(acc[0], acc[1], row,
+                             static_cast<float>(rowIdx), size);
+    }
+
+    Partial Extract(Accumulators acc, unsigned int column,
+                    std::size_t begin) const
+    {
+        return { acc[0][column],
+                 begin + static_cast<std::size_t>(acc[1][column]) };
+    }
+
+    void Combine(Partial& partial, const Partial& next) const
+    {
+        if (IsGreater(next.Value, partial.Value))
+            partial = next;
+    }
+
+    void Store(std::size_t output, const Partial& partial) const
+    {
+        Y[output] = static_cast<std::int32_t>(partial.Index);
+    }
+};
+
+const ReduceKernels& GetReduceKernels()
+{
+    return *GetHostKernels().Reduce;
+}
+} // namespace
+
+ReduceLayout MakeReduceLayout(const std::vector<int>& shape,
+                              const std::vector<bool>& reduced)
+{
+    //! Merged dimensions, outermost first
+    std::vector<std::size_t> extents;
+    std::vector<bool> kinds;
+    for (std::size_t dim = 0; dim < shape.size(); ++dim)
+    {
+        if (shape[dim] == 1)
+            continue;
+        const auto extent = static_cast<std::size_t>(shape[dim]);
+        if (!kinds.empty() && kinds.back() == reduced[dim])
+        {
+            extents.back() *= extent;
+            continue;
+        }
+        extents.emplace_back(extent);
+        kinds.emplace_back(reduced[dim]);
+    }
+
+    ReduceLayout layout;
+    if (extents.empty())
+        return layout;
+
+    layout.InnerExtent = extents.back();
+    layout.InnerReduced = kinds.back();
+    auto stride = layout.InnerExtent;
+    for (auto dim = extents.size() - 1; dim-- > 0;)
+    {
+        if (kinds[dim])
+        {
+            layout.ReducedExtents.emplace_back(extents[dim]);
+            layout.ReducedStrides.emplace_back(stride);
+        }
+        else
+        {
+            layout.KeptExtents.emplace_back(extents[dim]);
+            layout.KeptStrides.emplace_back(stride);
+        }
+        stride *= extents[dim];
+    }
+    std::reverse(layout.KeptExtents.begin(), layout.KeptExtents.end());
+    std::reverse(layout.KeptStrides.begin(), layout.KeptStrides.end());
+    std::reverse(layout.ReducedExtents.begin(), layout.ReducedExtents.end());
+    std::reverse(layout.ReducedStrides.begin(), layout.ReducedStrides.end());
+
+    layout.OutputSize = Product(layout.KeptExtents);
+    layout.ReduceSize = Product(layout.ReducedExtents);
+    if (layout.InnerReduced)
+        layout.ReduceSize *= layout.InnerExtent;
+    else
+        layout.OutputSize *= layout.InnerExtent;
+    return layout;
+}
+
+void Sum(float* y, const float* x, const ReduceLayout& layout)
+{
+    Reduce(x, layout, SumOp{ GetReduceKernels(), y, 1.0 });
+}
+
+void Mean(float* y, const float* x, const ReduceLayout& layout)
+{
+    Reduce(x, layout,
+           SumOp{ GetReduceKernels(), y,
+                  static_cast<double>(layout.ReduceSize) });
+}
+
+void Max(float* y, const float* x, const ReduceLayout& layout)
+{
+    Reduce(x, layout, ExtremumOp<true>{ GetReduceKernels(), y });
+}
+
+void Min(float* y, const float* x, const ReduceLayout& layout)
+{
+    Reduce(x, layout, ExtremumOp<false>{ GetReduceKernels(), y });
+}
+
+void ArgMax(std::int32_t* y, const float* x, const ReduceLayout& layout)
+{
+    Reduce(x, layout, ArgMaxOp{ GetReduceKernels(), y });
+}
+
+//! Deviations are summed around the mean in second pass, which does not
+//! lose precision when the mean is large compared to the deviation
+void Variance(float* y, const float* x, const ReduceLayout& layout,
+              unsigned int correction)
+{
+    std::vector<float> mean(layout.OutputSize);
+    Mean(mean.data(), x, layout);
+
+    const auto divisor =
+        layout.ReduceSize > correction
+            ? static_cast<double>(layout.ReduceSize - correction)
+            : std::numeric_limits<double>::quiet_NaN();
+    Reduce(x, layout,
+           DeviationOp{ { GetReduceKernels(), y, divisor }, mean.data() });
+}
+
+void MeanBackward(float* dx, const float* dy, const ReduceLayout& layout)
+{
+    if (layout.OutputSize == 0 || layout.ReduceSize == 0)
+        return;
+
+    const auto& kernels = GetHostKernels();
+    const auto outputs = layout.OutputSize;
+    const auto innerSize = static_cast<unsigned int>(layout.InnerExtent);
+    //! Divided rather than multiplied by reciprocal, which rounds as the
+    //! cuda implementation does
+    const auto reduceSize = static_cast<float>(layout.ReduceSize);
+    std::vector<float> scaled(outputs);
+    for (std::size_t i = 0; i < outputs; ++i)
+        scaled[i] = dy[i] / reduceSize;
+
+    //! Every task updates its own row of dx
+    if (layout.InnerReduced)
+    {
+        const auto rows = layout.ReduceSize / layout.InnerExtent;
+        ParallelFor(outputs * rows, outputs * layout.ReduceSize,
+                    [&](std::size_t task)
+                    {
+                        const auto output = task / rows;
+                        auto* row = dx + Offset(layout.KeptExtents,
+                                                layout.KeptStrides, output) +
+                                    Offset(layout.ReducedExtents,
+                                           layout.ReducedStrides,
+                                           task % rows);
+                        kernels.AddScalar(row, row, scaled[output],
+                                          innerSize);
+                    });
+    }
+    else
+    {
+        const auto rows = layout.ReduceSize;
+        const auto groups = outputs / layout.InnerExtent;
+        ParallelFor(groups * rows, outputs * rows,
+                    [&](std::size_t task)
+                    {
+                        const auto group = task / rows;
+                        auto* row = dx + Offset(layout.KeptExtents,
+                                                layout.KeptStrides, group) +
+                                    Offset(layout.ReducedExtents,
+                                           layout.ReducedStrides,
+                                           task % rows);
+                        kernels.Add(row, row,
+                                    scaled.data() + group * layout.InnerExtent,
+                                    innerSize);
+                    });
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,140 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/PackedOperandCache.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+unsigned int RoundUp(unsigned int value, unsigned int multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+std::mutex& CacheMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+//! Operand used both as it is and transposed (e.g. weight in forward and
+//! backward pass) is cached in both layouts, indexed by transB
+using CacheEntry = std::array<std::shared_ptr<const PackedOperand>, 2>;
+
+std::unordered_map<const float*, CacheEntry>& Cache()
+{
+    static std::unordered_map<const float*, CacheEntry> cache;
+    return cache;
+}
+
+//! Number of entries in the cache, read without the lock by invalidation
+std::atomic<std::size_t>& CacheSize()
+{
+    static std::atomic<std::size_t> size{ 0 };
+    return size;
+}
+
+std::shared_ptr<const PackedOperand> Pack(const GemmKernelInfo& kernel,
+                                          InstructionSet isa, const float* B,
+                                          unsigned int K, unsigned int N,
+                                          bool transB)
+{
+    const unsigned int rowStride = transB ? 1 : N;
+    const unsigned int colStride = transB ? K : 1;
+
+    auto packed = std::make_shared<PackedOperand>();
+    packed->Isa = isa;
+    packed->KC = kernel.KC;
+    packed->NC = kernel.NC;
+    packed->K = K;
+    packed->N = N;
+    packed->Transposed = transB;
+    packed->Data.resize(static_cast<std::size_t>(K) * (N / kernel.NC) *
+                        kernel.NC +
+                        static_cast<std::size_t>(K) *
+                        RoundUp(N % kernel.NC, kernel.NR));
+
+    for (unsigned int jc = 0; jc < N; jc += kernel.NC)
+    {
+        const auto nc = std::min(kernel.NC, N - jc);
+        for (unsigned int pc = 0; pc < K; pc += kernel.KC)
+        {
+            const auto kc = std::min(kernel.KC, K - pc);
+            PackB(packed->Data.data() + static_cast<std::size_t>(jc) * K +
+                  static_cast<std::size_t>(pc) * RoundUp(nc, kernel.NR),
+                  B + static_cast<std::size_t>(pc) * rowStride +
+                  static_cast<std::size_t>(jc) * colStride,
+                  rowStride, colStride, kc, nc, kernel.NR);
+        }
+    }
+    return packed;
+}
+} // namespace
+
+const float* PackedOperand::Sliver(const GemmKernelInfo& kernel,
+                                   unsigned int pc, unsigned int col) const
+{
+    //! Every panel but the last one is NC wide
+    const auto jc = col / kernel.NC * kernel.NC;
+    const auto kc = std::min(kernel.KC, K - pc);
+    const auto panelCols = RoundUp(std::min(kernel.NC, N - jc), kernel.NR);
+    return Data.data() + static_cast<std::size_t>(jc) * K +
+           static_cast<std::size_t>(pc) * panelCols +
+           static_cast<std::size_t>(col - jc) * kc;
+}
+
+std::shared_ptr<const PackedOperand> GetPackedOperand(
+    const GemmKernelInfo& kernel, InstructionSet isa, const float* B,
+    unsigned int K, unsigned int N, bool transB)
+{
+    std::lock_guard<std::mutex> lock(CacheMutex());
+    auto& packed = Cache()[B][transB ? 1 : 0];
+    if (!packed || packed->Isa != isa || packed->KC != kernel.KC ||
+        packed->NC != kernel.NC || packed->K != K || packed->N != N)
+        packed = Pack(kernel, isa, B, K, N, transB);
+    CacheSize() = Cache().size();
+    return packed;
+}
+
+void InvalidatePackedOperand(const void* data, std::size_t byteSize)
+{
+    if (CacheSize() == 0)
+        return;
+
+    const auto begin = reinterpret_cast<std::uintptr_t>(data);
+    const auto end = begin + byteSize;
+    std::lock_guard<std::mutex> lock(CacheMutex());
+    auto& cache = Cache();
+    for (auto itr = cache.begin(); itr != cache.end();)
+    {
+        //! Both layouts are packed from the same K * N elements
+        std::size_t size = 0;
+        for (const auto& packed : itr->second)
+            if (packed)
+                size = static_cast<std::size_t>(packed->K) * packed->N;
+        const auto first = reinterpret_cast<std::uintptr_t>(itr->first);
+        if (first < end && begin < first + size * sizeof(float))
+            itr = cache.erase(itr);
+        else
+            ++itr;
+    }
+    CacheSize() = cache.size();
+}
+
+void ClearPackedOperands()
+{
+    std::lock_guard<std::mutex> lock(CacheMutex());
+    Cache().clear();
+    CacheSize() = 0;
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,265 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2 and FMA flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx2.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/ElementwiseKernel.hpp>
+#include <cstddef>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+namespace
+{
+//! Transposes 8 x 8 block in registers
+void Transpose8x8(float* out, std::size_t outStride, const float* in,
+                  std::size_t inStride)
+{
+    __m256 r[8], t[8];
+    for (unsigned int k = 0; k < 8; ++k)
+        r[k] = _mm256_loadu_ps(in + k * inStride);
+
+    //! Interleaves pairs of rows, then pairs of pairs within 128 bit lanes
+    for (unsigned int k = 0; k < 8; k += 2)
+    {
+        t[k] = _mm256_unpacklo_ps(r[k], r[k + 1]);
+        t[k + 1] = _mm256_unpackhi_ps(r[k], r[k + 1]);
+    }
+    for (unsigned int k = 0; k < 8; k += 4)
+    {
+        r[k] = _mm256_shuffle_ps(t[k], t[k + 2], 0x44);
+        r[k + 1] = _mm256_shuffle_ps(t[k], t[k + 2], 0xee);
+        r[k + 2] = _mm256_shuffle_ps(t[k + 1], t[k + 3], 0x44);
+        r[k + 3] = _mm256_shuffle_ps(t[k + 1], t[k + 3], 0xee);
+    }
+
+    //! Lower lanes come from rows 0-3, and upper lanes from rows 4-7
+    for (unsigned int k = 0; k < 4; ++k)
+    {
+        _mm256_storeu_ps(out + k * outStride,
+                         _mm256_permute2f128_ps(r[k], r[k + 4], 0x20));
+        _mm256_storeu_ps(out + (k + 4) * outStride,
+                         _mm256_permute2f128_ps(r[k], r[k + 4], 0x31));
+    }
+}
+} // namespace
+
+void Add(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i),
+                                                _mm256_loadu_ps(b + i)));
+    for (; i < size; ++i)
+        out[i] = a[i] + b[i];
+}
+
+void Sub(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(a + i),
+                                                _mm256_loadu_ps(b + i)));
+    for (; i < size; ++i)
+        out[i] = a[i] - b[i];
+}
+
+void Dot(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i),
+                                                _mm256_loadu_ps(b + i)));
+    for (; i < size; ++i)
+        out[i] = a[i] * b[i];
+}
+
+void Scale(float* out, const float* in, float factor, unsigned int size)
+{
+    const __m256 f = _mm256_set1_ps(factor);
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(in + i), f));
+    for (; i < size; ++i)
+        out[i] = in[i] * factor;
+}
+
+void MulAdd(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i),
+                                                  _mm256_loadu_ps(b + i),
+                                                  _mm256_loadu_ps(out + i)));
+    for (; i < size; ++i)
+        out[i] += a[i] * b[i];
+}
+
+void AddScalar(float* out, const float* in, float scalar, unsigned int size)
+{
+    const __m256 s = _mm256_set1_ps(scalar);
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(in + i), s));
+    for (; i < size; ++i)
+        out[i] = in[i] + scalar;
+}
+
+void SubScalar(float* out, const float* in, float scalar, unsigned int size)
+{
+    const __m256 s = _mm256_set1_ps(scalar);
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(in + i), s));
+    for (; i < size; ++i)
+        out[i] = in[i] - scalar;
+}
+
+void ScalarSub(float* out, const float* in, float scalar, unsigned int size)
+{
+    const __m256 s = _mm256_set1_ps(scalar);
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(s, _mm256_loadu_ps(in + i)));
+    for (; i < size; ++i)
+        out[i] = scalar - in[i];
+}
+
+void Inverse(float* out, const float* in, unsigned int size)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_div_ps(one, _mm256_loadu_ps(in + i)));
+    for (; i < size; ++i)
+        out[i] = 1.0f / in[i];
+}
+
+void ReLU(float* out, const float* in, unsigned int size)
+{
+    //! vmaxps returns the second operand if any of them is NaN
+    const __m256 zero = _mm256_setzero_ps();
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_max_ps(_mm256_loadu_ps(in + i), zero));
+    for (; i < size; ++i)
+        out[i] = in[i] > 0.0f ? in[i] : 0.0f;
+}
+
+void LeakyReLU(float* out, const float* in, float a, unsigned int size)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 slope = _mm256_set1_ps(a);
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(in + i);
+        _mm256_storeu_ps(out + i,
+                         _mm256_blendv_ps(_mm256_mul_ps(x, slope), x,
+                                          _mm256_cmp_ps(x, zero,
+                                                        _CMP_GT_OQ)));
+    }
+    for (; i < size; ++i)
+        out[i] = in[i] > 0.0f ? in[i] : a * in[i];
+}
+
+void ReLUBackward(float* dx, const float* dy, const float* x,
+                  unsigned int size)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(dx + i,
+                         _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(x + i),
+                                                     zero, _CMP_GT_OQ),
+                                       _mm256_loadu_ps(dy + i)));
+    for (; i < size; ++i)
+        dx[i] = x[i] > 0.0f ? dy[i] : 0.0f;
+}
+
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
+                       unsigned int size)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 slope = _mm256_set1_ps(a);
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 grad = _mm256_loadu_ps(dy + i);
+        _mm256_storeu_ps(dx + i,
+                         _mm256_blendv_ps(_mm256_mul_ps(grad, slope), grad,
+                                          _mm256_cmp_ps(_mm256_loadu_ps(x + i),
+                                                        zero, _CMP_GT_OQ)));
+    }
+    for (; i < size; ++i)
+        dx[i] = x[i] > 0.0f ? dy[i] : a * dy[i];
+}
+
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 in = _mm256_loadu_ps(x + i);
+        _mm256_storeu_ps(dx + i,
+                         _mm256_sub_ps(_mm256_loadu_ps(dx + i),
+                                       _mm256_div_ps(_mm256_loadu_ps(dy + i),
+                                                     _mm256_mul_ps(in, in))));
+    }
+    for (; i < size; ++i)
+        dx[i] -= dy[i] / (x[i] * x[i]);
+}
+
+void Gather(float* dst, const float* src, unsigned int count,
+            unsigned int srcStride)
+{
+    unsigned int i = 0;
+    if (srcStride == 1)
+    {
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_loadu_ps(src + i));
+    }
+    else if (static_cast<std::size_t>(srcStride) * 8 <= 0x7fffffff)
+    {
+        const auto s = static_cast<int>(srcStride);
+        const __m256i index =
+            _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(
+                dst + i,
+                _mm256_i32gather_ps(src + static_cast<std::size_t>(i) *
+                                    srcStride, index, 4));
+    }
+    for (; i < count; ++i)
+        dst[i] = src[static_cast<std::size_t>(i) * srcStride];
+}
+
+void Transpose(float* out, const float* in, unsigned int rows,
+               unsigned int cols, unsigned int inStride,
+               unsigned int outStride)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= rows; i += 8)
+    {
+        const float* src = in + static_cast<std::size_t>(i) * inStride;
+        unsigned int j = 0;
+        for (; j + 8 <= cols; j += 8)
+            Transpose8x8(out + static_cast<std::size_t>(j) * outStride + i,
+                         outStride, src + j, inStride);
+        for (; j < cols; ++j)
+            for (unsigned int k = 0; k < 8; ++k)
+                out[static_cast<std::size_t>(j) * outStride + i + k] =
+                    src[static_cast<std::size_t>(k) * inStride + j];
+    }
+    for (; i < rows; ++i)
+        for (unsigned int j = 0; j < cols; ++j)
+            out[static_cast<std::size_t>(j) * outStride + i] =
+                in[static_cast<std::size_t>(i) * inStride + j];
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
@@ -0,0 +1,328 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx512.cpp)
+//! Tails are handled with masked loads and stores
+
+#include <Sapphire/compute/dense/naive/kernels/ElementwiseKernel.hpp>
+#include <cstddef>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+namespace
+{
+//! Returns mask of min(remaining, 16) lanes
+__mmask16 TailMask(unsigned int remaining)
+{
+    return remaining >= 16 ? static_cast<__mmask16>(0xffff)
+                           : static_cast<__mmask16>((1u << remaining) - 1u);
+}
+
+//! Transposes 16 x 16 block in registers, where only first numRows rows
+//! and numCols columns of in are read, and only first numCols rows and
+//! numRows columns of out are written
+void Transpose16x16(float* out, std::size_t outStride, const float* in,
+                    std::size_t inStride, unsigned int numRows,
+                    unsigned int numCols)
+{
+    //! Shuffles are written in maskz_ forms with every lane set, since
+    //! unmasked forms pass undefined source operand that is reported as
+    //! uninitialized by some compilers
+    constexpr __mmask16 all = 0xffff;
+    const auto loadMask = TailMask(numCols);
+    const auto storeMask = TailMask(numRows);
+    __m512 r[16], t[16];
+    for (unsigned int k = 0; k < 16; ++k)
+        r[k] = k < numRows ? _mm512_maskz_loadu_ps(loadMask, in + k * inStride)
+                           : _mm512_setzero_ps();
+
+    //! Interleaves pairs of rows, then pairs of pairs within 128 bit lanes
+    for (unsigned int k = 0; k < 16; k += 2)
+    {
+        t[k] = _mm512_maskz_unpacklo_ps(all, r[k], r[k + 1]);
+        t[k + 1] = _mm512_maskz_unpackhi_ps(all, r[k], r[k + 1]);
+    }
+    for (unsigned int k = 0; k < 16; k += 4)
+    {
+        r[k] = _mm512_maskz_shuffle_ps(all, t[k], t[k + 2], 0x44);
+        r[k + 1] = _mm512_maskz_shuffle_ps(all, t[k], t[k + 2], 0xee);
+        r[k + 2] = _mm512_maskz_shuffle_ps(all, t[k + 1], t[k + 3], 0x44);
+        r[k + 3] = _mm512_maskz_shuffle_ps(all, t[k + 1], t[k + 3], 0xee);
+    }
+
+    //! Register k now holds 4 x 4 blocks of rows (4 * lane) to
+    //! (4 * lane + 3), which are gathered across 128 bit lanes
+    for (unsigned int k = 0; k < 4; ++k)
+    {
+        t[k] = _mm512_maskz_shuffle_f32x4(all, r[k], r[k + 4], 0x88);
+        t[k + 4] = _mm512_maskz_shuffle_f32x4(all, r[k], r[k + 4], 0xdd);
+        t[k + 8] = _mm512_maskz_shuffle_f32x4(all, r[k + 8], r[k + 12], 0x88);
+        t[k + 12] = _mm512_maskz_shuffle_f32x4(all, r[k + 8], r[k + 12], 0xdd);
+    }
+    for (unsigned int k = 0; k < 8; ++k)
+    {
+        r[k] = _mm512_maskz_shuffle_f32x4(all, t[k], t[k + 8], 0x88);
+        r[k + 8] = _mm512_maskz_shuffle_f32x4(all, t[k], t[k + 8], 0xdd);
+    }
+
+    for (unsigned int k = 0; k < numCols; ++k)
+        _mm512_mask_storeu_ps(out + k * outStride, storeMask, r[k]);
+}
+} // namespace
+
+void Add(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_loadu_ps(a + i),
+                                                _mm512_loadu_ps(b + i)));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(out + i, mask,
+                              _mm512_add_ps(_mm512_maskz_loadu_ps(mask, a + i),
+                                            _mm512_maskz_loadu_ps(mask, b + i)));
+    }
+}
+
+void Sub(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(out + i, _mm512_sub_ps(_mm512_loadu_ps(a + i),
+                                                _mm512_loadu_ps(b + i)));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(out + i, mask,
+                              _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, a + i),
+                                            _mm512_maskz_loadu_ps(mask, b + i)));
+    }
+}
+
+void Dot(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_loadu_ps(a + i),
+                                                _mm512_loadu_ps(b + i)));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(out + i, mask,
+                              _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, a + i),
+                                            _mm512_maskz_loadu_ps(mask, b + i)));
+    }
+}
+
+void Scale(float* out, const float* in, float factor, unsigned int size)
+{
+    const __m512 f = _mm512_set1_ps(factor);
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_loadu_ps(in + i), f));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(out + i, mask,
+                              _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, in + i),
+                                            f));
+    }
+}
+
+void MulAdd(float* out, const float* a, const float* b, unsigned int size)
+{
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(
+            out + i, mask,
+            _mm512_maskz_fmadd_ps(mask, _mm512_maskz_loadu_ps(mask, a + i),
+                                  _mm512_maskz_loadu_ps(mask, b + i),
+                                  _mm512_maskz_loadu_ps(mask, out + i)));
+    }
+}
+
+void AddScalar(float* out, const float* in, float scalar, unsigned int size)
+{
+    const __m512 s = _mm512_set1_ps(scalar);
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(
+            out + i, mask,
+            _mm512_maskz_add_ps(mask, _mm512_maskz_loadu_ps(mask, in + i), s));
+    }
+}
+
+void SubScalar(float* out, const float* in, float scalar, unsigned int size)
+{
+    const __m512 s = _mm512_set1_ps(scalar);
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(
+            out + i, mask,
+            _mm512_maskz_sub_ps(mask, _mm512_maskz_loadu_ps(mask, in + i), s));
+    }
+}
+
+void ScalarSub(float* out, const float* in, float scalar, unsigned int size)
+{
+    const __m512 s = _mm512_set1_ps(scalar);
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(
+            out + i, mask,
+            _mm512_maskz_sub_ps(mask, s, _mm512_maskz_loadu_ps(mask, in + i)));
+    }
+}
+
+void Inverse(float* out, const float* in, unsigned int size)
+{
+    const __m512 one = _mm512_set1_ps(1.0f);
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(
+            out + i, mask,
+            _mm512_maskz_div_ps(mask, one,
+                                _mm512_maskz_loadu_ps(mask, in + i)));
+    }
+}
+
+void ReLU(float* out, const float* in, unsigned int size)
+{
+    //! vmaxps returns the second operand if any of them is NaN
+    const __m512 zero = _mm512_setzero_ps();
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(
+            out + i, mask,
+            _mm512_maskz_max_ps(mask, _mm512_maskz_loadu_ps(mask, in + i),
+                                zero));
+    }
+}
+
+void LeakyReLU(float* out, const float* in, float a, unsigned int size)
+{
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 slope = _mm512_set1_ps(a);
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        const __m512 x = _mm512_maskz_loadu_ps(mask, in + i);
+        const auto positive =
+            _mm512_mask_cmp_ps_mask(mask, x, zero, _CMP_GT_OQ);
+        _mm512_mask_storeu_ps(
+            out + i, mask,
+            _mm512_mask_blend_ps(positive,
+                                 _mm512_maskz_mul_ps(mask, x, slope), x));
+    }
+}
+
+void ReLUBackward(float* dx, const float* dy, const float* x,
+                  unsigned int size)
+{
+    const __m512 zero = _mm512_setzero_ps();
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        const auto positive = _mm512_mask_cmp_ps_mask(
+            mask, _mm512_maskz_loadu_ps(mask, x + i), zero, _CMP_GT_OQ);
+        _mm512_mask_storeu_ps(dx + i, mask,
+                              _mm512_maskz_loadu_ps(positive, dy + i));
+    }
+}
+
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
+                       unsigned int size)
+{
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 slope = _mm512_set1_ps(a);
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        const __m512 grad = _mm512_maskz_loadu_ps(mask, dy + i);
+        const auto positive = _mm512_mask_cmp_ps_mask(
+            mask, _mm512_maskz_loadu_ps(mask, x + i), zero, _CMP_GT_OQ);
+        _mm512_mask_storeu_ps(
+            dx + i, mask,
+            _mm512_mask_blend_ps(
+                positive, _mm512_maskz_mul_ps(mask, grad, slope), grad));
+    }
+}
+
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int size)
+{
+    for (unsigned int i = 0; i < size; i += 16)
+    {
+        const auto mask = TailMask(size - i);
+        const __m512 in = _mm512_maskz_loadu_ps(mask, x + i);
+        const __m512 grad = _mm512_maskz_div_ps(
+            mask, _mm512_maskz_loadu_ps(mask, dy + i),
+            _mm512_maskz_mul_ps(mask, in, in));
+        _mm512_mask_storeu_ps(
+            dx + i, mask,
+            _mm512_maskz_sub_ps(mask, _mm512_maskz_loadu_ps(mask, dx + i),
+                                grad));
+    }
+}
+
+void Gather(float* dst, const float* src, unsigned int count,
+            unsigned int srcStride)
+{
+    unsigned int i = 0;
+    if (srcStride == 1)
+    {
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_ps(dst + i, _mm512_loadu_ps(src + i));
+        if (i < count)
+        {
+            const auto mask = TailMask(count - i);
+            _mm512_mask_storeu_ps(dst + i, mask,
+                                  _mm512_maskz_loadu_ps(mask, src + i));
+        }
+        return;
+    }
+
+    if (static_cast<std::size_t>(srcStride) * 16 <= 0x7fffffff)
+    {
+        const __m512i index = _mm512_mullo_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+                              15),
+            _mm512_set1_epi32(static_cast<int>(srcStride)));
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_ps(
+                dst + i,
+                _mm512_mask_i32gather_ps(
+                    _mm512_setzero_ps(), 0xffff, index,
+                    src + static_cast<std::size_t>(i) * srcStride, 4));
+    }
+    for (; i < count; ++i)
+        dst[i] = src[static_cast<std::size_t>(i) * srcStride];
+}
+
+void Transpose(float* out, const float* in, unsigned int rows,
+               unsigned int cols, unsigned int inStride,
+               unsigned int outStride)
+{
+    //! Blocks on the edges are transposed with masked loads and stores
+    for (unsigned int i = 0; i < rows; i += 16)
+        for (unsigned int j = 0; j < cols; j += 16)
+            Transpose16x16(out + static_cast<std::size_t>(j) * outStride + i,
+                           outStride,
+                           in + static_cast<std::size_t>(i) * inStride + j,
+                           inStride, rows - i < 16 ? rows - i : 16,
+                           cols - j < 16 ? cols - j : 16);
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
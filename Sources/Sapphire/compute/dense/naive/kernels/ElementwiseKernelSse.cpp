@@ -0,0 +1,259 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+
+#include <Sapphire/compute/dense/naive/kernels/ElementwiseKernel.hpp>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+void Add(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i,
+                      _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#endif
+    for (; i < size; ++i)
+        out[i] = a[i] + b[i];
+}
+
+void Sub(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i,
+                      _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#endif
+    for (; i < size; ++i)
+        out[i] = a[i] - b[i];
+}
+
+void Dot(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i,
+                      _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#endif
+    for (; i < size; ++i)
+        out[i] = a[i] * b[i];
+}
+
+void Scale(float* out, const float* in, float factor, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 f = _mm_set1_ps(factor);
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(in + i), f));
+#endif
+    for (; i < size; ++i)
+        out[i] = in[i] * factor;
+}
+
+void MulAdd(float* out, const float* a, const float* b, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i,
+                      _mm_add_ps(_mm_loadu_ps(out + i),
+                                 _mm_mul_ps(_mm_loadu_ps(a + i),
+                                            _mm_loadu_ps(b + i))));
+#endif
+    for (; i < size; ++i)
+        out[i] += a[i] * b[i];
+}
+
+void AddScalar(float* out, const float* in, float scalar, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 s = _mm_set1_ps(scalar);
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(in + i), s));
+#endif
+    for (; i < size; ++i)
+        out[i] = in[i] + scalar;
+}
+
+void SubScalar(float* out, const float* in, float scalar, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 s = _mm_set1_ps(scalar);
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(in + i), s));
+#endif
+    for (; i < size; ++i)
+        out[i] = in[i] - scalar;
+}
+
+void ScalarSub(float* out, const float* in, float scalar, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 s = _mm_set1_ps(scalar);
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i, _mm_sub_ps(s, _mm_loadu_ps(in + i)));
+#endif
+    for (; i < size; ++i)
+        out[i] = scalar - in[i];
+}
+
+void Inverse(float* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i, _mm_div_ps(one, _mm_loadu_ps(in + i)));
+#endif
+    for (; i < size; ++i)
+        out[i] = 1.0f / in[i];
+}
+
+void ReLU(float* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    //! maxps returns the second operand if any of them is NaN, so NaN becomes
+    //! zero as well
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(out + i, _mm_max_ps(_mm_loadu_ps(in + i), zero));
+#endif
+    for (; i < size; ++i)
+        out[i] = in[i] > 0.0f ? in[i] : 0.0f;
+}
+
+void LeakyReLU(float* out, const float* in, float a, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 slope = _mm_set1_ps(a);
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(in + i);
+        const __m128 positive = _mm_cmpgt_ps(x, zero);
+        _mm_storeu_ps(out + i,
+                      _mm_or_ps(_mm_and_ps(positive, x),
+                                _mm_andnot_ps(positive,
+                                              _mm_mul_ps(x, slope))));
+    }
+#endif
+    for (; i < size; ++i)
+        out[i] = in[i] > 0.0f ? in[i] : a * in[i];
+}
+
+void ReLUBackward(float* dx, const float* dy, const float* x,
+                  unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(dx + i,
+                      _mm_and_ps(_mm_cmpgt_ps(_mm_loadu_ps(x + i), zero),
+                                 _mm_loadu_ps(dy + i)));
+#endif
+    for (; i < size; ++i)
+        dx[i] = x[i] > 0.0f ? dy[i] : 0.0f;
+}
+
+void LeakyReLUBackward(float* dx, const float* dy, const float* x, float a,
+                       unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 slope = _mm_set1_ps(a);
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 grad = _mm_loadu_ps(dy + i);
+        const __m128 positive = _mm_cmpgt_ps(_mm_loadu_ps(x + i), zero);
+        _mm_storeu_ps(dx + i,
+                      _mm_or_ps(_mm_and_ps(positive, grad),
+                                _mm_andnot_ps(positive,
+                                              _mm_mul_ps(grad, slope))));
+    }
+#endif
+    for (; i < size; ++i)
+        dx[i] = x[i] > 0.0f ? dy[i] : a * dy[i];
+}
+
+void InverseBackward(float* dx, const float* dy, const float* x,
+                     unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 in = _mm_loadu_ps(x + i);
+        _mm_storeu_ps(dx + i,
+                      _mm_sub_ps(_mm_loadu_ps(dx + i),
+                                 _mm_div_ps(_mm_loadu_ps(dy + i),
+                                            _mm_mul_ps(in, in))));
+    }
+#endif
+    for (; i < size; ++i)
+        dx[i] -= dy[i] / (x[i] * x[i]);
+}
+
+void Gather(float* dst, const float* src, unsigned int count,
+            unsigned int srcStride)
+{
+    for (unsigned int i = 0; i < count; ++i)
+        dst[i] = src[static_cast<std::size_t>(i) * srcStride];
+}
+
+void Transpose(float* out, const float* in, unsigned int rows,
+               unsigned int cols, unsigned int inStride,
+               unsigned int outStride)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    for (; i + 4 <= rows; i += 4)
+    {
+        const float* src = in + static_cast<std::size_t>(i) * inStride;
+        unsigned int j = 0;
+        for (; j + 4 <= cols; j += 4)
+        {
+            __m128 r0 = _mm_loadu_ps(src + j);
+            __m128 r1 = _mm_loadu_ps(src + inStride + j);
+            __m128 r2 = _mm_loadu_ps(src + 2 * inStride + j);
+            __m128 r3 = _mm_loadu_ps(src + 3 * inStride + j);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+            float* dst = out + static_cast<std::size_t>(j) * outStride + i;
+            _mm_storeu_ps(dst, r0);
+            _mm_storeu_ps(dst + outStride, r1);
+            _mm_storeu_ps(dst + 2 * outStride, r2);
+            _mm_storeu_ps(dst + 3 * outStride, r3);
+        }
+        for (; j < cols; ++j)
+            for (unsigned int k = 0; k < 4; ++k)
+                out[static_cast<std::size_t>(j) * outStride + i + k] =
+                    src[static_cast<std::size_t>(k) * inStride + j];
+    }
+#endif
+    for (; i < rows; ++i)
+        for (unsigned int j = 0; j < cols; ++j)
+            out[static_cast<std::size_t>(j) * outStride + i] =
+                in[static_cast<std::size_t>(i) * inStride + j];
+}
+} // namespace Sapphire::Compute::Dense::Naive::Sse
@@ -0,0 +1,190 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/kernels/GemmKernel.hpp>
+#include <Sapphire/compute/dense/naive/kernels/SmallGemmKernel.hpp>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+void PackA(float* packedA, const float* A, unsigned int rowStride,
+           unsigned int colStride, unsigned int mc, unsigned int kc,
+           unsigned int mr)
+{
+    for (unsigned int rowIdx = 0; rowIdx < mc; rowIdx += mr)
+    {
+        const auto rows = mc - rowIdx < mr ? mc - rowIdx : mr;
+        const float* src = A + static_cast<std::size_t>(rowIdx) * rowStride;
+
+        for (unsigned int kIdx = 0; kIdx < kc; ++kIdx)
+        {
+            const float* col = src + static_cast<std::size_t>(kIdx) * colStride;
+            if (rowStride == 1)
+            {
+                //! Transposed A has contiguous rows in each column
+                for (unsigned int i = 0; i < rows; ++i)
+                    packedA[i] = col[i];
+            }
+            else
+            {
+                for (unsigned int i = 0; i < rows; ++i)
+                    packedA[i] = col[static_cast<std::size_t>(i) * rowStride];
+            }
+            for (unsigned int i = rows; i < mr; ++i)
+                packedA[i] = 0.0f;
+            packedA += mr;
+        }
+    }
+}
+
+void PackB(float* packedB, const float* B, unsigned int rowStride,
+           unsigned int colStride, unsigned int kc, unsigned int nc,
+           unsigned int nr)
+{
+    for (unsigned int colIdx = 0; colIdx < nc; colIdx += nr)
+    {
+        const auto cols = nc - colIdx < nr ? nc - colIdx : nr;
+        const float* src = B + static_cast<std::size_t>(colIdx) * colStride;
+
+        for (unsigned int kIdx = 0; kIdx < kc; ++kIdx)
+        {
+            const float* row = src + static_cast<std::size_t>(kIdx) * rowStride;
+            if (colStride == 1)
+            {
+                for (unsigned int j = 0; j < cols; ++j)
+                    packedB[j] = row[j];
+            }
+            else
+            {
+                //! Transposed B is read with stride of its row length
+                for (unsigned int j = 0; j < cols; ++j)
+                    packedB[j] = row[static_cast<std::size_t>(j) * colStride];
+            }
+            for (unsigned int j = cols; j < nr; ++j)
+                packedB[j] = 0.0f;
+            packedB += nr;
+        }
+    }
+}
+
+void PackHalfB(float* packedB, const std::uint16_t* B, unsigned int rowStride,
+               unsigned int colStride, unsigned int kc, unsigned int nc,
+               unsigned int nr, HalfToFloatKernelFunc toFloat)
+{
+    //! Columns of transposed B are converted in pieces of this size
+    constexpr unsigned int pieceSize = 256;
+    float piece[pieceSize];
+
+    for (unsigned int colIdx = 0; colIdx < nc; colIdx += nr)
+    {
+        const auto cols = nc - colIdx < nr ? nc - colIdx : nr;
+        const std::uint16_t* src =
+            B + static_cast<std::size_t>(colIdx) * colStride;
+
+        if (colStride == 1)
+        {
+            for (unsigned int kIdx = 0; kIdx < kc; ++kIdx)
+            {
+                toFloat(packedB,
+                        src + static_cast<std::size_t>(kIdx) * rowStride,
+                        cols);
+                for (unsigned int j = cols; j < nr; ++j)
+                    packedB[j] = 0.0f;
+                packedB += nr;
+            }
+            continue;
+        }
+
+        //! Each column of transposed B is contiguous, so it is converted as
+        //! a whole and scattered into the rows of the sliver
+        for (unsigned int j = 0; j < nr; ++j)
+        {
+            const std::uint16_t* col =
+                src + static_cast<std::size_t>(j) * colStride;
+            for (unsigned int kIdx = 0; kIdx < kc; kIdx += pieceSize)
+            {
+                const auto count =
+                    kc - kIdx < pieceSize ? kc - kIdx : pieceSize;
+                if (j < cols)
+                    toFloat(piece, col + kIdx, count);
+                for (unsigned int k = 0; k < count; ++k)
+                    packedB[static_cast<std::size_t>(kIdx + k) * nr + j] =
+                        j < cols ? piece[k] : 0.0f;
+            }
+        }
+        packedB += static_cast<std::size_t>(kc) * nr;
+    }
+}
+
+void GemmMicroKernel(const GemmKernelInfo& kernel, unsigned int kc,
+                     const float* packedA, const float* packedB, float* C,
+                     unsigned int ldc, unsigned int mr, unsigned int nr,
+                     float alpha, float beta, const GemmEpilogue* epilogue)
+{
+    if (mr == kernel.MR && nr == kernel.NR)
+    {
+        kernel.MicroKernel(kc, packedA, packedB, C, ldc, alpha, beta,
+                           epilogue);
+        return;
+    }
+
+    //! Edge tiles are computed on temporary tile since packed slivers are
+    //! padded with zeros
+    float tile[GemmMaxTileSize];
+    kernel.MicroKernel(kc, packedA, packedB, tile, kernel.NR, alpha, 0.0f,
+                       nullptr);
+
+    for (unsigned int i = 0; i < mr; ++i)
+    {
+        float* row = C + static_cast<std::size_t>(i) * ldc;
+        const float* tileRow = tile + i * kernel.NR;
+        if (beta == 0.0f)
+        {
+            for (unsigned int j = 0; j < nr; ++j)
+                row[j] = tileRow[j];
+        }
+        else
+        {
+            for (unsigned int j = 0; j < nr; ++j)
+                row[j] = tileRow[j] + beta * row[j];
+        }
+
+        if (!epilogue)
+            continue;
+        //! Bias of padded columns is not read
+        for (unsigned int j = 0; j < nr; ++j)
+        {
+            auto value = row[j];
+            if (epilogue->Bias)
+                value += epilogue->Bias[j];
+            if (epilogue->Activation && value < 0.0f)
+                value *= epilogue->NegativeSlope;
+            row[j] = value;
+        }
+    }
+}
+
+//! Finds kernel by the position of each size in SmallGemmSizes
+SmallGemmKernelFunc FindSmallGemmKernel(const SmallGemmTable& table,
+                                        unsigned int M, unsigned int N,
+                                        unsigned int K)
+{
+    const auto indexOf = [](unsigned int size)
+    {
+        for (unsigned int i = 0; i < SmallGemmSizeCount; ++i)
+            if (SmallGemmSizes[i] == size)
+                return static_cast<int>(i);
+        return -1;
+    };
+
+    const int mIdx = indexOf(M), nIdx = indexOf(N), kIdx = indexOf(K);
+    if (mIdx < 0 || nIdx < 0 || kIdx < 0)
+        return nullptr;
+
+    constexpr auto count = static_cast<int>(SmallGemmSizeCount);
+    return table.Kernels[(mIdx * count + nIdx) * count + kIdx];
+}
+} // namespace Sapphire::Compute::Dense::Naive
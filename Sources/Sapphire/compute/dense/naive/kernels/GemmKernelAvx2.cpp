@@ -0,0 +1,106 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2 and FMA flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (e.g. standard containers), since linker may
+//! pick AVX2 version of them for the whole program
+
+#include <Sapphire/compute/dense/naive/kernels/GemmKernel.hpp>
+#include <cstddef>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+//! Accumulators are kept in registers during the whole kc loop
+void GemmMicroKernel(unsigned int kc, const float* packedA,
+                     const float* packedB, float* C, unsigned int ldc,
+                     float alpha, float beta, const GemmEpilogue* epilogue)
+{
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (unsigned int kIdx = 0; kIdx < kc; ++kIdx)
+    {
+        const __m256 b0 = _mm256_loadu_ps(packedB);
+        const __m256 b1 = _mm256_loadu_ps(packedB + 8);
+
+        __m256 a = _mm256_broadcast_ss(packedA);
+        c00 = _mm256_fmadd_ps(a, b0, c00);
+        c01 = _mm256_fmadd_ps(a, b1, c01);
+        a = _mm256_broadcast_ss(packedA + 1);
+        c10 = _mm256_fmadd_ps(a, b0, c10);
+        c11 = _mm256_fmadd_ps(a, b1, c11);
+        a = _mm256_broadcast_ss(packedA + 2);
+        c20 = _mm256_fmadd_ps(a, b0, c20);
+        c21 = _mm256_fmadd_ps(a, b1, c21);
+        a = _mm256_broadcast_ss(packedA + 3);
+        c30 = _mm256_fmadd_ps(a, b0, c30);
+        c31 = _mm256_fmadd_ps(a, b1, c31);
+        a = _mm256_broadcast_ss(packedA + 4);
+        c40 = _mm256_fmadd_ps(a, b0, c40);
+        c41 = _mm256_fmadd_ps(a, b1, c41);
+        a = _mm256_broadcast_ss(packedA + 5);
+        c50 = _mm256_fmadd_ps(a, b0, c50);
+        c51 = _mm256_fmadd_ps(a, b1, c51);
+
+        packedA += GemmMR;
+        packedB += GemmNR;
+    }
+
+    const __m256 alphaVec = _mm256_set1_ps(alpha);
+    const __m256 betaVec = _mm256_set1_ps(beta);
+    const bool readC = beta != 0.0f;
+
+    const bool addBias = epilogue && epilogue->Bias;
+    const bool activate = epilogue && epilogue->Activation;
+    const __m256 biasLo =
+        addBias ? _mm256_loadu_ps(epilogue->Bias) : _mm256_setzero_ps();
+    const __m256 biasHi =
+        addBias ? _mm256_loadu_ps(epilogue->Bias + 8) : _mm256_setzero_ps();
+    const __m256 slopeVec =
+        _mm256_set1_ps(activate ? epilogue->NegativeSlope : 0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+
+    const auto storeRow = [=](unsigned int rowIdx, __m256 lo, __m256 hi)
+    {
+        float* row = C + static_cast<std::size_t>(rowIdx) * ldc;
+        lo = _mm256_mul_ps(alphaVec, lo);
+        hi = _mm256_mul_ps(alphaVec, hi);
+        if (readC)
+        {
+            lo = _mm256_fmadd_ps(betaVec, _mm256_loadu_ps(row), lo);
+            hi = _mm256_fmadd_ps(betaVec, _mm256_loadu_ps(row + 8), hi);
+        }
+        if (addBias)
+        {
+            lo = _mm256_add_ps(lo, biasLo);
+            hi = _mm256_add_ps(hi, biasHi);
+        }
+        if (activate)
+        {
+            //! max(x, 0) + slope * min(x, 0)
+            lo = _mm256_fmadd_ps(slopeVec, _mm256_min_ps(lo, zero),
+                                 _mm256_max_ps(lo, zero));
+            hi = _mm256_fmadd_ps(slopeVec, _mm256_min_ps(hi, zero),
+                                 _mm256_max_ps(hi, zero));
+        }
+        _mm256_storeu_ps(row, lo);
+        _mm256_storeu_ps(row + 8, hi);
+    };
+
+    storeRow(0, c00, c01);
+    storeRow(1, c10, c11);
+    storeRow(2, c20, c21);
+    storeRow(3, c30, c31);
+    storeRow(4, c40, c41);
+    storeRow(5, c50, c51);
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
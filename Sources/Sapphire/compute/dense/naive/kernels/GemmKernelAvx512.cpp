@@ -0,0 +1,83 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (e.g. standard containers), since linker may
+//! pick AVX-512 version of them for the whole program
+
+#include <Sapphire/compute/dense/naive/kernels/GemmKernel.hpp>
+#include <cstddef>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+//! Loops over GemmMR are fully unrolled by the compiler, so accumulators are
+//! kept in registers during the whole kc loop
+void GemmMicroKernel(unsigned int kc, const float* packedA,
+                     const float* packedB, float* C, unsigned int ldc,
+                     float alpha, float beta, const GemmEpilogue* epilogue)
+{
+    __m512 acc0[GemmMR];
+    __m512 acc1[GemmMR];
+    for (unsigned int i = 0; i < GemmMR; ++i)
+        acc0[i] = acc1[i] = _mm512_setzero_ps();
+
+    for (unsigned int kIdx = 0; kIdx < kc; ++kIdx)
+    {
+        const __m512 b0 = _mm512_loadu_ps(packedB);
+        const __m512 b1 = _mm512_loadu_ps(packedB + 16);
+        for (unsigned int i = 0; i < GemmMR; ++i)
+        {
+            const __m512 a = _mm512_set1_ps(packedA[i]);
+            acc0[i] = _mm512_fmadd_ps(a, b0, acc0[i]);
+            acc1[i] = _mm512_fmadd_ps(a, b1, acc1[i]);
+        }
+        packedA += GemmMR;
+        packedB += GemmNR;
+    }
+
+    const __m512 alphaVec = _mm512_set1_ps(alpha);
+    const __m512 betaVec = _mm512_set1_ps(beta);
+
+    const bool addBias = epilogue && epilogue->Bias;
+    const bool activate = epilogue && epilogue->Activation;
+    const __m512 biasLo =
+        addBias ? _mm512_loadu_ps(epilogue->Bias) : _mm512_setzero_ps();
+    const __m512 biasHi =
+        addBias ? _mm512_loadu_ps(epilogue->Bias + 16) : _mm512_setzero_ps();
+    const __m512 slopeVec =
+        _mm512_set1_ps(activate ? epilogue->NegativeSlope : 0.0f);
+    const __m512 zero = _mm512_setzero_ps();
+
+    for (unsigned int i = 0; i < GemmMR; ++i)
+    {
+        float* row = C + static_cast<std::size_t>(i) * ldc;
+        __m512 lo = _mm512_mul_ps(alphaVec, acc0[i]);
+        __m512 hi = _mm512_mul_ps(alphaVec, acc1[i]);
+        if (beta != 0.0f)
+        {
+            lo = _mm512_fmadd_ps(betaVec, _mm512_loadu_ps(row), lo);
+            hi = _mm512_fmadd_ps(betaVec, _mm512_loadu_ps(row + 16), hi);
+        }
+        if (addBias)
+        {
+            lo = _mm512_add_ps(lo, biasLo);
+            hi = _mm512_add_ps(hi, biasHi);
+        }
+        if (activate)
+        {
+            //! Negative lanes are multiplied by slope
+            lo = _mm512_mask_mul_ps(
+                lo, _mm512_cmp_ps_mask(lo, zero, _CMP_LT_OQ), lo, slopeVec);
+            hi = _mm512_mask_mul_ps(
+                hi, _mm512_cmp_ps_mask(hi, zero, _CMP_LT_OQ), hi, slopeVec);
+        }
+        _mm512_storeu_ps(row, lo);
+        _mm512_storeu_ps(row + 16, hi);
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
@@ -0,0 +1,110 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+//! SSE2 is part of x86-64, so it is always available on x86-64 processors
+
+#include <Sapphire/compute/dense/naive/kernels/GemmKernel.hpp>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+#ifdef SAPPHIRE_SSE2
+void GemmMicroKernel(unsigned int kc, const float* packedA,
+                     const float* packedB, float* C, unsigned int ldc,
+                     float alpha, float beta, const GemmEpilogue* epilogue)
+{
+    __m128 acc[GemmMR][2];
+    for (auto& row : acc)
+        row[0] = row[1] = _mm_setzero_ps();
+
+    for (unsigned int kIdx = 0; kIdx < kc; ++kIdx)
+    {
+        const __m128 b0 = _mm_loadu_ps(packedB);
+        const __m128 b1 = _mm_loadu_ps(packedB + 4);
+        for (unsigned int i = 0; i < GemmMR; ++i)
+        {
+            const __m128 a = _mm_set1_ps(packedA[i]);
+            acc[i][0] = _mm_add_ps(acc[i][0], _mm_mul_ps(a, b0));
+            acc[i][1] = _mm_add_ps(acc[i][1], _mm_mul_ps(a, b1));
+        }
+        packedA += GemmMR;
+        packedB += GemmNR;
+    }
+
+    const __m128 alphaVec = _mm_set1_ps(alpha);
+    const __m128 betaVec = _mm_set1_ps(beta);
+
+    const bool addBias = epilogue && epilogue->Bias;
+    const bool activate = epilogue && epilogue->Activation;
+    const __m128 slopeVec =
+        _mm_set1_ps(activate ? epilogue->NegativeSlope : 0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 bias[2] = { zero, zero };
+    if (addBias)
+    {
+        bias[0] = _mm_loadu_ps(epilogue->Bias);
+        bias[1] = _mm_loadu_ps(epilogue->Bias + 4);
+    }
+
+    for (unsigned int i = 0; i < GemmMR; ++i)
+    {
+        float* row = C + static_cast<std::size_t>(i) * ldc;
+        for (unsigned int j = 0; j < 2; ++j)
+        {
+            __m128 result = _mm_mul_ps(alphaVec, acc[i][j]);
+            if (beta != 0.0f)
+                result = _mm_add_ps(
+                    result, _mm_mul_ps(betaVec, _mm_loadu_ps(row + 4 * j)));
+            if (addBias)
+                result = _mm_add_ps(result, bias[j]);
+            if (activate)
+                result = _mm_add_ps(
+                    _mm_max_ps(result, zero),
+                    _mm_mul_ps(slopeVec, _mm_min_ps(result, zero)));
+            _mm_storeu_ps(row + 4 * j, result);
+        }
+    }
+}
+#else
+void GemmMicroKernel(unsigned int kc, const float* packedA,
+                     const float* packedB, float* C, unsigned int ldc,
+                     float alpha, float beta, const GemmEpilogue* epilogue)
+{
+    float acc[GemmMR][GemmNR] = {};
+
+    for (unsigned int kIdx = 0; kIdx < kc; ++kIdx)
+    {
+        for (unsigned int i = 0; i < GemmMR; ++i)
+            for (unsigned int j = 0; j < GemmNR; ++j)
+                acc[i][j] += packedA[i] * packedB[j];
+        packedA += GemmMR;
+        packedB += GemmNR;
+    }
+
+    for (unsigned int i = 0; i < GemmMR; ++i)
+    {
+        float* row = C + static_cast<std::size_t>(i) * ldc;
+        for (unsigned int j = 0; j < GemmNR; ++j)
+        {
+            auto value = beta == 0.0f
+                             ? alpha * acc[i][j]
+                             : alpha * acc[i][j] + beta * row[j];
+            if (epilogue && epilogue->Bias)
+                value += epilogue->Bias[j];
+            if (epilogue && epilogue->Activation && value < 0.0f)
+                value *= epilogue->NegativeSlope;
+            row[j] = value;
+        }
+    }
+}
+#endif
+} // namespace Sapphire::Compute::Dense::Naive::Sse
@@ -0,0 +1,144 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2 and FMA flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx2.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/GemvKernel.hpp>
+#include <cstddef>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+namespace
+{
+float HorizontalSum(__m256 v)
+{
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v),
+                            _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+
+float Merge(float sum, const float* y, float alpha, float beta)
+{
+    return beta == 0.0f ? alpha * sum : alpha * sum + beta * *y;
+}
+} // namespace
+
+void Gemv(unsigned int k, unsigned int n, const float* x, const float* B,
+          unsigned int ldb, float* y, float alpha, float beta)
+{
+    const __m256 alphaVec = _mm256_set1_ps(alpha);
+    const __m256 betaVec = _mm256_set1_ps(beta);
+    const auto store = [=](float* dst, __m256 acc)
+    {
+        acc = _mm256_mul_ps(alphaVec, acc);
+        if (beta != 0.0f)
+            acc = _mm256_fmadd_ps(betaVec, _mm256_loadu_ps(dst), acc);
+        _mm256_storeu_ps(dst, acc);
+    };
+
+    unsigned int j = 0;
+    //! 64 columns are accumulated in 8 registers over the whole k
+    for (; j + 64 <= n; j += 64)
+    {
+        __m256 acc[8];
+        for (auto& vec : acc)
+            vec = _mm256_setzero_ps();
+
+        for (unsigned int p = 0; p < k; ++p)
+        {
+            const float* row = B + static_cast<std::size_t>(p) * ldb + j;
+            const __m256 xVec = _mm256_broadcast_ss(x + p);
+            for (unsigned int v = 0; v < 8; ++v)
+                acc[v] = _mm256_fmadd_ps(xVec, _mm256_loadu_ps(row + 8 * v),
+                                         acc[v]);
+        }
+
+        for (unsigned int v = 0; v < 8; ++v)
+            store(y + j + 8 * v, acc[v]);
+    }
+
+    for (; j + 8 <= n; j += 8)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        for (unsigned int p = 0; p < k; ++p)
+            acc = _mm256_fmadd_ps(
+                _mm256_broadcast_ss(x + p),
+                _mm256_loadu_ps(B + static_cast<std::size_t>(p) * ldb + j),
+                acc);
+        store(y + j, acc);
+    }
+
+    for (; j < n; ++j)
+    {
+        float sum = 0.0f;
+        for (unsigned int p = 0; p < k; ++p)
+            sum += x[p] * B[static_cast<std::size_t>(p) * ldb + j];
+        y[j] = Merge(sum, y + j, alpha, beta);
+    }
+}
+
+void GemvTransposed(unsigned int k, unsigned int n, const float* x,
+                    const float* B, unsigned int ldb, float* y, float alpha,
+                    float beta)
+{
+    unsigned int j = 0;
+    //! 4 rows share each load of x
+    for (; j + 4 <= n; j += 4)
+    {
+        const float* row0 = B + static_cast<std::size_t>(j) * ldb;
+        const float* row1 = row0 + ldb;
+        const float* row2 = row1 + ldb;
+        const float* row3 = row2 + ldb;
+
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+        unsigned int p = 0;
+        for (; p + 8 <= k; p += 8)
+        {
+            const __m256 xVec = _mm256_loadu_ps(x + p);
+            acc0 = _mm256_fmadd_ps(xVec, _mm256_loadu_ps(row0 + p), acc0);
+            acc1 = _mm256_fmadd_ps(xVec, _mm256_loadu_ps(row1 + p), acc1);
+            acc2 = _mm256_fmadd_ps(xVec, _mm256_loadu_ps(row2 + p), acc2);
+            acc3 = _mm256_fmadd_ps(xVec, _mm256_loadu_ps(row3 + p), acc3);
+        }
+
+        float sum0 = HorizontalSum(acc0), sum1 = HorizontalSum(acc1);
+        float sum2 = HorizontalSum(acc2), sum3 = HorizontalSum(acc3);
+        for (; p < k; ++p)
+        {
+            sum0 += x[p] * row0[p];
+            sum1 += x[p] * row1[p];
+            sum2 += x[p] * row2[p];
+            sum3 += x[p] * row3[p];
+        }
+
+        y[j] = Merge(sum0, y + j, alpha, beta);
+        y[j + 1] = Merge(sum1, y + j + 1, alpha, beta);
+        y[j + 2] = Merge(sum2, y + j + 2, alpha, beta);
+        y[j + 3] = Merge(sum3, y + j + 3, alpha, beta);
+    }
+
+    for (; j < n; ++j)
+    {
+        const float* row = B + static_cast<std::size_t>(j) * ldb;
+        __m256 acc = _mm256_setzero_ps();
+        unsigned int p = 0;
+        for (; p + 8 <= k; p += 8)
+            acc = _mm256_fmadd_ps(_mm256_loadu_ps(x + p),
+                                  _mm256_loadu_ps(row + p), acc);
+
+        float sum = HorizontalSum(acc);
+        for (; p < k; ++p)
+            sum += x[p] * row[p];
+        y[j] = Merge(sum, y + j, alpha, beta);
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
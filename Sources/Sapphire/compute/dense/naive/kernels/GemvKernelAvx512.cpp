@@ -0,0 +1,160 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx512.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/GemvKernel.hpp>
+#include <cstddef>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+namespace
+{
+//! Mask of the first count lanes (count < 16)
+__mmask16 TailMask(unsigned int count)
+{
+    return static_cast<__mmask16>((1u << count) - 1);
+}
+
+//! Masked extracts avoid GCC -Wmaybe-uninitialized false positive of
+//! _mm512_reduce_add_ps and _mm512_castps512_ps256
+__m256 ExtractHalf(__m512 v, int idx)
+{
+    return _mm256_castpd_ps(_mm512_mask_extractf64x4_pd(
+        _mm256_setzero_pd(), 0xf, _mm512_castps_pd(v), idx));
+}
+
+float HorizontalSum(__m512 v)
+{
+    const __m256 half = _mm256_add_ps(ExtractHalf(v, 0), ExtractHalf(v, 1));
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(half),
+                            _mm256_extractf128_ps(half, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+
+float Merge(float sum, const float* y, float alpha, float beta)
+{
+    return beta == 0.0f ? alpha * sum : alpha * sum + beta * *y;
+}
+} // namespace
+
+void Gemv(unsigned int k, unsigned int n, const float* x, const float* B,
+          unsigned int ldb, float* y, float alpha, float beta)
+{
+    const __m512 alphaVec = _mm512_set1_ps(alpha);
+    const __m512 betaVec = _mm512_set1_ps(beta);
+    const auto store = [=](float* dst, __m512 acc, __mmask16 mask)
+    {
+        acc = _mm512_mul_ps(alphaVec, acc);
+        if (beta != 0.0f)
+            acc = _mm512_fmadd_ps(betaVec, _mm512_maskz_loadu_ps(mask, dst),
+                                  acc);
+        _mm512_mask_storeu_ps(dst, mask, acc);
+    };
+
+    unsigned int j = 0;
+    //! 128 columns are accumulated in 8 registers over the whole k
+    for (; j + 128 <= n; j += 128)
+    {
+        __m512 acc[8];
+        for (auto& vec : acc)
+            vec = _mm512_setzero_ps();
+
+        for (unsigned int p = 0; p < k; ++p)
+        {
+            const float* row = B + static_cast<std::size_t>(p) * ldb + j;
+            const __m512 xVec = _mm512_set1_ps(x[p]);
+            for (unsigned int v = 0; v < 8; ++v)
+                acc[v] = _mm512_fmadd_ps(xVec, _mm512_loadu_ps(row + 16 * v),
+                                         acc[v]);
+        }
+
+        for (unsigned int v = 0; v < 8; ++v)
+            store(y + j + 16 * v, acc[v], 0xffff);
+    }
+
+    //! Remaining columns are processed 16 at a time, and the last ones with
+    //! masked loads and stores
+    for (; j < n; j += 16)
+    {
+        const auto mask = n - j >= 16 ? static_cast<__mmask16>(0xffff)
+                                      : TailMask(n - j);
+        __m512 acc = _mm512_setzero_ps();
+        for (unsigned int p = 0; p < k; ++p)
+            acc = _mm512_fmadd_ps(
+                _mm512_set1_ps(x[p]),
+                _mm512_maskz_loadu_ps(
+                    mask, B + static_cast<std::size_t>(p) * ldb + j),
+                acc);
+        store(y + j, acc, mask);
+    }
+}
+
+void GemvTransposed(unsigned int k, unsigned int n, const float* x,
+                    const float* B, unsigned int ldb, float* y, float alpha,
+                    float beta)
+{
+    const auto tailMask = TailMask(k % 16);
+    const auto mainK = k - k % 16;
+
+    unsigned int j = 0;
+    //! 4 rows share each load of x
+    for (; j + 4 <= n; j += 4)
+    {
+        const float* row0 = B + static_cast<std::size_t>(j) * ldb;
+        const float* row1 = row0 + ldb;
+        const float* row2 = row1 + ldb;
+        const float* row3 = row2 + ldb;
+
+        __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+        __m512 acc2 = _mm512_setzero_ps(), acc3 = _mm512_setzero_ps();
+        for (unsigned int p = 0; p < mainK; p += 16)
+        {
+            const __m512 xVec = _mm512_loadu_ps(x + p);
+            acc0 = _mm512_fmadd_ps(xVec, _mm512_loadu_ps(row0 + p), acc0);
+            acc1 = _mm512_fmadd_ps(xVec, _mm512_loadu_ps(row1 + p), acc1);
+            acc2 = _mm512_fmadd_ps(xVec, _mm512_loadu_ps(row2 + p), acc2);
+            acc3 = _mm512_fmadd_ps(xVec, _mm512_loadu_ps(row3 + p), acc3);
+        }
+        if (tailMask)
+        {
+            const __m512 xVec = _mm512_maskz_loadu_ps(tailMask, x + mainK);
+            acc0 = _mm512_fmadd_ps(
+                xVec, _mm512_maskz_loadu_ps(tailMask, row0 + mainK), acc0);
+            acc1 = _mm512_fmadd_ps(
+                xVec, _mm512_maskz_loadu_ps(tailMask, row1 + mainK), acc1);
+            acc2 = _mm512_fmadd_ps(
+                xVec, _mm512_maskz_loadu_ps(tailMask, row2 + mainK), acc2);
+            acc3 = _mm512_fmadd_ps(
+                xVec, _mm512_maskz_loadu_ps(tailMask, row3 + mainK), acc3);
+        }
+
+        y[j] = Merge(HorizontalSum(acc0), y + j, alpha, beta);
+        y[j + 1] = Merge(HorizontalSum(acc1), y + j + 1, alpha, beta);
+        y[j + 2] = Merge(HorizontalSum(acc2), y + j + 2, alpha, beta);
+        y[j + 3] = Merge(HorizontalSum(acc3), y + j + 3, alpha, beta);
+    }
+
+    for (; j < n; ++j)
+    {
+        const float* row = B + static_cast<std::size_t>(j) * ldb;
+        __m512 acc = _mm512_setzero_ps();
+        for (unsigned int p = 0; p < mainK; p += 16)
+            acc = _mm512_fmadd_ps(_mm512_loadu_ps(x + p),
+                                  _mm512_loadu_ps(row + p), acc);
+        if (tailMask)
+            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tailMask, x + mainK),
+                                  _mm512_maskz_loadu_ps(tailMask, row + mainK),
+                                  acc);
+        y[j] = Merge(HorizontalSum(acc), y + j, alpha, beta);
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
@@ -0,0 +1,177 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+//! (see GemmKernelSse.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/GemvKernel.hpp>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+namespace
+{
+float Merge(float sum, const float* y, float alpha, float beta)
+{
+    return beta == 0.0f ? alpha * sum : alpha * sum + beta * *y;
+}
+
+#ifdef SAPPHIRE_SSE2
+float HorizontalSum(__m128 v)
+{
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+#endif
+} // namespace
+
+#ifdef SAPPHIRE_SSE2
+void Gemv(unsigned int k, unsigned int n, const float* x, const float* B,
+          unsigned int ldb, float* y, float alpha, float beta)
+{
+    const __m128 alphaVec = _mm_set1_ps(alpha);
+    const __m128 betaVec = _mm_set1_ps(beta);
+    const auto store = [=](float* dst, __m128 acc)
+    {
+        acc = _mm_mul_ps(alphaVec, acc);
+        if (beta != 0.0f)
+            acc = _mm_add_ps(acc, _mm_mul_ps(betaVec, _mm_loadu_ps(dst)));
+        _mm_storeu_ps(dst, acc);
+    };
+
+    unsigned int j = 0;
+    //! 32 columns are accumulated in 8 registers over the whole k
+    for (; j + 32 <= n; j += 32)
+    {
+        __m128 acc[8];
+        for (auto& vec : acc)
+            vec = _mm_setzero_ps();
+
+        for (unsigned int p = 0; p < k; ++p)
+        {
+            const float* row = B + static_cast<std::size_t>(p) * ldb + j;
+            const __m128 xVec = _mm_set1_ps(x[p]);
+            for (unsigned int v = 0; v < 8; ++v)
+                acc[v] = _mm_add_ps(
+                    acc[v], _mm_mul_ps(xVec, _mm_loadu_ps(row + 4 * v)));
+        }
+
+        for (unsigned int v = 0; v < 8; ++v)
+            store(y + j + 4 * v, acc[v]);
+    }
+
+    for (; j + 4 <= n; j += 4)
+    {
+        const float* col = B + j;
+        __m128 acc = _mm_setzero_ps();
+        for (unsigned int p = 0; p < k; ++p)
+            acc = _mm_add_ps(
+                acc,
+                _mm_mul_ps(_mm_set1_ps(x[p]),
+                           _mm_loadu_ps(col + static_cast<std::size_t>(p) *
+                                        ldb)));
+        store(y + j, acc);
+    }
+
+    for (; j < n; ++j)
+    {
+        float sum = 0.0f;
+        for (unsigned int p = 0; p < k; ++p)
+            sum += x[p] * B[static_cast<std::size_t>(p) * ldb + j];
+        y[j] = Merge(sum, y + j, alpha, beta);
+    }
+}
+
+void GemvTransposed(unsigned int k, unsigned int n, const float* x,
+                    const float* B, unsigned int ldb, float* y, float alpha,
+                    float beta)
+{
+    unsigned int j = 0;
+    //! 4 rows share each load of x
+    for (; j + 4 <= n; j += 4)
+    {
+        const float* row0 = B + static_cast<std::size_t>(j) * ldb;
+        const float* row1 = row0 + ldb;
+        const float* row2 = row1 + ldb;
+        const float* row3 = row2 + ldb;
+
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+        unsigned int p = 0;
+        for (; p + 4 <= k; p += 4)
+        {
+            const __m128 xVec = _mm_loadu_ps(x + p);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(xVec, _mm_loadu_ps(row0 + p)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(xVec, _mm_loadu_ps(row1 + p)));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(xVec, _mm_loadu_ps(row2 + p)));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(xVec, _mm_loadu_ps(row3 + p)));
+        }
+
+        float sum0 = HorizontalSum(acc0), sum1 = HorizontalSum(acc1);
+        float sum2 = HorizontalSum(acc2), sum3 = HorizontalSum(acc3);
+        for (; p < k; ++p)
+        {
+            sum0 += x[p] * row0[p];
+            sum1 += x[p] * row1[p];
+            sum2 += x[p] * row2[p];
+            sum3 += x[p] * row3[p];
+        }
+
+        y[j] = Merge(sum0, y + j, alpha, beta);
+        y[j + 1] = Merge(sum1, y + j + 1, alpha, beta);
+        y[j + 2] = Merge(sum2, y + j + 2, alpha, beta);
+        y[j + 3] = Merge(sum3, y + j + 3, alpha, beta);
+    }
+
+    for (; j < n; ++j)
+    {
+        const float* row = B + static_cast<std::size_t>(j) * ldb;
+        __m128 acc = _mm_setzero_ps();
+        unsigned int p = 0;
+        for (; p + 4 <= k; p += 4)
+            acc = _mm_add_ps(
+                acc, _mm_mul_ps(_mm_loadu_ps(x + p), _mm_loadu_ps(row + p)));
+
+        float sum = HorizontalSum(acc);
+        for (; p < k; ++p)
+            sum += x[p] * row[p];
+        y[j] = Merge(sum, y + j, alpha, beta);
+    }
+}
+#else
+void Gemv(unsigned int k, unsigned int n, const float* x, const float* B,
+          unsigned int ldb, float* y, float alpha, float beta)
+{
+    for (unsigned int j = 0; j < n; ++j)
+    {
+        float sum = 0.0f;
+        for (unsigned int p = 0; p < k; ++p)
+            sum += x[p] * B[static_cast<std::size_t>(p) * ldb + j];
+        y[j] = Merge(sum, y + j, alpha, beta);
+    }
+}
+
+void GemvTransposed(unsigned int k, unsigned int n, const float* x,
+                    const float* B, unsigned int ldb, float* y, float alpha,
+                    float beta)
+{
+    for (unsigned int j = 0; j < n; ++j)
+    {
+        const float* row = B + static_cast<std::size_t>(j) * ldb;
+        float sum = 0.0f;
+        for (unsigned int p = 0; p < k; ++p)
+            sum += x[p] * row[p];
+        y[j] = Merge(sum, y + j, alpha, beta);
+    }
+}
+#endif
+} // namespace Sapphire::Compute::Dense::Naive::Sse
@@ -0,0 +1,99 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/kernels/HalfKernel.hpp>
+#include <cstring>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+std::uint32_t ToBits(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float FromBits(std::uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+//! Shifts right by shift bits, rounding to nearest even
+std::uint32_t ShiftRound(std::uint32_t value, unsigned int shift)
+{
+    const auto result = value >> shift;
+    const auto remainder = value & ((1u << shift) - 1u);
+    const auto half = 1u << (shift - 1);
+    if (remainder > half || (remainder == half && (result & 1u)))
+        return result + 1u;
+    return result;
+}
+} // namespace
+
+std::uint16_t FloatToFp16Scalar(float value)
+{
+    auto bits = ToBits(value);
+    const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+    bits &= 0x7fffffffu;
+
+    //! NaNs are quieted, keeping upper bits of the payload
+    if (bits > 0x7f800000u)
+        return static_cast<std::uint16_t>(sign | 0x7e00u |
+                                          ((bits >> 13) & 0x3ffu));
+    if (bits >= 0x47800000u)
+        return static_cast<std::uint16_t>(sign | 0x7c00u);
+
+    //! Below 2^-14, the result is subnormal in units of 2^-24
+    if (bits < 0x38800000u)
+    {
+        const auto exponent = bits >> 23;
+        if (exponent < 102)
+            return sign;
+        const auto mantissa = (bits & 0x7fffffu) | 0x800000u;
+        return static_cast<std::uint16_t>(
+            sign | ShiftRound(mantissa, 126 - exponent));
+    }
+
+    //! Carry of rounding propagates into the exponent, up to infinity
+    return static_cast<std::uint16_t>(
+        sign | ShiftRound(bits - 0x38000000u, 13));
+}
+
+float Fp16ToFloatScalar(std::uint16_t value)
+{
+    const auto sign = static_cast<std::uint32_t>(value & 0x8000u) << 16;
+    const auto exponent = (value >> 10) & 0x1fu;
+    const auto mantissa = static_cast<std::uint32_t>(value & 0x3ffu);
+
+    if (exponent == 0x1f)
+        return FromBits(sign | 0x7f800000u | (mantissa << 13) |
+                        (mantissa ? 0x400000u : 0u));
+    if (exponent == 0)
+    {
+        const auto magnitude = static_cast<float>(mantissa) * 0x1p-24f;
+        return FromBits(sign | ToBits(magnitude));
+    }
+    return FromBits(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+std::uint16_t FloatToBf16Scalar(float value)
+{
+    const auto bits = ToBits(value);
+    if ((bits & 0x7fffffffu) > 0x7f800000u)
+        return static_cast<std::uint16_t>((bits >> 16) | 0x40u);
+    return static_cast<std::uint16_t>(
+        (bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+}
+
+float Bf16ToFloatScalar(std::uint16_t value)
+{
+    return FromBits(static_cast<std::uint32_t>(value) << 16);
+}
+} // namespace Sapphire::Compute::Dense::Naive
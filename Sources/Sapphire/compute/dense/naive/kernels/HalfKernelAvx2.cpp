@@ -0,0 +1,87 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2, FMA and F16C flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx2.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/HalfKernel.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+namespace
+{
+//! Rounds 8 floats to bf16, sign extended to 32 bits (see HalfKernelSse.cpp)
+__m256i RoundToBf16(__m256 value)
+{
+    const __m256i bits = _mm256_castps_si256(value);
+    const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16),
+                                         _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_srai_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(bits, _mm256_set1_epi32(0x7fff)),
+                         lsb),
+        16);
+    const __m256i quietNaN = _mm256_or_si256(_mm256_srai_epi32(bits, 16),
+                                             _mm256_set1_epi32(0x40));
+    const __m256i isNaN = _mm256_cmpgt_epi32(
+        _mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff)),
+        _mm256_set1_epi32(0x7f800000));
+    return _mm256_blendv_epi8(rounded, quietNaN, isNaN);
+}
+} // namespace
+
+void Fp16ToFloat(float* out, const std::uint16_t* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(out + i,
+                         _mm256_cvtph_ps(_mm_loadu_si128(
+                             reinterpret_cast<const __m128i*>(in + i))));
+    for (; i < size; ++i)
+        out[i] = Fp16ToFloatScalar(in[i]);
+}
+
+void FloatToFp16(std::uint16_t* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(in + i),
+                                         _MM_FROUND_TO_NEAREST_INT));
+    for (; i < size; ++i)
+        out[i] = FloatToFp16Scalar(in[i]);
+}
+
+void Bf16ToFloat(float* out, const std::uint16_t* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256i wide = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            _mm256_slli_epi32(wide, 16));
+    }
+    for (; i < size; ++i)
+        out[i] = Bf16ToFloatScalar(in[i]);
+}
+
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256i rounded = RoundToBf16(_mm256_loadu_ps(in + i));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(out + i),
+            _mm_packs_epi32(_mm256_castsi256_si128(rounded),
+                            _mm256_extracti128_si256(rounded, 1)));
+    }
+    for (; i < size; ++i)
+        out[i] = FloatToBf16Scalar(in[i]);
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
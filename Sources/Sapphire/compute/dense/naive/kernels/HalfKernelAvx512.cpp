@@ -0,0 +1,133 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx512.cpp)
+//! Tails are handled with masked loads and stores
+
+#include <Sapphire/compute/dense/naive/kernels/HalfKernel.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+namespace
+{
+__mmask16 TailMask(unsigned int remaining)
+{
+    return static_cast<__mmask16>((1u << remaining) - 1u);
+}
+
+//! Zero masked forms of intrinsics are used on every lane to avoid GCC
+//! -Wmaybe-uninitialized false positive of unmasked forms reading
+//! undefined source registers
+__m512 Fp16ToFloat16(__mmask16 mask, __m256i half)
+{
+    return _mm512_maskz_cvtph_ps(mask, half);
+}
+
+__m256i FloatToFp16x16(__mmask16 mask, __m512 value)
+{
+    return _mm512_maskz_cvtps_ph(mask, value,
+                                 _MM_FROUND_TO_NEAREST_INT |
+                                 _MM_FROUND_NO_EXC);
+}
+
+__m512i Bf16ToFloat16(__mmask16 mask, __m256i half)
+{
+    return _mm512_maskz_slli_epi32(mask,
+                                   _mm512_maskz_cvtepu16_epi32(mask, half),
+                                   16);
+}
+
+__m256i FloatToBf16x16(__mmask16 mask, __m512 value)
+{
+    const __m512i bits = _mm512_castps_si512(value);
+    const __m512i upper = _mm512_maskz_srli_epi32(mask, bits, 16);
+    const __m512i lsb =
+        _mm512_maskz_and_epi32(mask, upper, _mm512_set1_epi32(1));
+    const __m512i rounded = _mm512_maskz_srli_epi32(
+        mask,
+        _mm512_maskz_add_epi32(
+            mask, _mm512_maskz_add_epi32(mask, bits, _mm512_set1_epi32(0x7fff)),
+            lsb),
+        16);
+    const __m512i quietNaN =
+        _mm512_maskz_or_epi32(mask, upper, _mm512_set1_epi32(0x40));
+    const __mmask16 isNaN = _mm512_mask_cmpgt_epu32_mask(
+        mask, _mm512_maskz_and_epi32(mask, bits, _mm512_set1_epi32(0x7fffffff)),
+        _mm512_set1_epi32(0x7f800000));
+    return _mm512_maskz_cvtepi32_epi16(
+        mask, _mm512_mask_blend_epi32(isNaN, rounded, quietNaN));
+}
+} // namespace
+
+void Fp16ToFloat(float* out, const std::uint16_t* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(out + i,
+                         Fp16ToFloat16(0xffff,
+                                       _mm256_loadu_si256(
+                                           reinterpret_cast<const __m256i*>(
+                                               in + i))));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_ps(out + i, mask,
+                              Fp16ToFloat16(mask, _mm256_maskz_loadu_epi16(
+                                                      mask, in + i)));
+    }
+}
+
+void FloatToFp16(std::uint16_t* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            FloatToFp16x16(0xffff, _mm512_loadu_ps(in + i)));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm256_mask_storeu_epi16(
+            out + i, mask,
+            FloatToFp16x16(mask, _mm512_maskz_loadu_ps(mask, in + i)));
+    }
+}
+
+void Bf16ToFloat(float* out, const std::uint16_t* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_si512(out + i,
+                            Bf16ToFloat16(0xffff,
+                                          _mm256_loadu_si256(
+                                              reinterpret_cast<const __m256i*>(
+                                                  in + i))));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_epi32(out + i, mask,
+                                 Bf16ToFloat16(mask, _mm256_maskz_loadu_epi16(
+                                                         mask, in + i)));
+    }
+}
+
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            FloatToBf16x16(0xffff, _mm512_loadu_ps(in + i)));
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm256_mask_storeu_epi16(
+            out + i, mask,
+            FloatToBf16x16(mask, _mm512_maskz_loadu_ps(mask, in + i)));
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
@@ -0,0 +1,34 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 (F, BW, DQ, VL, BF16) flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx512.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/HalfKernel.hpp>
+#include <cstring>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512Bf16
+{
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m256bh converted = _mm512_cvtneps_pbh(_mm512_loadu_ps(in + i));
+        std::memcpy(out + i, &converted, sizeof(converted));
+    }
+    if (i < size)
+    {
+        const auto remaining = size - i;
+        const auto mask = static_cast<__mmask16>((1u << remaining) - 1u);
+        const __m256bh converted =
+            _mm512_cvtneps_pbh(_mm512_maskz_loadu_ps(mask, in + i));
+        std::memcpy(out + i, &converted, remaining * sizeof(std::uint16_t));
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512Bf16
@@ -0,0 +1,87 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+//! fp16 has no conversion instruction before F16C, so it is converted by
+//! scalar code
+
+#include <Sapphire/compute/dense/naive/kernels/HalfKernel.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+void Fp16ToFloat(float* out, const std::uint16_t* in, unsigned int size)
+{
+    for (unsigned int i = 0; i < size; ++i)
+        out[i] = Fp16ToFloatScalar(in[i]);
+}
+
+void FloatToFp16(std::uint16_t* out, const float* in, unsigned int size)
+{
+    for (unsigned int i = 0; i < size; ++i)
+        out[i] = FloatToFp16Scalar(in[i]);
+}
+
+void Bf16ToFloat(float* out, const std::uint16_t* in, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m128i half =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_unpacklo_epi16(zero, half));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4),
+                         _mm_unpackhi_epi16(zero, half));
+    }
+#endif
+    for (; i < size; ++i)
+        out[i] = Bf16ToFloatScalar(in[i]);
+}
+
+#ifdef SAPPHIRE_SSE2
+namespace
+{
+//! Rounds 4 floats to bf16, sign extended to 32 bits so that they can be
+//! packed with signed saturation without changing the bits
+__m128i RoundToBf16(__m128 value)
+{
+    const __m128i bits = _mm_castps_si128(value);
+    const __m128i lsb = _mm_and_si128(_mm_srli_epi32(bits, 16),
+                                      _mm_set1_epi32(1));
+    const __m128i rounded = _mm_srai_epi32(
+        _mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0x7fff)), lsb), 16);
+    const __m128i quietNaN =
+        _mm_or_si128(_mm_srai_epi32(bits, 16), _mm_set1_epi32(0x40));
+    const __m128i isNaN = _mm_cmpgt_epi32(
+        _mm_and_si128(bits, _mm_set1_epi32(0x7fffffff)),
+        _mm_set1_epi32(0x7f800000));
+    return _mm_or_si128(_mm_and_si128(isNaN, quietNaN),
+                        _mm_andnot_si128(isNaN, rounded));
+}
+} // namespace
+#endif
+
+void FloatToBf16(std::uint16_t* out, const float* in, unsigned int size)
+{
+    unsigned int i = 0;
+#ifdef SAPPHIRE_SSE2
+    for (; i + 8 <= size; i += 8)
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(out + i),
+            _mm_packs_epi32(RoundToBf16(_mm_loadu_ps(in + i)),
+                            RoundToBf16(_mm_loadu_ps(in + i + 4))));
+#endif
+    for (; i < size; ++i)
+        out[i] = FloatToBf16Scalar(in[i]);
+}
+} // namespace Sapphire::Compute::Dense::Naive::Sse
@@ -0,0 +1,73 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/kernels/Int8GemmKernel.hpp>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+template <typename T>
+void PackA(T* packedA, const std::uint8_t* A, unsigned int rowStride,
+           unsigned int colStride, unsigned int rows, unsigned int k,
+           unsigned int mr, unsigned int kGroup)
+{
+    for (unsigned int groupIdx = 0; groupIdx < k; groupIdx += kGroup)
+    {
+        for (unsigned int i = 0; i < mr; ++i)
+        {
+            for (unsigned int p = 0; p < kGroup; ++p)
+            {
+                const auto kIdx = groupIdx + p;
+                packedA[p] = i < rows && kIdx < k
+                                 ? static_cast<T>(
+                                     A[static_cast<std::size_t>(i) *
+                                       rowStride +
+                                       static_cast<std::size_t>(kIdx) *
+                                       colStride])
+                                 : static_cast<T>(0);
+            }
+            packedA += kGroup;
+        }
+    }
+}
+} // namespace
+
+void PackInt8A(void* packedA, const std::uint8_t* A, unsigned int rowStride,
+               unsigned int colStride, unsigned int rows, unsigned int k,
+               unsigned int mr, unsigned int kGroup, bool wide)
+{
+    if (wide)
+        PackA(static_cast<std::int16_t*>(packedA), A, rowStride, colStride,
+              rows, k, mr, kGroup);
+    else
+        PackA(static_cast<std::uint8_t*>(packedA), A, rowStride, colStride,
+              rows, k, mr, kGroup);
+}
+
+void PackInt8B(std::int8_t* packedB, const std::int8_t* B,
+               unsigned int rowStride, unsigned int colStride, unsigned int k,
+               unsigned int cols, unsigned int nr, unsigned int kGroup)
+{
+    for (unsigned int groupIdx = 0; groupIdx < k; groupIdx += kGroup)
+    {
+        for (unsigned int j = 0; j < nr; ++j)
+        {
+            for (unsigned int p = 0; p < kGroup; ++p)
+            {
+                const auto kIdx = groupIdx + p;
+                packedB[p] = j < cols && kIdx < k
+                                 ? B[static_cast<std::size_t>(kIdx) *
+                                     rowStride +
+                                     static_cast<std::size_t>(j) * colStride]
+                                 : static_cast<std::int8_t>(0);
+            }
+            packedB += kGroup;
+        }
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,56 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2 and FMA flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx2.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/Int8GemmKernel.hpp>
+#include <cstddef>
+#include <cstring>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+void Int8GemmMicroKernel(unsigned int groups, const void* packedA,
+                         const std::int8_t* packedB, std::int32_t* C)
+{
+    const auto* a = static_cast<const std::int16_t*>(packedA);
+
+    __m256i acc[Int8GemmMR][2];
+    for (auto& row : acc)
+        row[0] = row[1] = _mm256_setzero_si256();
+
+    for (unsigned int groupIdx = 0; groupIdx < groups; ++groupIdx)
+    {
+        //! Each half holds pairs of 8 columns, sign extended to int16
+        const __m256i b0 = _mm256_cvtepi8_epi16(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(packedB)));
+        const __m256i b1 = _mm256_cvtepi8_epi16(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(packedB + 16)));
+        for (unsigned int i = 0; i < Int8GemmMR; ++i)
+        {
+            std::int32_t pair;
+            std::memcpy(&pair, a + 2 * i, sizeof(pair));
+            const __m256i aVec = _mm256_set1_epi32(pair);
+            acc[i][0] =
+                _mm256_add_epi32(acc[i][0], _mm256_madd_epi16(aVec, b0));
+            acc[i][1] =
+                _mm256_add_epi32(acc[i][1], _mm256_madd_epi16(aVec, b1));
+        }
+        a += 2 * Int8GemmMR;
+        packedB += 2 * Int8GemmNR;
+    }
+
+    for (unsigned int i = 0; i < Int8GemmMR; ++i)
+    {
+        auto* row = reinterpret_cast<__m256i*>(
+            C + static_cast<std::size_t>(i) * Int8GemmNR);
+        _mm256_storeu_si256(row, acc[i][0]);
+        _mm256_storeu_si256(row + 1, acc[i][1]);
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
@@ -0,0 +1,80 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+//! (see GemmKernelSse.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/Int8GemmKernel.hpp>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+#ifdef SAPPHIRE_SSE2
+void Int8GemmMicroKernel(unsigned int groups, const void* packedA,
+                         const std::int8_t* packedB, std::int32_t* C)
+{
+    const auto* a = static_cast<const std::int16_t*>(packedA);
+
+    __m128i acc[Int8GemmMR][2];
+    for (auto& row : acc)
+        row[0] = row[1] = _mm_setzero_si128();
+
+    for (unsigned int groupIdx = 0; groupIdx < groups; ++groupIdx)
+    {
+        //! Each pair of int8 is sign extended into pair of int16 lanes
+        const __m128i b =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(packedB));
+        const __m128i b0 = _mm_srai_epi16(_mm_unpacklo_epi8(b, b), 8);
+        const __m128i b1 = _mm_srai_epi16(_mm_unpackhi_epi8(b, b), 8);
+        for (unsigned int i = 0; i < Int8GemmMR; ++i)
+        {
+            std::int32_t pair;
+            std::memcpy(&pair, a + 2 * i, sizeof(pair));
+            const __m128i aVec = _mm_set1_epi32(pair);
+            acc[i][0] = _mm_add_epi32(acc[i][0], _mm_madd_epi16(aVec, b0));
+            acc[i][1] = _mm_add_epi32(acc[i][1], _mm_madd_epi16(aVec, b1));
+        }
+        a += 2 * Int8GemmMR;
+        packedB += 2 * Int8GemmNR;
+    }
+
+    for (unsigned int i = 0; i < Int8GemmMR; ++i)
+    {
+        auto* row = reinterpret_cast<__m128i*>(
+            C + static_cast<std::size_t>(i) * Int8GemmNR);
+        _mm_storeu_si128(row, acc[i][0]);
+        _mm_storeu_si128(row + 1, acc[i][1]);
+    }
+}
+#else
+void Int8GemmMicroKernel(unsigned int groups, const void* packedA,
+                         const std::int8_t* packedB, std::int32_t* C)
+{
+    const auto* a = static_cast<const std::int16_t*>(packedA);
+    std::int32_t acc[Int8GemmMR][Int8GemmNR] = {};
+
+    for (unsigned int groupIdx = 0; groupIdx < groups; ++groupIdx)
+    {
+        for (unsigned int i = 0; i < Int8GemmMR; ++i)
+            for (unsigned int j = 0; j < Int8GemmNR; ++j)
+                acc[i][j] += a[2 * i] * packedB[2 * j] +
+                    a[2 * i + 1] * packedB[2 * j + 1];
+        a += 2 * Int8GemmMR;
+        packedB += 2 * Int8GemmNR;
+    }
+
+    for (unsigned int i = 0; i < Int8GemmMR; ++i)
+        for (unsigned int j = 0; j < Int8GemmNR; ++j)
+            C[static_cast<std::size_t>(i) * Int8GemmNR + j] = acc[i][j];
+}
+#endif
+} // namespace Sapphire::Compute::Dense::Naive::Sse
@@ -0,0 +1,211 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/kernels/KernelRegistry.hpp>
+#include <Sapphire/util/CpuFeatures.hpp>
+#include <atomic>
+#include <stdexcept>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+const HostKernels SseKernels = {
+    InstructionSet::Sse,
+    { Sse::GemmMR, Sse::GemmNR, 96, 256, 2048, Sse::GemmMicroKernel },
+    Sse::Gemv, Sse::GemvTransposed, &Sse::SmallGemmKernels,
+    { Sse::Int8GemmMR, Sse::Int8GemmNR, 2, true, Sse::Int8GemmMicroKernel },
+    Sse::Add, Sse::Sub, Sse::Dot, Sse::MulAdd, Sse::Scale,
+    Sse::AddScalar, Sse::SubScalar, Sse::ScalarSub, Sse::Inverse,
+    Sse::ReLU, Sse::LeakyReLU, Sse::ReLUBackward,
+    Sse::LeakyReLUBackward, Sse::InverseBackward, Sse::Gather, Sse::Transpose,
+    { Sse::Fp16ToFloat, Sse::FloatToFp16, Sse::Bf16ToFloat,
+      Sse::FloatToBf16 },
+    &Sse::AccurateMathKernels, &Sse::FastMathKernels,
+    &Sse::Reductions
+};
+
+#ifdef WITH_AVX2
+const HostKernels Avx2Kernels = {
+    InstructionSet::Avx2,
+    { Avx2::GemmMR, Avx2::GemmNR, 96, 256, 2048, Avx2::GemmMicroKernel },
+    Avx2::Gemv, Avx2::GemvTransposed, &Avx2::SmallGemmKernels,
+    { Avx2::Int8GemmMR, Avx2::Int8GemmNR, 2, true,
+      Avx2::Int8GemmMicroKernel },
+    Avx2::Add, Avx2::Sub, Avx2::Dot, Avx2::MulAdd, Avx2::Scale,
+    Avx2::AddScalar, Avx2::SubScalar, Avx2::ScalarSub, Avx2::Inverse,
+    Avx2::ReLU, Avx2::LeakyReLU, Avx2::ReLUBackward,
+    Avx2::LeakyReLUBackward, Avx2::InverseBackward, Avx2::Gather,
+    Avx2::Transpose,
+    { Avx2::Fp16ToFloat, Avx2::FloatToFp16, Avx2::Bf16ToFloat,
+      Avx2::FloatToBf16 },
+    &Avx2::AccurateMathKernels, &Avx2::FastMathKernels,
+    &Avx2::Reductions
+};
+#endif
+
+#ifdef WITH_AVX512
+const HostKernels Avx512Kernels = {
+    InstructionSet::Avx512,
+    { Avx512::GemmMR, Avx512::GemmNR, 112, 256, 2048,
+      Avx512::GemmMicroKernel },
+    Avx512::Gemv, Avx512::GemvTransposed, &Avx512::SmallGemmKernels,
+    { Avx512::Int8GemmMR, Avx512::Int8GemmNR, 2, true,
+      Avx512::Int8GemmMicroKernel },
+    Avx512::Add, Avx512::Sub, Avx512::Dot, Avx512::MulAdd, Avx512::Scale,
+    Avx512::AddScalar, Avx512::SubScalar, Avx512::ScalarSub, Avx512::Inverse,
+    Avx512::ReLU, Avx512::LeakyReLU, Avx512::ReLUBackward,
+    Avx512::LeakyReLUBackward, Avx512::InverseBackward, Avx512::Gather,
+    Avx512::Transpose,
+    { Avx512::Fp16ToFloat, Avx512::FloatToFp16, Avx512::Bf16ToFloat,
+      Avx512::FloatToBf16 },
+    &Avx512::AccurateMathKernels, &Avx512::FastMathKernels,
+    &Avx512::Reductions
+};
+
+const Int8GemmKernelInfo Avx512VnniInt8Gemm = {
+    Avx512Vnni::Int8GemmMR, Avx512Vnni::Int8GemmNR, 4, false,
+    Avx512Vnni::Int8GemmMicroKernel
+};
+
+const HalfKernels Avx512Bf16Half = {
+    Avx512::Fp16ToFloat, Avx512::FloatToFp16, Avx512::Bf16ToFloat,
+    Avx512Bf16::FloatToBf16
+};
+#endif
+
+const HostKernels& GetKernels(InstructionSet isa)
+{
+    switch (isa)
+    {
+#ifdef WITH_AVX512
+    case InstructionSet::Avx512:
+        return Avx512Kernels;
+#endif
+#ifdef WITH_AVX2
+    case InstructionSet::Avx2:
+        return Avx2Kernels;
+#endif
+    default:
+        return SseKernels;
+    }
+}
+
+const HostKernels* SelectBest()
+{
+    if (IsSupported(InstructionSet::Avx512))
+        return &GetKernels(InstructionSet::Avx512);
+    if (IsSupported(InstructionSet::Avx2))
+        return &GetKernels(InstructionSet::Avx2);
+    return &GetKernels(InstructionSet::Sse);
+}
+
+std::atomic<const HostKernels*>& Selected()
+{
+    static std::atomic<const HostKernels*> selected(SelectBest());
+    return selected;
+}
+
+std::atomic<MathPrecision>& SelectedPrecision()
+{
+    static std::atomic<MathPrecision> precision(MathPrecision::Accurate);
+    return precision;
+}
+} // namespace
+
+std::string InstructionSetToString(InstructionSet isa)
+{
+    switch (isa)
+    {
+    case InstructionSet::Sse:
+        return "SSE";
+    case InstructionSet::Avx2:
+        return "AVX2";
+    case InstructionSet::Avx512:
+        return "AVX512";
+    }
+    return "Unknown";
+}
+
+bool IsSupported(InstructionSet isa)
+{
+    [[maybe_unused]] const auto& features = Util::GetCpuFeatures();
+    switch (isa)
+    {
+    case InstructionSet::Sse:
+        return true;
+    case InstructionSet::Avx2:
+#ifdef WITH_AVX2
+        return features.Avx2 && features.Fma && features.F16c;
+#else
+        return false;
+#endif
+    case InstructionSet::Avx512:
+#ifdef WITH_AVX512
+        return features.Avx512F && features.Avx512Bw && features.Avx512Dq &&
+               features.Avx512Vl;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+const Int8GemmKernelInfo& GetInt8GemmKernel(const HostKernels& kernels)
+{
+#ifdef WITH_AVX512
+    if (kernels.Isa == InstructionSet::Avx512 &&
+        Util::GetCpuFeatures().Avx512Vnni)
+        return Avx512VnniInt8Gemm;
+#endif
+    return kernels.Int8Gemm;
+}
+
+const HalfKernels& GetHalfKernels(const HostKernels& kernels)
+{
+#ifdef WITH_AVX512
+    if (kernels.Isa == InstructionSet::Avx512 &&
+        Util::GetCpuFeatures().Avx512Bf16)
+        return Avx512Bf16Half;
+#endif
+    return kernels.Half;
+}
+
+const MathKernels& GetMathKernels(const HostKernels& kernels)
+{
+    return GetMathPrecision() == MathPrecision::Fast ? *kernels.FastMath
+                                                     : *kernels.AccurateMath;
+}
+
+const HostKernels& GetHostKernels()
+{
+    return *Selected().load(std::memory_order_acquire);
+}
+
+void SetInstructionSet(InstructionSet isa)
+{
+    if (!IsSupported(isa))
+        throw std::invalid_argument(
+            "Compute::Dense::Naive::SetInstructionSet - " +
+            InstructionSetToString(isa) + " is not supported on this machine");
+    Selected().store(&GetKernels(isa), std::memory_order_release);
+}
+
+InstructionSet GetInstructionSet()
+{
+    return GetHostKernels().Isa;
+}
+
+void SetMathPrecision(MathPrecision precision)
+{
+    SelectedPrecision().store(precision, std::memory_order_relaxed);
+}
+
+MathPrecision GetMathPrecision()
+{
+    return SelectedPrecision().load(std::memory_order_relaxed);
+}
+} // namespace Sapphire::Compute::Dense::Naive
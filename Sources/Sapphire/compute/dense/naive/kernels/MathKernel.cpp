@@ -0,0 +1,26 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/kernels/MathKernel.hpp>
+#include <cmath>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+float SinScalar(float x)
+{
+    return std::sin(x);
+}
+
+float CosScalar(float x)
+{
+    return std::cos(x);
+}
+
+float TanScalar(float x)
+{
+    return std::tan(x);
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,173 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2 and FMA flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx2.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/MathKernelTemplate.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+namespace
+{
+struct Vec256
+{
+    using Type = __m256;
+    using Mask = __m256;
+    static constexpr unsigned int Width = 8;
+
+    static Type Load(const float* ptr)
+    {
+        return _mm256_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm256_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return _mm256_sub_ps(a, b);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+
+    static Type Div(Type a, Type b)
+    {
+        return _mm256_div_ps(a, b);
+    }
+
+    static Type Sqrt(Type a)
+    {
+        return _mm256_sqrt_ps(a);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+
+    static Type Abs(Type a)
+    {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+    }
+
+    static Type And(Type a, Type b)
+    {
+        return _mm256_and_ps(a, b);
+    }
+
+    static Type Xor(Type a, Type b)
+    {
+        return _mm256_xor_ps(a, b);
+    }
+
+    static Mask Less(Type a, Type b)
+    {
+        return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return _mm256_blendv_ps(b, a, mask);
+    }
+
+    static bool Any(Mask mask)
+    {
+        return _mm256_movemask_ps(mask) != 0;
+    }
+
+    static Type Round(Type a)
+    {
+        return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT |
+                                  _MM_FROUND_NO_EXC);
+    }
+
+    static Type Reciprocal(Type a)
+    {
+        const auto estimate = _mm256_rcp_ps(a);
+        return _mm256_mul_ps(estimate,
+                             _mm256_fnmadd_ps(a, estimate,
+                                              _mm256_set1_ps(2.0f)));
+    }
+
+    static Type Pow2(Type n)
+    {
+        const auto biased = _mm256_add_epi32(_mm256_cvtps_epi32(n),
+                                             _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(biased, 23));
+    }
+
+    //! Split into two powers, so that each of them is normal
+    static Type ScaleByPow2(Type x, Type n)
+    {
+        const auto exponent = _mm256_cvtps_epi32(n);
+        const auto half = _mm256_srai_epi32(exponent, 1);
+        const auto bias = _mm256_set1_epi32(127);
+        const auto first = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_add_epi32(half, bias), 23));
+        const auto second = _mm256_castsi256_ps(_mm256_slli_epi32(
+            _mm256_add_epi32(_mm256_sub_epi32(exponent, half), bias), 23));
+        return _mm256_mul_ps(_mm256_mul_ps(x, first), second);
+    }
+
+    static Type Exponent(Type x)
+    {
+        const auto bits = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+        return _mm256_cvtepi32_ps(
+            _mm256_sub_epi32(bits, _mm256_set1_epi32(127)));
+    }
+
+    static Type Mantissa(Type x)
+    {
+        const auto bits = _mm256_or_si256(
+            _mm256_and_si256(_mm256_castps_si256(x),
+                             _mm256_set1_epi32(0x007fffff)),
+            _mm256_set1_epi32(0x3f800000));
+        return _mm256_castsi256_ps(bits);
+    }
+};
+} // namespace
+
+const MathKernels AccurateMathKernels = MakeMathKernels<Vec256, false>();
+const MathKernels FastMathKernels = MakeMathKernels<Vec256, true>();
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
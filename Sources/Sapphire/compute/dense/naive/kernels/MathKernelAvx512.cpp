@@ -0,0 +1,163 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx512.cpp)
+//! Exponent manipulation uses vscalefps, vgetexpps and vgetmantps, which
+//! handle subnormal numbers by themselves
+//! Zero masked forms of intrinsics are used, since unmasked ones leave the
+//! pass-through operand undefined and GCC warns about it
+
+#include <Sapphire/compute/dense/naive/kernels/MathKernelTemplate.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+namespace
+{
+struct Vec512
+{
+    using Type = __m512;
+    using Mask = __mmask16;
+    static constexpr unsigned int Width = 16;
+    static constexpr Mask All = 0xffff;
+
+    static Type Load(const float* ptr)
+    {
+        return _mm512_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm512_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm512_set1_ps(value);
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return _mm512_add_ps(a, b);
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return _mm512_sub_ps(a, b);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm512_mul_ps(a, b);
+    }
+
+    static Type Div(Type a, Type b)
+    {
+        return _mm512_div_ps(a, b);
+    }
+
+    static Type Sqrt(Type a)
+    {
+        return _mm512_maskz_sqrt_ps(All, a);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return _mm512_maskz_min_ps(All, a, b);
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return _mm512_maskz_max_ps(All, a, b);
+    }
+
+    static Type Abs(Type a)
+    {
+        return _mm512_abs_ps(a);
+    }
+
+    static Type And(Type a, Type b)
+    {
+        return _mm512_and_ps(a, b);
+    }
+
+    static Type Xor(Type a, Type b)
+    {
+        return _mm512_xor_ps(a, b);
+    }
+
+    static Mask Less(Type a, Type b)
+    {
+        return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q);
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return _mm512_mask_blend_ps(mask, b, a);
+    }
+
+    static bool Any(Mask mask)
+    {
+        return mask != 0;
+    }
+
+    static Type Round(Type a)
+    {
+        return _mm512_maskz_roundscale_ps(
+            All, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    static Type Reciprocal(Type a)
+    {
+        const auto estimate = _mm512_maskz_rcp14_ps(All, a);
+        return _mm512_mul_ps(estimate,
+                             _mm512_fnmadd_ps(a, estimate,
+                                              _mm512_set1_ps(2.0f)));
+    }
+
+    static Type Pow2(Type n)
+    {
+        return _mm512_maskz_scalef_ps(All, _mm512_set1_ps(1.0f), n);
+    }
+
+    static Type ScaleByPow2(Type x, Type n)
+    {
+        return _mm512_maskz_scalef_ps(All, x, n);
+    }
+
+    static Type Exponent(Type x)
+    {
+        return _mm512_maskz_getexp_ps(All, x);
+    }
+
+    static Type Mantissa(Type x)
+    {
+        return _mm512_maskz_getmant_ps(All, x, _MM_MANT_NORM_1_2,
+                                       _MM_MANT_SIGN_zero);
+    }
+};
+} // namespace
+
+const MathKernels AccurateMathKernels = MakeMathKernels<Vec512, false>();
+const MathKernels FastMathKernels = MakeMathKernels<Vec512, true>();
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
@@ -0,0 +1,334 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+
+#include <Sapphire/compute/dense/naive/kernels/MathKernelTemplate.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+namespace
+{
+#ifdef SAPPHIRE_SSE2
+//! SSE2 has neither FMA nor blend, so MulAdd rounds twice and Select is
+//! computed with bitwise operations
+struct Vec128
+{
+    using Type = __m128;
+    using Mask = __m128;
+    static constexpr unsigned int Width = 4;
+
+    static Type Load(const float* ptr)
+    {
+        return _mm_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return _mm_add_ps(a, b);
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return _mm_sub_ps(a, b);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    static Type Div(Type a, Type b)
+    {
+        return _mm_div_ps(a, b);
+    }
+
+    static Type Sqrt(Type a)
+    {
+        return _mm_sqrt_ps(a);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return _mm_min_ps(a, b);
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return _mm_max_ps(a, b);
+    }
+
+    static Type Abs(Type a)
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+    }
+
+    static Type And(Type a, Type b)
+    {
+        return _mm_and_ps(a, b);
+    }
+
+    static Type Xor(Type a, Type b)
+    {
+        return _mm_xor_ps(a, b);
+    }
+
+    static Mask Less(Type a, Type b)
+    {
+        return _mm_cmplt_ps(a, b);
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return _mm_cmpgt_ps(a, b);
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return _mm_cmpunord_ps(a, a);
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    static bool Any(Mask mask)
+    {
+        return _mm_movemask_ps(mask) != 0;
+    }
+
+    static Type Round(Type a)
+    {
+        return _mm_cvtepi32_ps(_mm_cvtps_epi32(a));
+    }
+
+    static Type Reciprocal(Type a)
+    {
+        const auto estimate = _mm_rcp_ps(a);
+        return _mm_mul_ps(estimate,
+                          _mm_sub_ps(_mm_set1_ps(2.0f),
+                                     _mm_mul_ps(a, estimate)));
+    }
+
+    static Type Pow2(Type n)
+    {
+        const auto biased =
+            _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127));
+        return _mm_castsi128_ps(_mm_slli_epi32(biased, 23));
+    }
+
+    //! Split into two powers, so that each of them is normal
+    static Type ScaleByPow2(Type x, Type n)
+    {
+        const auto exponent = _mm_cvtps_epi32(n);
+        const auto half = _mm_srai_epi32(exponent, 1);
+        const auto bias = _mm_set1_epi32(127);
+        const auto first = _mm_castsi128_ps(
+            _mm_slli_epi32(_mm_add_epi32(half, bias), 23));
+        const auto second = _mm_castsi128_ps(_mm_slli_epi32(
+            _mm_add_epi32(_mm_sub_epi32(exponent, half), bias), 23));
+        return _mm_mul_ps(_mm_mul_ps(x, first), second);
+    }
+
+    static Type Exponent(Type x)
+    {
+        const auto bits = _mm_srli_epi32(_mm_castps_si128(x), 23);
+        return _mm_cvtepi32_ps(_mm_sub_epi32(bits, _mm_set1_epi32(127)));
+    }
+
+    static Type Mantissa(Type x)
+    {
+        const auto bits = _mm_or_si128(
+            _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(0x007fffff)),
+            _mm_set1_epi32(0x3f800000));
+        return _mm_castsi128_ps(bits);
+    }
+};
+
+using Vec = Vec128;
+#else
+//! Single float for architectures without SSE2
+struct VecScalar
+{
+    using Type = float;
+    using Mask = bool;
+    static constexpr unsigned int Width = 1;
+
+    static Type Load(const float* ptr)
+    {
+        return *ptr;
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        *ptr = v;
+    }
+
+    static Type Broadcast(float value)
+    {
+        return value;
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return a + b;
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return a - b;
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return a * b;
+    }
+
+    static Type Div(Type a, Type b)
+    {
+        return a / b;
+    }
+
+    static Type Sqrt(Type a)
+    {
+        return std::sqrt(a);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return a * b + c;
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return a < b ? a : b;
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return a > b ? a : b;
+    }
+
+    static Type Abs(Type a)
+    {
+        return std::fabs(a);
+    }
+
+    static Type And(Type a, Type b)
+    {
+        return FromBits(ToBits(a) & ToBits(b));
+    }
+
+    static Type Xor(Type a, Type b)
+    {
+        return FromBits(ToBits(a) ^ ToBits(b));
+    }
+
+    static Mask Less(Type a, Type b)
+    {
+        return a < b;
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return a > b;
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return std::isnan(a);
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return mask ? a : b;
+    }
+
+    static bool Any(Mask mask)
+    {
+        return mask;
+    }
+
+    static Type Round(Type a)
+    {
+        return std::nearbyint(a);
+    }
+
+    static Type Reciprocal(Type a)
+    {
+        return 1.0f / a;
+    }
+
+    static Type Pow2(Type n)
+    {
+        return std::ldexp(1.0f, static_cast<int>(n));
+    }
+
+    static Type ScaleByPow2(Type x, Type n)
+    {
+        return std::ldexp(x, static_cast<int>(n));
+    }
+
+    static Type Exponent(Type x)
+    {
+        int exponent;
+        std::frexp(x, &exponent);
+        return static_cast<float>(exponent - 1);
+    }
+
+    static Type Mantissa(Type x)
+    {
+        int exponent;
+        return std::frexp(x, &exponent) * 2.0f;
+    }
+
+ private:
+    static std::uint32_t ToBits(float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static float FromBits(std::uint32_t bits)
+    {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+};
+
+using Vec = VecScalar;
+#endif
+} // namespace
+
+const MathKernels AccurateMathKernels = MakeMathKernels<Vec, false>();
+const MathKernels FastMathKernels = MakeMathKernels<Vec, true>();
+} // namespace Sapphire::Compute::Dense::Naive::Sse
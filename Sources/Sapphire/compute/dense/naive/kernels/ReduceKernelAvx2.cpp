@@ -0,0 +1,87 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2 and FMA flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx2.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/ReduceKernelTemplate.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+namespace
+{
+struct Vec256
+{
+    using Type = __m256;
+    using Mask = __m256;
+    static constexpr unsigned int Width = 8;
+
+    static Type Zero()
+    {
+        return _mm256_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm256_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm256_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return _mm256_sub_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return _mm256_blendv_ps(b, a, mask);
+    }
+};
+} // namespace
+
+const ReduceKernels Reductions = MakeReduceKernels<Vec256>();
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
@@ -0,0 +1,89 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx512.cpp)
+//! Zero masked forms of intrinsics are used (see MathKernelAvx512.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/ReduceKernelTemplate.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+namespace
+{
+struct Vec512
+{
+    using Type = __m512;
+    using Mask = __mmask16;
+    static constexpr unsigned int Width = 16;
+    static constexpr Mask All = 0xffff;
+
+    static Type Zero()
+    {
+        return _mm512_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm512_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm512_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm512_set1_ps(value);
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return _mm512_add_ps(a, b);
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return _mm512_sub_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return _mm512_maskz_min_ps(All, a, b);
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return _mm512_maskz_max_ps(All, a, b);
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q);
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return _mm512_mask_blend_ps(mask, b, a);
+    }
+};
+} // namespace
+
+const ReduceKernels Reductions = MakeReduceKernels<Vec512>();
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
@@ -0,0 +1,165 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+
+#include <Sapphire/compute/dense/naive/kernels/ReduceKernelTemplate.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+namespace
+{
+#ifdef SAPPHIRE_SSE2
+//! SSE2 has neither FMA nor blend, so MulAdd rounds twice and Select is
+//! computed with bitwise operations
+struct Vec128
+{
+    using Type = __m128;
+    using Mask = __m128;
+    static constexpr unsigned int Width = 4;
+
+    static Type Zero()
+    {
+        return _mm_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return _mm_add_ps(a, b);
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return _mm_sub_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return _mm_min_ps(a, b);
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return _mm_max_ps(a, b);
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return _mm_cmpgt_ps(a, b);
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return _mm_cmpunord_ps(a, a);
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+};
+
+using Vec = Vec128;
+#else
+//! Single float for architectures without SSE2
+struct VecScalar
+{
+    using Type = float;
+    using Mask = bool;
+    static constexpr unsigned int Width = 1;
+
+    static Type Zero()
+    {
+        return 0.0f;
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return *ptr;
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        *ptr = v;
+    }
+
+    static Type Broadcast(float value)
+    {
+        return value;
+    }
+
+    static Type Add(Type a, Type b)
+    {
+        return a + b;
+    }
+
+    static Type Sub(Type a, Type b)
+    {
+        return a - b;
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return a * b + c;
+    }
+
+    static Type Min(Type a, Type b)
+    {
+        return a < b ? a : b;
+    }
+
+    static Type Max(Type a, Type b)
+    {
+        return a > b ? a : b;
+    }
+
+    static Mask Greater(Type a, Type b)
+    {
+        return a > b;
+    }
+
+    static Mask IsNan(Type a)
+    {
+        return a != a;
+    }
+
+    static Type Select(Mask mask, Type a, Type b)
+    {
+        return mask ? a : b;
+    }
+};
+
+using Vec = VecScalar;
+#endif
+} // namespace
+
+const ReduceKernels Reductions = MakeReduceKernels<Vec>();
+} // namespace Sapphire::Compute::Dense::Naive::Sse
@@ -0,0 +1,98 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX2 and FMA flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx2.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/SmallGemmKernelTemplate.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+namespace
+{
+//! Half of 16 registers hold the output block
+struct Vec128
+{
+    using Type = __m128;
+    static constexpr unsigned int Width = 4;
+    static constexpr unsigned int Accumulators = 8;
+
+    static Type Zero()
+    {
+        return _mm_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm_fmadd_ps(a, b, c);
+    }
+};
+
+struct Vec256
+{
+    using Type = __m256;
+    static constexpr unsigned int Width = 8;
+    static constexpr unsigned int Accumulators = 8;
+
+    static Type Zero()
+    {
+        return _mm256_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm256_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm256_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+};
+
+template <unsigned int N>
+using VecFor = std::conditional_t<(N >= 8), Vec256, Vec128>;
+} // namespace
+
+const SmallGemmTable SmallGemmKernels = MakeSmallGemmTable<VecFor>();
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
@@ -0,0 +1,138 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Compiled with AVX-512 flags
+//! Should not include any headers that instantiate inline functions shared
+//! with other translation units (see GemmKernelAvx512.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/SmallGemmKernelTemplate.hpp>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+namespace
+{
+//! Half of 32 registers hold the output block
+//! Narrower vectors are used when N is less than 16, which also have access
+//! to 32 registers with AVX-512VL
+struct Vec128
+{
+    using Type = __m128;
+    static constexpr unsigned int Width = 4;
+    static constexpr unsigned int Accumulators = 16;
+
+    static Type Zero()
+    {
+        return _mm_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm_fmadd_ps(a, b, c);
+    }
+};
+
+struct Vec256
+{
+    using Type = __m256;
+    static constexpr unsigned int Width = 8;
+    static constexpr unsigned int Accumulators = 16;
+
+    static Type Zero()
+    {
+        return _mm256_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm256_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm256_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+};
+
+struct Vec512
+{
+    using Type = __m512;
+    static constexpr unsigned int Width = 16;
+    static constexpr unsigned int Accumulators = 16;
+
+    static Type Zero()
+    {
+        return _mm512_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm512_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm512_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm512_set1_ps(value);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm512_mul_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+};
+
+template <unsigned int N>
+using VecFor = std::conditional_t<
+    (N >= 16), Vec512, std::conditional_t<(N >= 8), Vec256, Vec128>>;
+} // namespace
+
+const SmallGemmTable SmallGemmKernels = MakeSmallGemmTable<VecFor>();
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
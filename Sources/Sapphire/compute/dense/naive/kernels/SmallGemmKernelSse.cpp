@@ -0,0 +1,106 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! Baseline kernels compiled without any instruction set flags
+//! (see GemmKernelSse.cpp)
+
+#include <Sapphire/compute/dense/naive/kernels/SmallGemmKernelTemplate.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SAPPHIRE_SSE2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive::Sse
+{
+namespace
+{
+#ifdef SAPPHIRE_SSE2
+//! Half of 16 registers hold the output block
+struct Vec128
+{
+    using Type = __m128;
+    static constexpr unsigned int Width = 4;
+    static constexpr unsigned int Accumulators = 8;
+
+    static Type Zero()
+    {
+        return _mm_setzero_ps();
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return _mm_loadu_ps(ptr);
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        _mm_storeu_ps(ptr, v);
+    }
+
+    static Type Broadcast(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+};
+
+template <unsigned int N>
+using VecFor = Vec128;
+#else
+struct Scalar
+{
+    using Type = float;
+    static constexpr unsigned int Width = 1;
+    static constexpr unsigned int Accumulators = 8;
+
+    static Type Zero()
+    {
+        return 0.0f;
+    }
+
+    static Type Load(const float* ptr)
+    {
+        return *ptr;
+    }
+
+    static void Store(float* ptr, Type v)
+    {
+        *ptr = v;
+    }
+
+    static Type Broadcast(float value)
+    {
+        return value;
+    }
+
+    static Type Mul(Type a, Type b)
+    {
+        return a * b;
+    }
+
+    static Type MulAdd(Type a, Type b, Type c)
+    {
+        return a * b + c;
+    }
+};
+
+template <unsigned int N>
+using VecFor = Scalar;
+#endif
+} // namespace
+
+const SmallGemmTable SmallGemmKernels = MakeSmallGemmTable<VecFor>();
+} // namespace Sapphire::Compute::Dense::Naive::Sse
@@ -0,0 +1,37 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/LossOps.hpp>
+#include <Sapphire/operations/Backward/CrossEntropyBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+constexpr int dyIdx = 0;
+constexpr int xIdx = 0;
+constexpr int logSumExpIdx = 1;
+constexpr int labelIdx = 2;
+constexpr int dxIdx = 0;
+
+CrossEntropyBackward::CrossEntropyBackward(TensorUtil::TensorData dx,
+                                           TensorUtil::TensorData dy,
+                                           TensorUtil::TensorData x,
+                                           TensorUtil::TensorData logSumExp,
+                                           TensorUtil::TensorData label)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) },
+                      { std::move(x), std::move(logSumExp),
+                        std::move(label) },
+                      {})
+{
+}
+
+void CrossEntropyBackward::m_runBackProp()
+{
+    auto dx = m_dxVector[dxIdx];
+    Compute::CrossEntropyBackward(dx, m_dyVector[dyIdx], m_constants[xIdx],
+                                  m_constants[logSumExpIdx],
+                                  m_constants[labelIdx]);
+}
+} // namespace Sapphire::BackProp
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <Sapphire/Model.hpp>
 #include <Sapphire/operations/Backward/LinearBackward.hpp>
+#include <Sapphire/compute/ActivationOps.hpp>
 #include <Sapphire/compute/Initialize.hpp>
 
 namespace Sapphire::BackProp
@@ -16,13 +17,18 @@ LinearBackProp::LinearBackProp(TensorUtil::TensorData dx,
                                TensorUtil::TensorData weight,
                                TensorUtil::TensorData bias,
                                TensorUtil::TensorData x,
+                               TensorUtil::TensorData y,
                                Optimizer::Optimizer* optimizer,
-                               int batchSize)
+                               int batchSize,
+                               Compute::GemmActivation activation,
+                               float negativeSlope)
     : BackPropWrapper({ std::move(dx) }, { std::move(dy) },
                       { std::move(weight), std::move(bias) },
-                      { std::move(x) },
+                      { std::move(x), std::move(y) },
                       {}, std::move(optimizer)),
-      m_batchSize(batchSize)
+      m_batchSize(batchSize),
+      m_activation(activation),
+      m_negativeSlope(negativeSlope)
 {
 }
 
@@ -30,51 +36,61 @@ void LinearBackProp::m_runBackProp()
 {
     auto weight = m_trainableData[weightIdx];
     auto bias = m_trainableData[biasIdx];
+    const auto dz = m_activationBackProp();
 
-    m_backProp(weight);
-    m_updateWeight(weight);
-    m_updateBias(bias);
+    m_backProp(dz, weight);
+    m_updateWeight(dz, weight);
+    m_updateBias(dz, bias);
 }
 
-void LinearBackProp::m_backProp(TensorUtil::TensorData& weight)
+TensorUtil::TensorData LinearBackProp::m_activationBackProp() const
+{
+    const TensorUtil::TensorData& dy = m_dyVector[dyIdx];
+    if (m_activation == Compute::GemmActivation::None)
+        return dy;
+
+    //! Output after activation is positive exactly where the output before
+    //! activation is positive, so y can be used in place of it
+    const TensorUtil::TensorData& y = m_constants[yIdx];
+    TensorUtil::TensorData dz(dy.GetShape(), dy.GetType(), dy.GetDevice());
+    dz.SetMode(dy.Mode());
+
+    if (m_activation == Compute::GemmActivation::ReLU)
+        Compute::ReLUBackward(dz, dy, y);
+    else
+        Compute::LeakyReLUBackward(dz, dy, y, m_negativeSlope);
+    return dz;
+}
+
+void LinearBackProp::m_backProp(const TensorUtil::TensorData& dz,
+                                TensorUtil::TensorData& weight)
 {
     TensorUtil::TensorData& dx = m_dxVector[dxIdx];
-    TensorUtil::TensorData& dy = m_dyVector[dyIdx];
 
-    Compute::Gemm(dx, dy, weight);
+    Compute::Gemm(dx, dz, weight);
 }
 
-void LinearBackProp::m_updateWeight(TensorUtil::TensorData& weight) const
+void LinearBackProp::m_updateWeight(const TensorUtil::TensorData& dz,
+                                    TensorUtil::TensorData& weight) const
 {
-    const TensorUtil::TensorData& dy = m_dyVector[dyIdx];
     const TensorUtil::TensorData& x = m_constants[xIdx];
-    TensorUtil::TensorData xTranspose(x.GetShape().GetTranspose(),
-                                      x.GetType(),
-                                      x.GetDevice());
-    TensorUtil::TensorData dyTranspose(dy.GetShape().GetTranspose(),
-                                       dy.GetType(), dy.GetDevice());
     TensorUtil::TensorData dw(weight.GetShape().GetTranspose(),
                               weight.GetType(), weight.GetDevice());
 
-    xTranspose.SetMode(x.Mode());
-    dyTranspose.SetMode(dy.Mode());
     dw.SetMode(weight.Mode());
 
-    Compute::Transpose(xTranspose, x);
-    Compute::Transpose(dyTranspose, dy);
-    Compute::Initialize::Zeros(dw);
-    Compute::Gemm(dw, dyTranspose, x);
-    Compute::Scale(dw, dw, 1.0f / static_cast<float>(m_batchSize));
+    Compute::Gemm(dw, dz, x, true, false,
+                  1.0f / static_cast<float>(m_batchSize), 0.0f);
 
     m_optimizer->operator()(weight, dw);
 }
 
-void LinearBackProp::m_updateBias(TensorUtil::TensorData& bias) const
+void LinearBackProp::m_updateBias(const TensorUtil::TensorData& dz,
+                                  TensorUtil::TensorData& bias) const
 {
-    const TensorUtil::TensorData& dy = m_dyVector[dyIdx];
     TensorUtil::TensorData ones(Shape({ 1, m_batchSize }),
-                                dy.GetType(),
-                                dy.GetDevice());
+                                dz.GetType(),
+                                dz.GetDevice());
     TensorUtil::TensorData dB(bias.GetShape(), bias.GetType(),
                               bias.GetDevice());
 
@@ -82,10 +98,8 @@ void LinearBackProp::m_updateBias(TensorUtil::TensorData& bias) const
     ones.SetMode(bias.Mode());
 
     Compute::Initialize::Ones(ones);
-    Compute::Initialize::Zeros(dB);
-    Compute::Gemm(dB, ones, dy);
-
-    Compute::Scale(dB, dB, 1.0f / static_cast<float>(m_batchSize));
+    Compute::Gemm(dB, ones, dz, false, false,
+                  1.0f / static_cast<float>(m_batchSize), 0.0f);
     m_optimizer->operator()(bias, dB);
 }
 } // namespace Sapphire::BackProp
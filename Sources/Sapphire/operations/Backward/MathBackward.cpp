@@ -15,20 +15,8 @@ MulBackProp::MulBackProp(const TensorUtil::TensorData& a,
                          const TensorUtil::TensorData& b,
                          TensorUtil::TensorData db, TensorUtil::TensorData dy)
     : BackPropWrapper({ std::move(da), std::move(db) }, { std::move(dy) },
-                      { a, b },
-                      { TensorUtil::TensorData(a.GetShape().GetTranspose(),
-                                               a.GetType(),
-                                               a.GetDevice()),
-                        TensorUtil::TensorData(b.GetShape().GetTranspose(),
-                                               b.GetType(),
-                                               b.GetDevice()) })
+                      { a, b }, {})
 {
-    auto& aData = m_constants[0];
-    auto& bData = m_constants[1];
-    auto& transposedA = m_mutables[0];
-    auto& transposedB = m_mutables[1];
-    transposedA.SetMode(aData.Mode());
-    transposedB.SetMode(bData.Mode());
 }
 
 void MulBackProp::m_runBackProp()
@@ -39,14 +27,10 @@ void MulBackProp::m_runBackProp()
 
     auto& a = m_constants[0];
     auto& b = m_constants[1];
-    auto& transposedA = m_mutables[0];
-    auto& transposedB = m_mutables[1];
 
-    Compute::Transpose(transposedA, a);
-    Compute::Transpose(transposedB, b);
-
-    Compute::Gemm(da, dy, transposedB);
-    Compute::Gemm(db, transposedA, dy);
+    //! Gradients are accumulated into da and db (beta = 1)
+    Compute::Gemm(da, dy, b, false, true, 1.0f, 1.0f);
+    Compute::Gemm(db, a, dy, true, false, 1.0f, 1.0f);
 }
 
 AddBackProp::AddBackProp(TensorUtil::TensorData da, TensorUtil::TensorData db,
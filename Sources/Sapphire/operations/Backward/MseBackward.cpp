@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
 #include <Sapphire/operations/Backward/MSEBackward.hpp>
 
 namespace Sapphire::BackProp
@@ -28,6 +29,14 @@ void MSEBackward::m_runBackProp()
     auto x = m_constants[xIdx];
     auto label = m_constants[labelIdx];
     auto dx = m_dxVector[dxIdx];
+
+    if (dx.Mode() == DeviceType::Host)
+    {
+        using namespace Compute::Fused;
+        Assign(dx, (Input(label) - Input(x)) * -2.0f);
+        return;
+    }
+
     TensorUtil::TensorData diff(label.GetShape(), label.GetType(),
                                 label.GetDevice(), false);
     diff.SetMode(label.Mode());
@@ -87,7 +87,9 @@ Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter, Tensor& bias)
 
     Util::ChangeTensorDataDimension(4, x, dx, y, dy);
 
-    Compute::Initialize::Zeros(y);
+    if (m_observer)
+        m_observer->Observe(x);
+
     Compute::Conv2DForward(y, x, filterData, strideRows, strideCols,
                            dilationRows, dilationCols, rowPadding, colPadding);
 
@@ -142,7 +144,9 @@ Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter)
 
     Util::ChangeTensorDataDimension(4, x, dx, y, dy);
 
-    Compute::Initialize::Zeros(y);
+    if (m_observer)
+        m_observer->Observe(x);
+
     Compute::Conv2DForward(y, x, filterData, strideRows, strideCols,
                            dilationRows, dilationCols, rowPadding, colPadding);
 
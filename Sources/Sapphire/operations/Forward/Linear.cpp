@@ -17,12 +17,15 @@ namespace Sapphire::NN
 {
 Linear::Linear(int inputFeatureSize, int outputFeatureSize,
                Optimizer::Optimizer* optimizer,
-               CudaDevice device, bool isSparse)
+               CudaDevice device, bool isSparse,
+               Compute::GemmActivation activation, float negativeSlope)
     : Unit(optimizer),
       m_inputs(inputFeatureSize),
       m_outputs(outputFeatureSize),
       m_device(std::move(device)),
-      m_isSparse(isSparse)
+      m_isSparse(isSparse),
+      m_activation(activation),
+      m_negativeSlope(negativeSlope)
 {
     if (m_isSparse)
         throw std::invalid_argument(
@@ -52,36 +55,24 @@ Tensor Linear::operator()(Tensor& x, Tensor weight, Tensor bias)
     auto yData = yDesc.GetForwardData();
     auto dyData = yDesc.GetBackwardData();
 
-    auto transposedWeight =
-        TensorUtil::TensorData(Shape({ m_outputs, m_inputs }), Type::Dense,
-                               weight.GetDevice());
-    transposedWeight.SetMode(weight.Mode());
-
-    auto ones = TensorUtil::TensorData(bias.GetShape().GetTranspose(),
-                                       Type::Dense,
-                                       bias.GetDevice());
-    ones.SetMode(bias.Mode());
-    Compute::Initialize::Ones(ones);
-
     //! Change the dimension of the data to match the requirements
     Util::ChangeTensorDataDimension(2, xData, dxData, yData, dyData);
 
-    auto expandedBias = TensorUtil::TensorData(
-        yData.GetShape(), Type::Dense, bias.GetDevice());
-    expandedBias.SetMode(bias.Mode());
+    if (m_observer)
+        m_observer->Observe(xData);
 
-    Compute::Initialize::Zeros(expandedBias);
-    Compute::Transpose(transposedWeight, weightData);
-    Compute::Gemm(expandedBias, ones,
-                  biasData);
-    TensorUtil::TensorData::DeepCopy(yData, expandedBias);
-    Compute::Gemm(yData, xData, transposedWeight);
+    //! Weight is laid out as (outputs x inputs), same as the gradient
+    //! computed by LinearBackProp
+    //! Bias and activation are applied while computing the product, so y is
+    //! written only once
+    Compute::GemmBiasActivation(yData, xData, weightData, biasData, false,
+                                true, m_activation, m_negativeSlope);
 
     auto* backPropWrapper =
         new BackProp::LinearBackProp(
-            dxData, dyData, weightData, biasData, xData,
+            dxData, dyData, weightData, biasData, xData, yData,
             m_optimizer,
-            xData.Rows());
+            xData.Rows(), m_activation, m_negativeSlope);
     Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
                       std::make_tuple(&yDesc));
     return Tensor(yKey);
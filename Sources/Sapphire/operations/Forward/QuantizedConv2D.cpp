@@ -0,0 +1,149 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/QuantizedOps.hpp>
+#include <Sapphire/operations/Forward/QuantizedConv2D.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+
+namespace Sapphire::NN
+{
+QuantizedConv2D::QuantizedConv2D(int yChannels, int xChannels,
+                                 std::pair<int, int> inputSize,
+                                 std::pair<int, int> filterSize,
+                                 std::pair<int, int> stride,
+                                 std::pair<int, int> padSize,
+                                 std::pair<int, int> dilation, Tensor filter,
+                                 TensorUtil::QuantizationParams inputParams)
+    : m_inputSize(inputSize),
+      m_filterSize(filterSize),
+      m_stride(stride),
+      m_padSize(padSize),
+      m_dilation(dilation),
+      m_yChannels(yChannels),
+      m_xChannels(xChannels),
+      m_inputParams(inputParams)
+{
+    const auto [filterRows, filterCols] = filterSize;
+    const auto [dilationRows, dilationCols] = dilation;
+    const auto [inputRows, inputCols] = inputSize;
+    const auto [rowPadding, colPadding] = padSize;
+    const auto [strideRows, strideCols] = stride;
+
+    m_yRows =
+        (inputRows + 2 * rowPadding - dilationRows * (filterRows - 1) - 1) /
+        strideRows +
+        1;
+    m_yCols =
+        (inputCols + 2 * colPadding - dilationCols * (filterCols - 1) - 1) /
+        strideCols +
+        1;
+    if (m_yRows <= 0 || m_yCols <= 0)
+        throw std::invalid_argument("NN::QuantizedConv2D - invalid argument");
+
+    auto filterData = ModelManager::CurModel()
+                      .GetDescriptor(filter.TensorDescriptorKey())
+                      .GetForwardData();
+    const Shape filterShape({ m_yChannels, m_xChannels, filterRows,
+                              filterCols });
+    if (filterData.GetShape() != filterShape)
+        throw std::invalid_argument(
+            "NN::QuantizedConv2D - filter should have shape of (yC, xC, "
+            "filterH, filterW)");
+
+    //! Each output channel of the filter is quantized separately, and the
+    //! filter is packed as transposed (yC x xC * filterH * filterW) operand
+    TensorUtil::TensorData hostFilter(filterShape, Type::Dense);
+    hostFilter.SetData(filterData.GetDataCopy());
+    m_filter = TensorUtil::QuantizedTensorData::QuantizePerChannel(
+        hostFilter, TensorUtil::QuantizedType::Int8, 0);
+    m_filter.Prepack(true);
+}
+
+QuantizedConv2D::QuantizedConv2D(int yChannels, int xChannels,
+                                 std::pair<int, int> inputSize,
+                                 std::pair<int, int> filterSize,
+                                 std::pair<int, int> stride,
+                                 std::pair<int, int> padSize,
+                                 std::pair<int, int> dilation, Tensor filter,
+                                 Tensor bias,
+                                 TensorUtil::QuantizationParams inputParams)
+    : QuantizedConv2D(yChannels, xChannels, inputSize, filterSize, stride,
+                      padSize, dilation, filter, inputParams)
+{
+    auto biasData = ModelManager::CurModel()
+                    .GetDescriptor(bias.TensorDescriptorKey())
+                    .GetForwardData();
+    if (biasData.GetShape().Size() != m_yChannels)
+        throw std::invalid_argument(
+            "NN::QuantizedConv2D - Bias should have yChannels elements");
+
+    m_useBias = true;
+    m_bias = TensorUtil::TensorData(Shape({ m_yChannels }), Type::Dense, true);
+    m_bias.SetData(biasData.GetDataCopy());
+}
+
+Tensor QuantizedConv2D::operator()(Tensor& tensor)
+{
+    if (tensor.Mode() != DeviceType::Host)
+        throw std::invalid_argument(
+            "NN::QuantizedConv2D - Quantized units run on host only");
+    auto& model = ModelManager::CurModel();
+
+    auto& xDesc = model.GetDescriptor(tensor.TensorDescriptorKey());
+    m_checkArguments({ &xDesc });
+    const auto yKey = m_registerOutputTensor(xDesc);
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(DeviceType::Host);
+
+    auto [dilationRows, dilationCols] = m_dilation;
+    auto [rowPadding, colPadding] = m_padSize;
+    auto [strideRows, strideCols] = m_stride;
+
+    auto x = xDesc.GetForwardData();
+    auto y = yDesc.GetForwardData();
+    Util::ChangeTensorDataDimension(4, x, y);
+
+    const auto xQuantized = TensorUtil::QuantizedTensorData::Quantize(
+        x, TensorUtil::QuantizedType::UInt8, m_inputParams);
+    if (m_useBias)
+        Compute::QuantizedConv2DForward(y, xQuantized, m_filter, m_bias,
+                                        strideRows, strideCols, dilationRows,
+                                        dilationCols, rowPadding, colPadding);
+    else
+        Compute::QuantizedConv2DForward(y, xQuantized, m_filter, strideRows,
+                                        strideCols, dilationRows,
+                                        dilationCols, rowPadding, colPadding);
+    return Tensor(yKey);
+}
+
+int QuantizedConv2D::m_registerOutputTensor(
+    const TensorUtil::TensorDescriptor& xDesc) const
+{
+    auto& model = ModelManager::CurModel();
+    Shape yShape = xDesc.GetShape();
+    yShape.SetCol(m_yCols);
+    yShape.SetRow(m_yRows);
+    yShape[yShape.Dim() - 3] = m_yChannels;
+    return model.RegisterTensorDescriptor(yShape, xDesc.GetType(),
+                                          xDesc.GetDevice());
+}
+
+void QuantizedConv2D::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto xShape = arguments.at(0)->GetShape();
+    const auto [xRows, xCols] = m_inputSize;
+
+    if (xShape.Dim() < 4)
+        throw std::invalid_argument(
+            "NN::QuantizedConv2D - input should have shape of (*, C, H, W)");
+    if (xShape.At(xShape.Dim() - 3) != m_xChannels ||
+        xShape.Rows() != xRows || xShape.Cols() != xCols)
+        throw std::invalid_argument(
+            "NN::QuantizedConv2D - shape of x does not match");
+}
+} // namespace Sapphire::NN
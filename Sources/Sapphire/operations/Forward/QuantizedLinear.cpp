@@ -0,0 +1,95 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/QuantizedOps.hpp>
+#include <Sapphire/operations/Forward/QuantizedLinear.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+
+namespace Sapphire::NN
+{
+QuantizedLinear::QuantizedLinear(int inputFeatureSize, int outputFeatureSize,
+                                 Tensor weight, Tensor bias,
+                                 TensorUtil::QuantizationParams inputParams,
+                                 Compute::GemmActivation activation,
+                                 float negativeSlope)
+    : m_inputs(inputFeatureSize),
+      m_outputs(outputFeatureSize),
+      m_inputParams(inputParams),
+      m_activation(activation),
+      m_negativeSlope(negativeSlope)
+{
+    auto& model = ModelManager::CurModel();
+    auto weightData =
+        model.GetDescriptor(weight.TensorDescriptorKey()).GetForwardData();
+    auto biasData =
+        model.GetDescriptor(bias.TensorDescriptorKey()).GetForwardData();
+    if (weightData.GetShape().Rows() != m_outputs ||
+        weightData.GetShape().Cols() != m_inputs ||
+        weightData.GetShape().Size() != m_outputs * m_inputs)
+        throw std::invalid_argument(
+            "NN::QuantizedLinear - weight should have shape of (outputs, "
+            "inputs)");
+    if (biasData.GetShape().Size() != m_outputs)
+        throw std::invalid_argument(
+            "NN::QuantizedLinear - bias should have outputs elements");
+
+    //! Weight is laid out as (outputs x inputs), so each row is quantized as
+    //! an output channel and packed as transposed operand
+    TensorUtil::TensorData hostWeight(Shape({ m_outputs, m_inputs }),
+                                      Type::Dense);
+    hostWeight.SetData(weightData.GetDataCopy());
+    m_weight = TensorUtil::QuantizedTensorData::QuantizePerChannel(
+        hostWeight, TensorUtil::QuantizedType::Int8, 0);
+    m_weight.Prepack(true);
+
+    m_bias = TensorUtil::TensorData(Shape({ m_outputs }), Type::Dense, true);
+    m_bias.SetData(biasData.GetDataCopy());
+}
+
+Tensor QuantizedLinear::operator()(Tensor& x)
+{
+    if (x.Mode() != DeviceType::Host)
+        throw std::invalid_argument(
+            "NN::QuantizedLinear - Quantized units run on host only");
+    auto& model = ModelManager::CurModel();
+
+    auto& xDesc = model.GetDescriptor(x.TensorDescriptorKey());
+    m_checkArguments({ &xDesc });
+    const auto yKey = m_registerOutputTensor(xDesc);
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(DeviceType::Host);
+
+    auto xData = xDesc.GetForwardData();
+    auto yData = yDesc.GetForwardData();
+    Util::ChangeTensorDataDimension(2, xData, yData);
+
+    const auto xQuantized = TensorUtil::QuantizedTensorData::Quantize(
+        xData, TensorUtil::QuantizedType::UInt8, m_inputParams);
+    Compute::QuantizedGemmBiasActivation(yData, xQuantized, m_weight, m_bias,
+                                         true, m_activation,
+                                         m_negativeSlope);
+    return Tensor(yKey);
+}
+
+int QuantizedLinear::m_registerOutputTensor(
+    const TensorUtil::TensorDescriptor& xDesc) const
+{
+    auto& model = ModelManager::CurModel();
+    Shape yShape = xDesc.GetShape();
+    yShape[yShape.Dim() - 1] = m_outputs;
+    return model.RegisterTensorDescriptor(yShape, xDesc.GetType(),
+                                          xDesc.GetDevice());
+}
+
+void QuantizedLinear::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto input = arguments.at(0);
+    if (input->GetShape().Cols() != m_inputs)
+        throw std::invalid_argument("NN::QuantizedLinear - Shape mismatch");
+}
+} // namespace Sapphire::NN
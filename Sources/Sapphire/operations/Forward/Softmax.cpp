@@ -22,11 +22,12 @@ Tensor SoftMax(const Tensor& input)
         xDesc.GetDevice());
     auto& yDesc = model.GetDescriptor(yDescKey);
 
-    auto x = xDesc.GetForwardData().CreateCopy();
+    auto x = xDesc.GetForwardData();
     auto dx = xDesc.GetBackwardData();
     auto y = yDesc.GetForwardData();
     auto dy = yDesc.GetBackwardData();
-    auto* wrapper = new BackProp::SoftMaxBackward(dx, dy, x);
+    //! Gradient is computed from y, which shares data computed below
+    auto* wrapper = new BackProp::SoftMaxBackward(dx, dy, y);
     Util::SaveHistory(wrapper, std::make_tuple(&xDesc),
                       std::make_tuple(&yDesc));
 
@@ -0,0 +1,62 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/IndexingOps.hpp>
+#include <Sapphire/compute/LossOps.hpp>
+#include <Sapphire/operations/Backward/CrossEntropyBackward.hpp>
+#include <Sapphire/operations/Loss/CrossEntropy.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+#include <string>
+
+namespace Sapphire::NN::Loss
+{
+Tensor CrossEntropy(const Tensor& input, const Tensor& label)
+{
+    auto mode = input.Mode();
+    if (!Util::CheckModeEquality(mode, label))
+        throw std::invalid_argument(
+            "NN::Loss::CrossEntropy - Device mode inequality");
+    if (mode != DeviceType::Host)
+        throw std::invalid_argument(
+            "NN::Loss::CrossEntropy - Only host tensors are supported");
+    Model& model = ModelManager::CurModel();
+
+    auto& xDesc = model.GetDescriptor(input.TensorDescriptorKey());
+    auto& labelDesc = model.GetDescriptor(label.TensorDescriptorKey());
+
+    const auto yDescKey = model.RegisterTensorDescriptor(
+        Shape({ 1 }), xDesc.GetType(), xDesc.GetCudaDevice());
+    auto& yDesc = model.GetDescriptor(yDescKey);
+    yDesc.SetMode(mode);
+
+    auto xData = xDesc.GetForwardData();
+    auto labelData = labelDesc.GetForwardData();
+    auto yData = yDesc.GetForwardData();
+    auto dyData = yDesc.GetBackwardData();
+    auto dxData = xDesc.GetBackwardData();
+
+    const auto rows = xData.Cols() == 0 ? 0 : xData.Size() / xData.Cols();
+    if (labelData.Size() != rows)
+        throw std::invalid_argument(
+            "NN::Loss::CrossEntropy - Expected " + std::to_string(rows) +
+            " labels, given : " + std::to_string(labelData.Size()));
+
+    //! Only class indices and log-sum-exp of each row are kept for the
+    //! backward pass
+    TensorUtil::TensorData classes(Shape({ rows }), xDesc.GetType(),
+                                   DataType::Int32);
+    TensorUtil::TensorData logSumExp(Shape({ rows }), xDesc.GetType());
+    Compute::Cast(classes, labelData);
+    Compute::CrossEntropy(yData, logSumExp, xData, classes);
+
+    auto* wrapper = new BackProp::CrossEntropyBackward(
+        dxData, dyData, xData, logSumExp, classes);
+    Util::SaveHistory(wrapper, std::make_tuple(&xDesc, &labelDesc),
+                      std::make_tuple(&yDesc));
+    return Tensor(yDescKey);
+}
+} // namespace Sapphire::NN::Loss
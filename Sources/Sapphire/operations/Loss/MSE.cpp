@@ -6,6 +6,7 @@
 
 #include <Sapphire/Model.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
 #include <Sapphire/operations/Backward/MSEBackward.hpp>
 #include <Sapphire/operations/Loss/MSE.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
@@ -28,11 +29,6 @@ Tensor MSE(const Tensor& input, const Tensor& label)
     auto& yDesc = model.GetDescriptor(yDescKey);
     yDesc.SetMode(mode);
 
-    TensorUtil::TensorData diff(
-        input.GetShape(), xDesc.GetType(),
-        xDesc.GetCudaDevice());
-    diff.SetMode(mode);
-
     auto xData = xDesc.GetForwardData();
     auto labelData = labelDesc.GetForwardData();
     auto yData = yDesc.GetForwardData();
@@ -41,10 +37,23 @@ Tensor MSE(const Tensor& input, const Tensor& label)
     Util::SaveHistory(wrapper, std::make_tuple(&xDesc, &labelDesc),
                       std::make_tuple(&yDesc));
 
-    Util::ChangeTensorDataDimension(1, xData, labelData, yData, dxData, diff);
-    Compute::Sub(diff, labelData, xData);
-    Compute::Pow(diff, diff, 2.0f);
-    Compute::Mean(yData, diff, 0);
+    Util::ChangeTensorDataDimension(1, xData, labelData, yData, dxData);
+    if (mode == DeviceType::Host)
+    {
+        //! Squared difference is reduced without being materialized
+        using namespace Compute::Fused;
+        Mean(yData, Pow(Input(labelData) - Input(xData), 2.0f));
+    }
+    else
+    {
+        TensorUtil::TensorData diff(input.GetShape(), xDesc.GetType(),
+                                    xDesc.GetCudaDevice());
+        diff.SetMode(mode);
+        Util::ChangeTensorDataDimension(1, diff);
+        Compute::Sub(diff, labelData, xData);
+        Compute::Pow(diff, diff, 2.0f);
+        Compute::Mean(yData, diff, 0);
+    }
     return Tensor(yDescKey);
 }
 } // namespace Sapphire::NN::Loss
@@ -0,0 +1,162 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/operations/Quantization/Observer.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace Sapphire::Quantization
+{
+namespace
+{
+std::pair<float, float> MinMax(const float* data, std::size_t size)
+{
+    const auto [min, max] = std::minmax_element(data, data + size);
+    return { *min, *max };
+}
+
+int BinIndex(float value, float min, float binWidth, int bins)
+{
+    if (binWidth <= 0.0f)
+        return 0;
+    const auto index = static_cast<int>((value - min) / binWidth);
+    return std::clamp(index, 0, bins - 1);
+}
+} // namespace
+
+void Observer::Observe(TensorData& x)
+{
+    if (x.Mode() == DeviceType::Host)
+    {
+        Observe(x.HostRawPtr(), static_cast<std::size_t>(x.GetShape().Size()));
+        return;
+    }
+
+    const auto data = x.GetDataCopy();
+    Observe(data.data(), data.size());
+}
+
+void Observer::Observe(const float* data, std::size_t size)
+{
+    if (size == 0)
+        return;
+    m_observe(data, size);
+    m_count += size;
+}
+
+QuantizationParams Observer::GetParams(QuantizedType type) const
+{
+    if (m_count == 0)
+        throw std::runtime_error(
+            "Quantization::Observer::GetParams - Nothing was observed");
+    const auto [min, max] = m_range();
+    return ChooseQuantizationParams(min, max, type);
+}
+
+void Observer::Reset()
+{
+    m_count = 0;
+    m_reset();
+}
+
+void MinMaxObserver::m_observe(const float* data, std::size_t size)
+{
+    const auto [min, max] = MinMax(data, size);
+    m_min = Count() == 0 ? min : std::min(m_min, min);
+    m_max = Count() == 0 ? max : std::max(m_max, max);
+}
+
+std::pair<float, float> MinMaxObserver::m_range() const
+{
+    return { m_min, m_max };
+}
+
+void MinMaxObserver::m_reset()
+{
+    m_min = 0.0f;
+    m_max = 0.0f;
+}
+
+HistogramObserver::HistogramObserver(int bins, float coverage)
+    : m_coverage(coverage),
+      m_histogram(bins, 0.0)
+{
+    if (bins <= 0 || coverage <= 0.0f || coverage > 1.0f)
+        throw std::invalid_argument(
+            "Quantization::HistogramObserver - bins should be positive and "
+            "coverage should be in (0, 1]");
+}
+
+void HistogramObserver::m_observe(const float* data, std::size_t size)
+{
+    const auto [min, max] = MinMax(data, size);
+    if (Count() == 0)
+    {
+        m_min = min;
+        m_max = max;
+    }
+    else
+        m_extend(min, max);
+
+    const auto bins = static_cast<int>(m_histogram.size());
+    const auto binWidth = (m_max - m_min) / static_cast<float>(bins);
+    for (std::size_t i = 0; i < size; ++i)
+        m_histogram[BinIndex(data[i], m_min, binWidth, bins)] += 1.0;
+}
+
+void HistogramObserver::m_extend(float min, float max)
+{
+    const auto newMin = std::min(m_min, min);
+    const auto newMax = std::max(m_max, max);
+    if (newMin == m_min && newMax == m_max)
+        return;
+
+    //! Counts of each bin are moved to the new bin containing its center
+    const auto bins = static_cast<int>(m_histogram.size());
+    const auto binWidth = (m_max - m_min) / static_cast<float>(bins);
+    const auto newBinWidth = (newMax - newMin) / static_cast<float>(bins);
+    std::vector<double> histogram(bins, 0.0);
+    for (int i = 0; i < bins; ++i)
+    {
+        const auto center =
+            m_min + (static_cast<float>(i) + 0.5f) * binWidth;
+        histogram[BinIndex(center, newMin, newBinWidth, bins)] +=
+            m_histogram[i];
+    }
+
+    m_histogram = std::move(histogram);
+    m_min = newMin;
+    m_max = newMax;
+}
+
+std::pair<float, float> HistogramObserver::m_range() const
+{
+    const auto bins = static_cast<int>(m_histogram.size());
+    const auto binWidth = (m_max - m_min) / static_cast<float>(bins);
+    double total = 0.0;
+    for (const auto count : m_histogram)
+        total += count;
+    const auto tail = total * (1.0 - static_cast<double>(m_coverage)) / 2.0;
+
+    int lowBin = 0;
+    for (double sum = m_histogram[0]; sum <= tail && lowBin < bins - 1;)
+        sum += m_histogram[++lowBin];
+
+    int highBin = bins - 1;
+    for (double sum = m_histogram[bins - 1]; sum <= tail && highBin > lowBin;)
+        sum += m_histogram[--highBin];
+
+    return { m_min + static_cast<float>(lowBin) * binWidth,
+             m_min + static_cast<float>(highBin + 1) * binWidth };
+}
+
+void HistogramObserver::m_reset()
+{
+    std::fill(m_histogram.begin(), m_histogram.end(), 0.0);
+    m_min = 0.0f;
+    m_max = 0.0f;
+}
+} // namespace Sapphire::Quantization
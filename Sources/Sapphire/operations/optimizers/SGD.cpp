@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
 
 namespace Sapphire::Optimizer
 {
@@ -21,9 +22,22 @@ SGD::SGD(SGD&& sgd) noexcept
 
 void SGD::operator()(TensorData& z, const TensorData& dz)
 {
-    TensorData temp(dz.GetShape(), dz.GetType(), dz.GetDevice());
-    temp.SetMode(dz.Mode());
-    Compute::Scale(temp, dz, m_learningRate);
-    Compute::Sub(z, z, temp);
+    //! Gradients larger than z are reduced by Compute::Sub, which fused
+    //! assignment does not do
+    if (z.Mode() == DeviceType::Host &&
+        Compute::Fused::BroadcastShape(z.GetShape(), dz.GetShape()) ==
+        z.GetShape())
+    {
+        //! Updated in single pass without temporary for scaled gradient
+        using namespace Compute::Fused;
+        Assign(z, Input(z) - Input(dz) * m_learningRate);
+    }
+    else
+    {
+        TensorData temp(dz.GetShape(), dz.GetType(), dz.GetDevice());
+        temp.SetMode(dz.Mode());
+        Compute::Scale(temp, dz, m_learningRate);
+        Compute::Sub(z, z, temp);
+    }
 }
 }
@@ -0,0 +1,55 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveHalf.hpp>
+#include <Sapphire/tensor/HalfTensorData.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::TensorUtil
+{
+namespace
+{
+void CheckHost(const TensorData& data, const std::string& caller)
+{
+    if (data.Mode() != DeviceType::Host)
+        throw std::invalid_argument("HalfTensorData::" + caller +
+                                    " - Data must be on host");
+}
+} // namespace
+
+HalfTensorData::HalfTensorData(Shape shape, HalfType type)
+    : m_shape(std::move(shape)),
+      m_type(type),
+      m_data(m_shape.Size(), 0)
+{
+}
+
+HalfTensorData HalfTensorData::FromFloat(const TensorData& x, HalfType type,
+                                         int numThreads)
+{
+    CheckHost(x, "FromFloat");
+    HalfTensorData half(x.GetShape(), type);
+    Compute::Dense::Naive::FloatToHalf(
+        static_cast<unsigned int>(half.m_data.size()), half.m_data.data(),
+        x.HostRawPtr(), half.IsBFloat16(), numThreads);
+    return half;
+}
+
+void HalfTensorData::ToFloat(TensorData& y, int numThreads) const
+{
+    CheckHost(y, "ToFloat");
+    if (y.GetShape().Size() != m_shape.Size())
+        throw std::invalid_argument(
+            "HalfTensorData::ToFloat - Size mismatch Given size : (" +
+            std::to_string(y.GetShape().Size()) + ") expected size : (" +
+            std::to_string(m_shape.Size()) + ")");
+
+    Compute::Dense::Naive::HalfToFloat(
+        static_cast<unsigned int>(m_data.size()), y.HostMutableRawPtr(),
+        m_data.data(), IsBFloat16(), numThreads);
+}
+} // namespace Sapphire::TensorUtil
@@ -0,0 +1,190 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/tensor/QuantizedTensorData.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::TensorUtil
+{
+namespace
+{
+void CheckHost(const TensorData& data, const std::string& caller)
+{
+    if (data.Mode() != DeviceType::Host)
+        throw std::invalid_argument("QuantizedTensorData::" + caller +
+                                    " - Data must be on host");
+}
+
+//! Number of elements between consecutive elements of the channel axis
+std::size_t InnerSize(const Shape& shape, int channelAxis)
+{
+    std::size_t size = 1;
+    for (int dim = channelAxis + 1; dim < shape.Dim(); ++dim)
+        size *= static_cast<std::size_t>(shape.At(dim));
+    return size;
+}
+
+std::int8_t QuantizeValue(float value, float inverseScale,
+                          std::int32_t zeroPoint, QuantizedType type)
+{
+    const auto quantized =
+        std::nearbyint(value * inverseScale) + static_cast<float>(zeroPoint);
+    if (type == QuantizedType::Int8)
+        return static_cast<std::int8_t>(
+            std::clamp(quantized, -127.0f, 127.0f));
+    return static_cast<std::int8_t>(
+        static_cast<std::uint8_t>(std::clamp(quantized, 0.0f, 255.0f)));
+}
+} // namespace
+
+QuantizationParams ChooseQuantizationParams(float min, float max,
+                                            QuantizedType type)
+{
+    min = std::min(min, 0.0f);
+    max = std::max(max, 0.0f);
+
+    QuantizationParams params;
+    if (type == QuantizedType::Int8)
+    {
+        const auto bound = std::max(-min, max);
+        params.Scale = bound > 0.0f ? bound / 127.0f : 1.0f;
+        params.ZeroPoint = 0;
+        return params;
+    }
+
+    params.Scale = max > min ? (max - min) / 255.0f : 1.0f;
+    params.ZeroPoint = static_cast<std::int32_t>(
+        std::clamp(std::nearbyint(-min / params.Scale), 0.0f, 255.0f));
+    return params;
+}
+
+QuantizedTensorData::QuantizedTensorData(
+    Shape shape, QuantizedType type, std::vector<QuantizationParams> params,
+    int channelAxis)
+    : m_shape(std::move(shape)),
+      m_type(type),
+      m_channelAxis(channelAxis),
+      m_data(m_shape.Size(), 0)
+{
+    const auto channels = channelAxis < 0 ? 1 : m_shape.At(channelAxis);
+    if (static_cast<int>(params.size()) != channels)
+        throw std::invalid_argument(
+            "QuantizedTensorData - Expected params of " +
+            std::to_string(channels) + " channels, given : " +
+            std::to_string(params.size()));
+
+    for (const auto& param : params)
+    {
+        m_scales.emplace_back(param.Scale);
+        m_zeroPoints.emplace_back(param.ZeroPoint);
+    }
+}
+
+QuantizedTensorData QuantizedTensorData::Quantize(const TensorData& x,
+                                                  QuantizedType type,
+                                                  QuantizationParams params)
+{
+    CheckHost(x, "Quantize");
+    QuantizedTensorData quantized(x.GetShape(), type, { params });
+
+    const float* src = x.HostRawPtr();
+    const auto inverseScale = 1.0f / params.Scale;
+    const auto size = static_cast<std::size_t>(x.GetShape().Size());
+    for (std::size_t i = 0; i < size; ++i)
+        quantized.m_data[i] =
+            QuantizeValue(src[i], inverseScale, params.ZeroPoint, type);
+    return quantized;
+}
+
+QuantizedTensorData QuantizedTensorData::QuantizePerChannel(
+    const TensorData& x, QuantizedType type, int channelAxis)
+{
+    CheckHost(x, "QuantizePerChannel");
+    const auto shape = x.GetShape();
+    const auto channels = shape.At(channelAxis);
+    const auto inner = InnerSize(shape, channelAxis);
+    const auto size = static_cast<std::size_t>(shape.Size());
+    const float* src = x.HostRawPtr();
+
+    std::vector<float> min(channels, 0.0f), max(channels, 0.0f);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto channel = i / inner % channels;
+        min[channel] = std::min(min[channel], src[i]);
+        max[channel] = std::max(max[channel], src[i]);
+    }
+
+    std::vector<QuantizationParams> params(channels);
+    for (int channel = 0; channel < channels; ++channel)
+        params[channel] =
+            ChooseQuantizationParams(min[channel], max[channel], type);
+
+    QuantizedTensorData quantized(shape, type, params, channelAxis);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto& param = params[i / inner % channels];
+        quantized.m_data[i] = QuantizeValue(src[i], 1.0f / param.Scale,
+                                            param.ZeroPoint, type);
+    }
+    return quantized;
+}
+
+void QuantizedTensorData::Dequantize(TensorData& y) const
+{
+    CheckHost(y, "Dequantize");
+    if (y.GetShape().Size() != m_shape.Size())
+        throw std::invalid_argument(
+            "QuantizedTensorData::Dequantize - Size mismatch Given size : (" +
+            std::to_string(y.GetShape().Size()) + ") expected size : (" +
+            std::to_string(m_shape.Size()) + ")");
+
+    const auto channels = static_cast<std::size_t>(m_scales.size());
+    const auto inner = m_channelAxis < 0 ? 1 : InnerSize(m_shape,
+                                                         m_channelAxis);
+    const auto size = static_cast<std::size_t>(m_shape.Size());
+    float* dst = y.HostMutableRawPtr();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto channel = i / inner % channels;
+        const std::int32_t value =
+            m_type == QuantizedType::Int8
+                ? static_cast<std::int32_t>(m_data[i])
+                : static_cast<std::int32_t>(UInt8RawPtr()[i]);
+        dst[i] = m_scales[channel] *
+                 static_cast<float>(value - m_zeroPoints[channel]);
+    }
+}
+
+void QuantizedTensorData::Prepack(bool transposed)
+{
+    if (m_type != QuantizedType::Int8)
+        throw std::invalid_argument(
+            "QuantizedTensorData::Prepack - Only Int8 data can be packed");
+    if (m_shape.Dim() == 0 || m_shape.Size() == 0)
+        throw std::invalid_argument(
+            "QuantizedTensorData::Prepack - Cannot pack empty data");
+
+    const auto rows = static_cast<unsigned int>(m_shape.At(0));
+    const auto cols = static_cast<unsigned int>(m_shape.Size()) / rows;
+    const auto K = transposed ? cols : rows;
+    const auto N = transposed ? rows : cols;
+    m_prepacked = std::make_shared<Compute::Dense::Naive::PackedInt8Operand>(
+        Compute::Dense::Naive::PackInt8Operand(m_data.data(), K, N,
+                                               transposed));
+    m_prepackedTransposed = transposed;
+}
+
+const Compute::Dense::Naive::PackedInt8Operand* QuantizedTensorData::
+Prepacked(bool transposed) const
+{
+    if (!m_prepacked || m_prepackedTransposed != transposed)
+        return nullptr;
+    return m_prepacked.get();
+}
+} // namespace Sapphire::TensorUtil
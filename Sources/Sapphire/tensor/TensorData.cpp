@@ -6,6 +6,7 @@
 
 #include <Sapphire/compute/cudaUtil/Memory.hpp>
 #include <Sapphire/compute/dense/cuda/Initialize.cuh>
+#include <Sapphire/compute/dense/naive/PackedOperandCache.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
 #include <Sapphire/util/ResourceManager.hpp>
 #include <algorithm>
@@ -22,6 +23,16 @@ TensorData::TensorData(Shape shape, Type type, bool preserve)
     m_allocateHost();
 }
 
+TensorData::TensorData(Shape shape, Type type, DataType dataType,
+                       bool preserve)
+    : m_shape(std::move(shape)),
+      m_type(type),
+      m_dataType(dataType),
+      m_preserve(preserve)
+{
+    m_allocateHost();
+}
+
 TensorData::TensorData(Shape shape, Type type, CudaDevice device, bool preserve)
     : m_shape(std::move(shape)),
       m_type(type),
@@ -37,6 +48,23 @@ TensorData::TensorData(Shape shape, Type type, CudaDevice device, bool preserve)
         m_allocateHost();
 }
 
+TensorData::TensorData(Shape shape, Type type, CudaDevice device,
+                       DataType dataType, bool preserve)
+    : m_shape(std::move(shape)),
+      m_type(type),
+      m_dataType(dataType),
+      m_device(std::move(device)),
+      m_preserve(preserve)
+{
+    if (m_device.GetID() >= 0)
+    {
+        m_mode = DeviceType::Cuda;
+        m_allocateCuda();
+    }
+    else
+        m_allocateHost();
+}
+
 TensorData::TensorData(Shape shape, Type type, CudaDevice device,
                        int parentDescKey, bool preserve)
     : m_shape(std::move(shape)),
@@ -66,6 +94,7 @@ TensorData::TensorData(TensorData&& tensorData) noexcept
       m_denseCuda(tensorData.m_denseCuda),
       m_parentDescKey(tensorData.m_parentDescKey),
       m_type(tensorData.m_type),
+      m_dataType(tensorData.m_dataType),
       m_mode(tensorData.m_mode),
       m_device(std::move(tensorData.m_device)),
       m_preserve(tensorData.m_preserve)
@@ -89,6 +118,7 @@ TensorData& TensorData::operator=(TensorData&& tensorData) noexcept
     m_shape = std::move(tensorData.m_shape);
     m_parentDescKey = tensorData.m_parentDescKey;
     m_type = tensorData.m_type;
+    m_dataType = tensorData.m_dataType;
     m_mode = tensorData.m_mode;
     m_device = std::move(tensorData.m_device);
     m_preserve = tensorData.m_preserve;
@@ -130,8 +160,13 @@ std::vector<float> TensorData::GetDataCopy()
 
     auto dataPtr = std::vector<float>(m_shape.Size());
 
-    for (std::size_t i = 0; i < HostTotalSize; ++i)
-        dataPtr[i] = m_denseHost[i];
+    DispatchDataType(m_dataType, [&](auto tag)
+    {
+        using T = decltype(tag);
+        const auto* src = static_cast<const T*>(m_denseHost);
+        for (std::size_t i = 0; i < HostTotalSize; ++i)
+            dataPtr[i] = static_cast<float>(src[i]);
+    });
 
     return dataPtr;
 }
@@ -147,17 +182,30 @@ void TensorData::SetData(std::vector<float> data)
             std::to_string(shape.Size()) + ")");
     }
 
-    if (m_mode == DeviceType::Cuda)
+    DispatchDataType(m_dataType, [&](auto tag)
     {
-        Compute::Cuda::CopyHostToDevice(m_denseCuda, &data.front(),
-                                        sizeof(float) * shape.Size());
-    }
+        using T = decltype(tag);
+        if (m_mode == DeviceType::Cuda)
+        {
+            //! std::vector<bool> is not contiguous, so elements are
+            //! converted into buffer of bytes
+            std::vector<char> converted(sizeof(T) * shape.Size());
+            auto* dst = reinterpret_cast<T*>(converted.data());
+            for (std::size_t i = 0; i < data.size(); ++i)
+                dst[i] = static_cast<T>(data[i]);
+            Compute::Cuda::CopyHostToDevice(m_denseCuda, converted.data(),
+                                            sizeof(T) * shape.Size());
+        }
 
-    if (m_mode == DeviceType::Host)
-    {
-        for (std::size_t i = 0; i < HostTotalSize; ++i)
-            m_denseHost[i] = data.at(i);
-    }
+        if (m_mode == DeviceType::Host)
+        {
+            auto* dst = static_cast<T*>(m_denseHost);
+            for (std::size_t i = 0; i < HostTotalSize; ++i)
+                dst[i] = static_cast<T>(data.at(i));
+            if (m_preserve)
+                m_invalidatePackedOperand();
+        }
+    });
 }
 
 int TensorData::GetBatchSize(int requiredDim) const
@@ -167,7 +215,8 @@ int TensorData::GetBatchSize(int requiredDim) const
 
 TensorData TensorData::CreateCopy() const
 {
-    TensorData tensorData(m_shape, GetType(), GetDevice(), m_parentDescKey);
+    TensorData tensorData(m_shape, GetType(), GetDevice(), m_dataType);
+    tensorData.m_parentDescKey = m_parentDescKey;
     tensorData.SetMode(m_mode);
 
     DeepCopy(tensorData, *this);
@@ -211,6 +260,9 @@ void TensorData::DeepCopy(TensorData& dst, const TensorData& src)
         throw std::invalid_argument(
             "DeepCopy - matrix or device type mismatch");
 
+    if (dst.GetDataType() != src.GetDataType())
+        throw std::invalid_argument("DeepCopy - data type mismatch");
+
     if (dst.Mode() != src.Mode())
         throw std::invalid_argument("DeepCopy - Mode mismatch");
 
@@ -224,20 +276,23 @@ void TensorData::DeepCopy(TensorData& dst, const TensorData& src)
 
     const auto mode = dst.Mode();
     const auto matrixType = dst.GetType();
+    //! src is repeated over dst, one copy of src at a time
+    const auto byteSize = src.Size() * src.ElementSize();
+
+    if (mode == DeviceType::Host && dst.m_preserve)
+        dst.m_invalidatePackedOperand();
 
     for (int i = 0; i < dst.Size() / src.Size(); ++i)
         if (mode == DeviceType::Cuda && matrixType == Type::Dense)
         {
-            auto* dstPtr = dst.m_denseCuda + src.Size() * i;
-            Compute::Cuda::CopyDeviceToDevice(
-                dstPtr, src.m_denseCuda,
-                dst.DenseTotalLengthCuda * sizeof(float));
+            auto* dstPtr = static_cast<char*>(dst.m_denseCuda) + byteSize * i;
+            Compute::Cuda::CopyDeviceToDevice(dstPtr, src.m_denseCuda,
+                                              byteSize);
         }
         else if (mode == DeviceType::Host && matrixType == Type::Dense)
         {
-            auto* dstPtr = dst.m_denseHost + src.Size() * i;
-            std::memcpy(dstPtr, src.m_denseHost,
-                        dst.HostTotalSize * sizeof(float));
+            auto* dstPtr = static_cast<char*>(dst.m_denseHost) + byteSize * i;
+            std::memcpy(dstPtr, src.m_denseHost, byteSize);
         }
         else if (mode == DeviceType::Cuda && matrixType == Type::Sparse)
             throw std::runtime_error(
@@ -247,6 +302,13 @@ void TensorData::DeepCopy(TensorData& dst, const TensorData& src)
                 "DeepCopy - Host Sparse ddp copy is not implemented");
 }
 
+void TensorData::m_invalidatePackedOperand() const
+{
+    if (m_denseHost != nullptr)
+        Compute::Dense::Naive::InvalidatePackedOperand(
+            m_denseHost, HostTotalSize * ElementSize());
+}
+
 void TensorData::m_toCuda()
 {
     if (m_type == Type::Sparse)
@@ -259,7 +321,7 @@ void TensorData::m_toCuda()
         m_allocateCuda();
 
     Compute::Cuda::CopyHostToDevice(m_denseCuda, m_denseHost,
-                                    HostTotalSize * sizeof(float));
+                                    HostTotalSize * ElementSize());
 }
 
 void TensorData::m_toHost()
@@ -272,9 +334,11 @@ void TensorData::m_toHost()
 
     if (m_denseHost == nullptr)
         m_allocateHost();
+    else if (m_preserve)
+        m_invalidatePackedOperand();
 
     Compute::Cuda::CopyDeviceToHost(m_denseHost, m_denseCuda,
-                                    HostTotalSize * sizeof(float));
+                                    HostTotalSize * ElementSize());
 }
 
 void TensorData::m_allocateHost()
@@ -283,17 +347,14 @@ void TensorData::m_allocateHost()
         throw std::runtime_error("m_allocate - Sparse not implemented");
 
     HostTotalSize = m_shape.Size();
+    const auto byteSize = HostTotalSize * ElementSize();
 
     if (m_preserve)
-        m_denseHost = static_cast<float*>(
-            Util::ResourceManager::GetMemoryHost(
-                HostTotalSize * sizeof(float), true));
+        m_denseHost = Util::ResourceManager::GetMemoryHost(byteSize, true);
     else
-        m_denseHost = static_cast<float*>(
-            Util::ResourceManager::GetMemoryHost(
-                HostTotalSize * sizeof(float)));
+        m_denseHost = Util::ResourceManager::GetMemoryHost(byteSize);
 
-    std::memset(m_denseHost, 0, HostTotalSize * sizeof(float));
+    std::memset(m_denseHost, 0, byteSize);
 }
 
 void TensorData::m_allocateCuda()
@@ -304,19 +365,21 @@ void TensorData::m_allocateCuda()
     }
 
     const unsigned long totalSize = m_shape.Size();
+    const auto byteSize = totalSize * ElementSize();
 
     if (m_preserve)
     {
-        m_denseCuda = static_cast<float*>(
-            Util::ResourceManager::GetMemoryCuda(
-                totalSize * sizeof(float), true));
+        m_denseCuda = Util::ResourceManager::GetMemoryCuda(byteSize, true);
     }
     else
-        m_denseCuda = static_cast<float*>(
-            Util::ResourceManager::GetMemoryCuda(
-                totalSize * sizeof(float)));
+        m_denseCuda = Util::ResourceManager::GetMemoryCuda(byteSize);
     DenseTotalLengthCuda = totalSize;
 
-    Compute::Dense::Cuda::Scalar(m_denseCuda, 0.0f, DenseTotalLengthCuda);
+    //! Zero bits are zero in every data type, and allocations are rounded up
+    //! to the allocation unit, which is multiple of float
+    Compute::Dense::Cuda::Scalar(
+        static_cast<float*>(m_denseCuda), 0.0f,
+        static_cast<unsigned int>((byteSize + sizeof(float) - 1) /
+                                  sizeof(float)));
 }
 } // namespace Sapphire::TensorUtil
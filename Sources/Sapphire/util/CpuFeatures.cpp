@@ -0,0 +1,138 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/CpuFeatures.hpp>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SAPPHIRE_X86
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define SAPPHIRE_X86
+#endif
+
+namespace Sapphire::Util
+{
+namespace
+{
+#ifdef SAPPHIRE_X86
+void CpuId(std::uint32_t leaf, std::uint32_t subLeaf, std::uint32_t* regs)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subLeaf));
+    for (int i = 0; i < 4; ++i)
+        regs[i] = static_cast<std::uint32_t>(info[i]);
+#else
+    __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+//! Reads extended control register 0 (XCR0)
+//! Should be called only if OSXSAVE is set
+std::uint64_t XGetBv()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    std::uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+bool Bit(std::uint32_t reg, int bit)
+{
+    return (reg >> bit) & 1u;
+}
+#endif
+
+CpuFeatures Detect()
+{
+    CpuFeatures features;
+#ifdef SAPPHIRE_X86
+    std::uint32_t regs[4] = {};
+    CpuId(0, 0, regs);
+    const auto maxLeaf = regs[0];
+
+    CpuId(1, 0, regs);
+    const auto ecx1 = regs[2];
+    const auto edx1 = regs[3];
+
+    features.Sse2 = Bit(edx1, 26);
+    features.Sse41 = Bit(ecx1, 19);
+    features.Sse42 = Bit(ecx1, 20);
+
+    //! ymm state (bit 1, 2) and zmm state (bit 5, 6, 7) must be enabled by OS
+    const bool osXSave = Bit(ecx1, 27);
+    const auto xcr0 = osXSave ? XGetBv() : 0;
+    const bool osYmm = (xcr0 & 0x6) == 0x6;
+    const bool osZmm = (xcr0 & 0xe6) == 0xe6;
+
+    features.Avx = osYmm && Bit(ecx1, 28);
+    features.Fma = features.Avx && Bit(ecx1, 12);
+    features.F16c = features.Avx && Bit(ecx1, 29);
+
+    if (maxLeaf >= 7)
+    {
+        CpuId(7, 0, regs);
+        const auto ebx7 = regs[1];
+        const auto ecx7 = regs[2];
+        const auto subLeaves = regs[0];
+
+        features.Avx2 = features.Avx && Bit(ebx7, 5);
+        features.Avx512F = osZmm && Bit(ebx7, 16);
+        features.Avx512Dq = features.Avx512F && Bit(ebx7, 17);
+        features.Avx512Bw = features.Avx512F && Bit(ebx7, 30);
+        features.Avx512Vl = features.Avx512F && Bit(ebx7, 31);
+        features.Avx512Vnni = features.Avx512F && Bit(ecx7, 11);
+
+        if (subLeaves >= 1)
+        {
+            CpuId(7, 1, regs);
+            features.Avx512Bf16 = features.Avx512F && Bit(regs[0], 5);
+        }
+    }
+#endif
+    return features;
+}
+} // namespace
+
+std::string CpuFeatures::ToString() const
+{
+    std::string str;
+    const auto append = [&str](bool enabled, const char* name)
+    {
+        if (!enabled)
+            return;
+        if (!str.empty())
+            str += " ";
+        str += name;
+    };
+
+    append(Sse2, "sse2");
+    append(Sse41, "sse4.1");
+    append(Sse42, "sse4.2");
+    append(Avx, "avx");
+    append(Avx2, "avx2");
+    append(Fma, "fma");
+    append(F16c, "f16c");
+    append(Avx512F, "avx512f");
+    append(Avx512Dq, "avx512dq");
+    append(Avx512Bw, "avx512bw");
+    append(Avx512Vl, "avx512vl");
+    append(Avx512Vnni, "avx512vnni");
+    append(Avx512Bf16, "avx512bf16");
+    return str;
+}
+
+const CpuFeatures& GetCpuFeatures()
+{
+    static const CpuFeatures features = Detect();
+    return features;
+}
+} // namespace Sapphire::Util
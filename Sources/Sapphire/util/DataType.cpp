@@ -0,0 +1,44 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/DataType.hpp>
+
+namespace Sapphire
+{
+static_assert(sizeof(bool) == 1, "Bool is stored as one byte per element");
+
+std::size_t DataTypeSize(DataType dataType)
+{
+    return DispatchDataType(dataType,
+                            [](auto tag) { return sizeof(tag); });
+}
+
+std::string DataTypeToString(DataType dataType)
+{
+    switch (dataType)
+    {
+    case DataType::Float32:
+        return "Float32";
+    case DataType::Float64:
+        return "Float64";
+    case DataType::Int32:
+        return "Int32";
+    case DataType::Int8:
+        return "Int8";
+    case DataType::UInt8:
+        return "UInt8";
+    case DataType::Bool:
+        return "Bool";
+    }
+    return "Unknown";
+}
+
+bool IsIntegral(DataType dataType)
+{
+    return dataType == DataType::Int32 || dataType == DataType::Int8 ||
+           dataType == DataType::UInt8;
+}
+} // namespace Sapphire
@@ -0,0 +1,43 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/Parallel.hpp>
+#include <atomic>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Sapphire::Util
+{
+namespace
+{
+std::atomic<int> globalNumThreads(0);
+}
+
+void SetNumThreads(int numThreads)
+{
+    globalNumThreads.store(numThreads > 0 ? numThreads : 0,
+                           std::memory_order_relaxed);
+}
+
+int GetNumThreads()
+{
+    const auto numThreads = globalNumThreads.load(std::memory_order_relaxed);
+    if (numThreads > 0)
+        return numThreads;
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+int ResolveNumThreads(int numThreads)
+{
+    return numThreads > 0 ? numThreads : GetNumThreads();
+}
+} // namespace Sapphire::Util
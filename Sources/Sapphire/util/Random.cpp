@@ -0,0 +1,56 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/Random.hpp>
+#include <mutex>
+#include <random>
+
+namespace Sapphire::Util
+{
+namespace
+{
+struct GlobalRandomState
+{
+    std::mutex Mutex;
+    std::uint64_t Seed;
+    std::uint64_t NextStream = 0;
+
+    GlobalRandomState()
+    {
+        std::random_device rd;
+        Seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+    }
+};
+
+GlobalRandomState& GetGlobalRandomState()
+{
+    static GlobalRandomState state;
+    return state;
+}
+} // namespace
+
+void SetSeed(std::uint64_t seed)
+{
+    auto& state = GetGlobalRandomState();
+    std::lock_guard lock(state.Mutex);
+    state.Seed = seed;
+    state.NextStream = 0;
+}
+
+std::uint64_t GetSeed()
+{
+    auto& state = GetGlobalRandomState();
+    std::lock_guard lock(state.Mutex);
+    return state.Seed;
+}
+
+RandomStream NextRandomStream()
+{
+    auto& state = GetGlobalRandomState();
+    std::lock_guard lock(state.Mutex);
+    return { state.Seed, state.NextStream++ };
+}
+} // namespace Sapphire::Util
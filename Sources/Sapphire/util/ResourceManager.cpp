@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Sapphire/compute/cudaUtil/Memory.hpp>
+#include <Sapphire/compute/dense/naive/PackedOperandCache.hpp>
 #include <Sapphire/util/ResourceManager.hpp>
 #include <Sapphire/compute/cudaUtil/CudaParams.cuh>
 #include <cassert>
@@ -114,6 +115,10 @@ void ResourceManager::FreePreservedHost(void* ptr)
         throw std::runtime_error(
             "ResourceManager::FreePreservedHost - Given ptr to free was not "
             "found");
+    //! Packed copy of freed data must not be found by new allocation at the
+    //! same address
+    Compute::Dense::Naive::InvalidatePackedOperand(ptr,
+                                                   itr->second.ByteSize);
     FreeHost(ptr);
     m_hostPreservedPool.erase(reinterpret_cast<std::intptr_t>(ptr));
 }
@@ -164,6 +169,8 @@ void ResourceManager::MoveToVolatileHost(void* ptr)
         throw std::runtime_error(
             "ResourceManager::MoveToPreservedHost - Cannot find given ptr");
 
+    Compute::Dense::Naive::InvalidatePackedOperand(ptr,
+                                                   itr->second.ByteSize);
     auto temp = *itr;
     m_hostPreservedPool.erase(itr);
     m_hostVolatilePool.emplace(temp);
@@ -282,6 +289,7 @@ void ResourceManager::Clean()
 
 void ResourceManager::ClearPreservedPool()
 {
+    Compute::Dense::Naive::ClearPackedOperands();
     for (auto& [key, memoryChunk] : m_hostPreservedPool)
         FreeHost(memoryChunk.Data);
     for (auto& [key, memoryChunk] : m_cudaPreservedPool)
@@ -0,0 +1,17 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_CROSSENTROPY_TEST_HPP
+#define SAPPHIRE_TEST_CROSSENTROPY_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares loss and gradient of fused CrossEntropy on host with
+//! log-softmax and one-hot labels computed in double
+void TestCrossEntropy(bool print);
+}
+
+#endif
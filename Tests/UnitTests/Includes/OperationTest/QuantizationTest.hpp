@@ -0,0 +1,20 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_QUANTIZATION_TEST_HPP
+#define SAPPHIRE_TEST_QUANTIZATION_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Calibrates fp32 Linear with an observer, and compares output of the
+//! QuantizedLinear built from it with the fp32 output
+void TestQuantizedLinear(bool print);
+
+//! Same as TestQuantizedLinear for Conv2D and QuantizedConv2D
+void TestQuantizedConv2D(bool print);
+}
+
+#endif
@@ -0,0 +1,87 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <OperationTest/CrossEntropyTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Loss/CrossEntropy.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <doctest/doctest.h>
+
+namespace Sapphire::Test
+{
+void TestCrossEntropy(bool print)
+{
+    ModelManager::AddModel("myModel");
+    ModelManager::SetCurrentModel("myModel");
+
+    //! Rows longer than a block of the kernel are read in several blocks
+    const int batchSize = 7;
+    const int classes = 3000;
+
+    const CudaDevice device;
+    Tensor x(Shape({ batchSize, classes }), device, Type::Dense);
+    Tensor label(Shape({ batchSize }), device, Type::Dense);
+    x.SetMode(DeviceType::Host);
+    label.SetMode(DeviceType::Host);
+
+    std::mt19937 gen(0);
+    std::normal_distribution<float> logit(0.0f, 20.0f);
+    std::uniform_int_distribution<int> index(0, classes - 1);
+    std::vector<float> vx(batchSize * classes), vLabel(batchSize);
+    for (auto& elem : vx)
+        elem = logit(gen);
+    for (auto& elem : vLabel)
+        elem = static_cast<float>(index(gen));
+    x.LoadData(vx);
+    label.LoadData(vLabel);
+
+    const auto loss = NN::Loss::CrossEntropy(x, label);
+    CHECK(loss.GetShape().Size() == 1);
+    //! Gradient of the loss is scaled by its own gradient
+    const float dLoss = 0.5f;
+    loss.SetBackwardData({ dLoss });
+    ModelManager::CurModel().BackProp(loss);
+    const auto forward = loss.GetDataCopy();
+    const auto backward = x.GetBackwardDataCopy();
+
+    double expected = 0.0;
+    for (int row = 0; row < batchSize; ++row)
+    {
+        const auto begin = vx.begin() + row * classes;
+        const double max = *std::max_element(begin, begin + classes);
+        double sum = 0.0;
+        for (int col = 0; col < classes; ++col)
+            sum += std::exp(begin[col] - max);
+        const auto logSumExp = max + std::log(sum);
+        const auto target = static_cast<int>(vLabel[row]);
+        expected += logSumExp - begin[target];
+
+        for (int col = 0; col < classes; ++col)
+        {
+            const auto gradient =
+                dLoss * (std::exp(begin[col] - logSumExp) - (col == target)) /
+                batchSize;
+            CHECK(backward[row * classes + col] ==
+                doctest::Approx(gradient).epsilon(1e-4).scale(1e-3));
+        }
+    }
+    expected /= batchSize;
+
+    if (print)
+        std::cout << "CrossEntropy : " << forward[0]
+            << " (expected : " << expected << ")" << std::endl;
+    CHECK(forward[0] == doctest::Approx(expected).epsilon(1e-5));
+
+    vLabel[0] = static_cast<float>(classes);
+    label.LoadData(vLabel);
+    CHECK_THROWS_AS(NN::Loss::CrossEntropy(x, label), std::out_of_range);
+
+    ModelManager::CurModel().Clear();
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,136 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <OperationTest/QuantizationTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Forward/Conv2D.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/Forward/QuantizedConv2D.hpp>
+#include <Sapphire/operations/Forward/QuantizedLinear.hpp>
+#include <Sapphire/operations/Quantization/Observer.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <cmath>
+#include <iostream>
+#include <doctest/doctest.h>
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Quantization error of int8 inference should be small relative to the
+//! magnitude of the fp32 output
+void CheckQuantizationError(const std::vector<float>& expected,
+                            const std::vector<float>& quantized, bool print)
+{
+    CHECK(expected.size() == quantized.size());
+    double errorSquareSum = 0.0, squareSum = 0.0;
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        const auto error = static_cast<double>(expected[i] - quantized[i]);
+        errorSquareSum += error * error;
+        squareSum += static_cast<double>(expected[i]) * expected[i];
+    }
+
+    if (print)
+        std::cout << "Relative RMS error of quantized output : "
+            << std::sqrt(errorSquareSum / squareSum) << std::endl;
+    CHECK(std::sqrt(errorSquareSum) < 0.05 * std::sqrt(squareSum));
+}
+} // namespace
+
+void TestQuantizedLinear(bool print)
+{
+    const int batchSize = 8;
+    const int inputs = 100;
+    const int outputs = 60;
+
+    ModelManager::AddModel("myModel");
+    ModelManager::SetCurrentModel("myModel");
+
+    const CudaDevice device;
+    Tensor input(Shape({ batchSize, 1, inputs }), device, Type::Dense);
+    Tensor weight(Shape({ outputs, inputs }), device, Type::Dense);
+    Tensor bias(Shape({ 1, outputs }), device, Type::Dense);
+    input.SetMode(DeviceType::Host);
+    weight.SetMode(DeviceType::Host);
+    bias.SetMode(DeviceType::Host);
+
+    Initialize::Initialize(input,
+                           std::make_unique<Initialize::Normal>(0.0f, 1.0f));
+    Initialize::Initialize(weight,
+                           std::make_unique<Initialize::Normal>(0.0f, 1.0f));
+    Initialize::Initialize(bias,
+                           std::make_unique<Initialize::Normal>(0.0f, 1.0f));
+
+    //! Calibrate the fp32 layer
+    auto observer = std::make_shared<Quantization::MinMaxObserver>();
+    NN::Linear linear(inputs, outputs, new Optimizer::SGD(0.0f), device,
+                      false, Compute::GemmActivation::LeakyReLU, 0.1f);
+    linear.SetObserver(observer);
+    const auto output = linear(input, weight, bias);
+    const auto expected = output.GetDataCopy();
+    CHECK(observer->Count() == static_cast<std::size_t>(batchSize * inputs));
+
+    NN::QuantizedLinear quantizedLinear(
+        inputs, outputs, weight, bias, observer->GetParams(),
+        Compute::GemmActivation::LeakyReLU, 0.1f);
+    const auto quantizedOutput = quantizedLinear(input);
+    CHECK(quantizedOutput.GetShape() == output.GetShape());
+    CheckQuantizationError(expected, quantizedOutput.GetDataCopy(), print);
+
+    ModelManager::CurModel().Clear();
+}
+
+void TestQuantizedConv2D(bool print)
+{
+    const int batchSize = 2;
+    const int inputChannels = 3;
+    const int outputChannels = 8;
+    const auto inputSize = std::make_pair(9, 7);
+    const auto filterSize = std::make_pair(3, 3);
+    const auto stride = std::make_pair(2, 1);
+    const auto dilation = std::make_pair(1, 1);
+    const auto padSize = std::make_pair(1, 1);
+
+    ModelManager::AddModel("myModel");
+    ModelManager::SetCurrentModel("myModel");
+
+    const CudaDevice device;
+    Tensor input(Shape({ batchSize, inputChannels, inputSize.first,
+                         inputSize.second }), device, Type::Dense);
+    Tensor filter(Shape({ outputChannels, inputChannels, filterSize.first,
+                          filterSize.second }), device, Type::Dense);
+    Tensor bias(Shape({ outputChannels }), device, Type::Dense);
+    input.SetMode(DeviceType::Host);
+    filter.SetMode(DeviceType::Host);
+    bias.SetMode(DeviceType::Host);
+
+    Initialize::Initialize(
+        input, std::make_unique<Initialize::Normal>(0.0f, 1.0f));
+    Initialize::Initialize(
+        filter, std::make_unique<Initialize::Normal>(0.0f, 1.0f));
+    Initialize::Initialize(
+        bias, std::make_unique<Initialize::Normal>(0.0f, 1.0f));
+
+    //! Calibrate the fp32 layer
+    auto observer = std::make_shared<Quantization::HistogramObserver>();
+    NN::Conv2D conv2D(outputChannels, inputChannels, inputSize, filterSize,
+                      stride, padSize, dilation, new Optimizer::SGD(0.0f),
+                      true);
+    conv2D.SetObserver(observer);
+    const auto output = conv2D(input, filter, bias);
+    const auto expected = output.GetDataCopy();
+
+    NN::QuantizedConv2D quantizedConv2D(
+        outputChannels, inputChannels, inputSize, filterSize, stride,
+        padSize, dilation, filter, bias, observer->GetParams());
+    const auto quantizedOutput = quantizedConv2D(input);
+    CHECK(quantizedOutput.GetShape() == output.GetShape());
+    CheckQuantizationError(expected, quantizedOutput.GetDataCopy(), print);
+
+    ModelManager::CurModel().Clear();
+}
+} // namespace Sapphire::Test
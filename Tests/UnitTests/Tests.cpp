@@ -15,13 +15,19 @@
 #include <OperationTest/MathTest.hpp>
 #include <OperationTest/MeanTest.hpp>
 #include <OperationTest/MSETest.hpp>
+#include <OperationTest/CrossEntropyTest.hpp>
 #include <OperationTest/LinearTest.hpp>
 #include <OperationTest/Conv2DTest.hpp>
+#include <OperationTest/QuantizationTest.hpp>
 #include <ModelTest/Conv2DModel.hpp>
 #include <ModelTest/SimpleLinearModel.hpp>
 #include <Sapphire/Tests/Basics/TransposeTest.hpp>
+#include <Sapphire/Tests/Basics/ElementwiseTest.hpp>
+#include <Sapphire/Tests/Basics/FusedTest.hpp>
+#include <Sapphire/Tests/Basics/ReduceTest.hpp>
 #include <Sapphire/Tests/TensorTest/TensorFunctionalityTest.hpp>
 #include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/Tests/InitializeTest.hpp>
 #include <Sapphire/Tests/Conv2DTest.hpp>
 #include <Sapphire/compute/TrigonometricOps.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
@@ -42,6 +48,9 @@
 #define BasicGraphTest
 #define ModelTest
 
+//! Latency benchmarks assert nothing and are not run by default
+//! #define GemvLatencyBenchmark
+
 namespace Sapphire::Test
 {
 TEST_CASE("Simple test")
@@ -88,6 +97,12 @@ TEST_CASE("TensorFunctionalityTest")
         for (int i = 0; i < 5; ++i)
             TensorDataCopyOnHost(false);
     }
+
+    SUBCASE("TensorDataTypes")
+    {
+        for (int i = 0; i < 5; ++i)
+            TensorDataTypes(false);
+    }
 }
 #endif
 
@@ -103,6 +118,13 @@ TEST_CASE("Basics")
         Util::ResourceManager::ClearAll();
     }
 
+    SUBCASE("Transpose on host")
+    {
+        std::cout << "Transpose on host" << std::endl;
+        for (int i = 0; i < testLoops; ++i)
+            TransposeHostTest(false);
+    }
+
     SUBCASE("Reshape")
     {
         std::cout << "Reshape" << std::endl;
@@ -135,6 +157,48 @@ TEST_CASE("Basics")
         Util::ResourceManager::ClearAll();
     }
 
+    SUBCASE("Elementwise broadcast")
+    {
+        std::cout << "Elementwise broadcast Test" << std::endl;
+        for (int i = 0; i < testLoops; ++i)
+            ElementwiseBroadcastTest(false);
+    }
+
+    SUBCASE("Transcendental functions")
+    {
+        std::cout << "Transcendental functions Test" << std::endl;
+        for (int i = 0; i < testLoops; ++i)
+            TranscendentalTest(false);
+    }
+
+    SUBCASE("Transcendental backward")
+    {
+        std::cout << "Transcendental backward Test" << std::endl;
+        for (int i = 0; i < testLoops; ++i)
+            TranscendentalBackwardTest(false);
+    }
+
+    SUBCASE("Softmax")
+    {
+        std::cout << "Softmax Test" << std::endl;
+        for (int i = 0; i < testLoops; ++i)
+            SoftmaxTest(false);
+    }
+
+    SUBCASE("Fused expressions")
+    {
+        std::cout << "Fused expressions Test" << std::endl;
+        for (int i = 0; i < testLoops; ++i)
+            FusedExpressionTest(false);
+    }
+
+    SUBCASE("Reductions")
+    {
+        std::cout << "Reductions Test" << std::endl;
+        for (int i = 0; i < testLoops; ++i)
+            ReduceTest(false);
+    }
+
     SUBCASE("log")
     {
         std::cout << "Log Test" << std::endl;
@@ -212,6 +276,98 @@ TEST_CASE("Gemm Test")
         }
         Util::ResourceManager::ClearAll();
     }
+
+    SUBCASE("Gemm against reference")
+    {
+        GemmReference(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with instruction sets")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmInstructionSets(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with multiple threads")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmMultiThread(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with transposed operands")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmTranspose(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with alpha and beta")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmAlphaBeta(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with fused bias and activation")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmBiasActivation(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with vector operands")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemvCorrectness(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with small batched matrices")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmSmallBatched(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with packed operand cache")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmPackedCache(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Gemm with autotuning")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            GemmAutotune(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Quantized gemm")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            QuantizedGemm(false);
+        Util::ResourceManager::ClearAll();
+    }
+
+    SUBCASE("Half precision gemm")
+    {
+        for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
+            HalfGemm(false);
+        Util::ResourceManager::ClearAll();
+    }
+}
+#endif
+
+#ifdef GemvLatencyBenchmark
+TEST_CASE("Gemv latency")
+{
+    const auto latency = GemvPerformance(1024, 1024, 100);
+    latency.PrintData();
+    Util::ResourceManager::ClearAll();
 }
 #endif
 
@@ -239,6 +395,13 @@ TEST_CASE("Gemm Broadcast Test")
             BroadcastMixed(false);
         Util::ResourceManager::ClearAll();
     }
+
+    SUBCASE("Broadcast test element-wise")
+    {
+        for (int i = 0; i < testLoops; i++)
+            BroadcastElementwiseOps(false);
+        Util::ResourceManager::ClearAll();
+    }
 }
 #endif
 
@@ -259,9 +422,18 @@ TEST_CASE("InitializeTest")
         std::cout << "Initialize Normal" << std::endl;
         for (int i = 0; i < testLoops; i++)
         {
-            NoneZeroTest(Compute::Initialize::Normal, false, 100.0f, 1.0f);
+            NoneZeroTest([](TensorUtil::TensorData& data, float mean,
+                            float sd)
+                         {
+                             Compute::Initialize::Normal(data, mean, sd);
+                         }, false, 100.0f, 1.0f);
         }
     }
+    SUBCASE("Initialize with seed")
+    {
+        std::cout << "Initialize with seed" << std::endl;
+        SeededInitializeTest(false);
+    }
 }
 #endif
 
@@ -276,6 +448,12 @@ TEST_CASE("Convolution")
         Util::ResourceManager::ClearAll();
     }
 
+    SUBCASE("Im2ColHost against reference")
+    {
+        HostIm2ColReferenceTest(false);
+        Util::ResourceManager::ClearAll();
+    }
+
     SUBCASE("HostConv2D")
     {
         std::cout << "Host Conv2D" << std::endl;
@@ -336,6 +514,12 @@ TEST_CASE("BasicGraphTest")
         TestMSE(false);
     }
 
+    SUBCASE("CrossEntropyTest")
+    {
+        std::cout << "CrossEntropy" << std::endl;
+        TestCrossEntropy(false);
+    }
+
     SUBCASE("AddTest")
     {
         std::cout << "Add" << std::endl;
@@ -354,6 +538,14 @@ TEST_CASE("BasicGraphTest")
         for (int i = 0; i < 3; ++i)
             TestConv2D(false);
     }
+
+    SUBCASE("QuantizationTest")
+    {
+        std::cout << "Quantized Linear" << std::endl;
+        TestQuantizedLinear(false);
+        std::cout << "Quantized Conv2D" << std::endl;
+        TestQuantizedConv2D(false);
+    }
 }
 #endif
 